@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+
+ROOT_DIR = Path(__file__).resolve().parent.parent
+DEFAULT_BASELINE = ROOT_DIR / "scripts" / "emulator-bench-baseline.json"
+PKJS_INDEX = ROOT_DIR / "src" / "pkjs" / "index.js"
+
+# yes_prof_tick() summary, logged every minute in the benchmark build (PROF_LOG_EVERY_MIN=1).
+PROF_LINE = re.compile(
+    r"prof face (?P<face_last>\d+)/(?P<face_max>\d+)ms n=(?P<face_n>\d+) "
+    r"corners (?P<corners_last>\d+)/(?P<corners_max>\d+)ms fb (?P<fb_max>\d+)ms inbox (?P<inbox_max>\d+)ms "
+    r"rd=(?P<rd>\d+) wk=(?P<wk>\d+) m=(?P<m>\d+) heap=(?P<heap>\d+)"
+)
+STARTUP_LINE = re.compile(r"prof startup frame0 (?P<frame0>\d+)ms complete (?P<complete>\d+)ms")
+
+# key, column label, allowed relative increase, absolute slack. Counts are deterministic for a
+# given cadence; times carry QEMU scheduling jitter, hence the slack.
+METRICS = [
+    ("redraws_per_hour", "rd/h", 0.05, 2),
+    ("wakes_per_hour", "wk/h", 0.05, 2),
+    ("face_max_ms", "face ms", 0.25, 4),
+    ("corners_max_ms", "corner ms", 0.25, 4),
+    ("startup_ms", "start ms", 0.25, 20),
+    ("heap_high", "heap B", 0.02, 64),
+]
+
+
+def update_interval_choices():
+    text = PKJS_INDEX.read_text(encoding="utf-8")
+    match = re.search(r"const UPDATE_INTERVAL_CHOICES_SEC = \[([^\]]*)\]", text)
+    if not match:
+        raise SystemExit(f"UPDATE_INTERVAL_CHOICES_SEC not found in {PKJS_INDEX}")
+    return [int(v) for v in match.group(1).replace(" ", "").split(",") if v]
+
+
+def load_json(path):
+    path = Path(path)
+    if not path.exists():
+        return {}
+    return json.loads(path.read_text(encoding="utf-8"))
+
+
+def write_json(path, data):
+    Path(path).write_text(json.dumps(data, indent=2, sort_keys=True) + "\n", encoding="utf-8")
+
+
+def parse_log(log_path, skip):
+    lines = Path(log_path).read_text(encoding="utf-8", errors="replace").splitlines()
+    prof = [m.groupdict() for m in map(PROF_LINE.search, lines) if m]
+    prof = [{k: int(v) for k, v in p.items()} for p in prof]
+    startup = [m for m in map(STARTUP_LINE.search, lines) if m]
+
+    # Drop the lines of the settling minutes (startup, seeding, the cadence change), then take
+    # the rates over the rest. The hourly counters restart after 60 ticks; stop at a restart.
+    window = prof[skip:]
+    for i in range(1, len(window)):
+        if window[i]["m"] < window[i - 1]["m"]:
+            window = window[:i]
+            break
+    if len(window) < 2:
+        raise SystemExit(f"{log_path}: need at least {skip + 2} profiler lines, found {len(prof)}")
+
+    first, last = window[0], window[-1]
+    minutes = last["m"] - first["m"]
+    return {
+        "minutes": minutes,
+        "redraws_per_hour": round((last["rd"] - first["rd"]) * 60 / minutes),
+        "wakes_per_hour": round((last["wk"] - first["wk"]) * 60 / minutes),
+        "face_max_ms": last["face_max"],
+        "corners_max_ms": last["corners_max"],
+        "startup_ms": int(startup[-1].group("complete")) if startup else None,
+        "heap_high": last["heap"],
+    }
+
+
+def cmd_intervals(_args):
+    print(" ".join(str(v) for v in update_interval_choices()))
+    return 0
+
+
+def cmd_record(args):
+    results = load_json(args.results)
+    metrics = parse_log(args.log, args.skip)
+    results.setdefault(args.platform, {})[str(args.interval)] = metrics
+    write_json(args.results, results)
+    print(f"{args.platform} {args.interval}s: " +
+          " ".join(f"{label}={metrics[key]}" for key, label, _, _ in METRICS))
+    return 0
+
+
+def regressed(value, base, rel_tol, slack, scale):
+    if value is None or base is None:
+        return False
+    return value > base * (1.0 + rel_tol * scale) + slack * scale
+
+
+def format_cell(value, base, bad):
+    if value is None:
+        return "-"
+    text = str(value)
+    if base:
+        text += f" ({(value - base) * 100.0 / base:+.0f}%)"
+    return text + (" !" if bad else "")
+
+
+def cmd_report(args):
+    results = load_json(args.results)
+    if not results:
+        raise SystemExit(f"No benchmark results in {args.results}")
+    baseline = {} if args.update else load_json(args.baseline)
+    failures = []
+
+    for platform in sorted(results):
+        rows = [["cycle"] + [label for _, label, _, _ in METRICS]]
+        for interval in sorted(results[platform], key=int):
+            metrics = results[platform][interval]
+            base = baseline.get(platform, {}).get(interval, {})
+            row = [f"{interval}s"]
+            for key, label, rel_tol, slack in METRICS:
+                bad = regressed(metrics.get(key), base.get(key), rel_tol, slack, args.tolerance_scale)
+                if bad:
+                    failures.append(f"{platform} {interval}s {label}: {metrics.get(key)} vs {base.get(key)}")
+                row.append(format_cell(metrics.get(key), base.get(key), bad))
+            rows.append(row)
+
+        widths = [max(len(r[i]) for r in rows) for i in range(len(rows[0]))]
+        print(f"\n{platform}")
+        for r in rows:
+            print("  " + "  ".join(cell.rjust(w) for cell, w in zip(r, widths)))
+
+    if args.update:
+        write_json(args.baseline, results)
+        print(f"\nWrote baseline {args.baseline}")
+        return 0
+    if not baseline:
+        print(f"\nNo baseline at {args.baseline}; accept these numbers with --update.")
+        return 0
+    if failures:
+        print("\nRegressions beyond threshold:", file=sys.stderr)
+        for f in failures:
+            print(f"  {f}", file=sys.stderr)
+        return 1
+    print("\nNo regressions against baseline.")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Emulator power/perf benchmark: parse profiler logs and compare against a baseline.")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("intervals", help="Print the config page's corner update cycle choices")
+    p.set_defaults(func=cmd_intervals)
+
+    p = sub.add_parser("record", help="Add one platform/cycle run from a `pebble logs` capture")
+    p.add_argument("--platform", required=True)
+    p.add_argument("--interval", type=int, required=True)
+    p.add_argument("--log", required=True, help="Captured `pebble logs` output")
+    p.add_argument("--results", required=True, help="Results JSON to update")
+    p.add_argument("--skip", type=int, default=2, help="Profiler lines to drop while the face settles")
+    p.set_defaults(func=cmd_record)
+
+    p = sub.add_parser("report", help="Print per-platform tables; exit 1 on a regression")
+    p.add_argument("--results", required=True)
+    p.add_argument("--baseline", default=str(DEFAULT_BASELINE))
+    p.add_argument("--tolerance-scale", type=float, default=1.0,
+                   help="Multiply every metric's threshold (default: 1.0)")
+    p.add_argument("--update", action="store_true", help="Write these results as the new baseline")
+    p.set_defaults(func=cmd_report)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
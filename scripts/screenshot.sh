@@ -26,16 +26,23 @@ with open(sys.argv[1], encoding='utf-8') as f:
 
 usage() {
   cat <<'USAGE'
-Usage: scripts/screenshot.sh [model] [output] [--gif]
+Usage: scripts/screenshot.sh [model] [output] [--gif | --bench]
 
 Starts a Pebble emulator, installs the watchface, waits for app startup, and
 writes a screenshot or GIF under screenshots/<model>.
 
+With --bench, builds the profiler (ENABLE_DEBUG_SCREEN) instead, runs the face
+for BENCH_MINUTES at each corner update cycle choice, and prints a per-platform
+table of redraws and wakes per hour, max frame ms, startup ms and heap
+high-water. Exits non-zero when a metric regresses past its threshold against
+scripts/emulator-bench-baseline.json (see scripts/emulator-bench.py).
+
 Arguments:
   model   Pebble model/platform to run (default: basalt)
           Use "all" to capture every supported model in one run.
   output  Output path (default: screenshots/<model>/app-start.png or .gif)
   --gif   Record a GIF instead of a PNG, starting after app startup delay
+  --bench Run the power/perf benchmark instead of capturing
 
 Environment:
   STARTUP_DELAY_SECONDS  Seconds to wait after install before capture (default: 5)
@@ -56,16 +63,25 @@ Environment:
   SCREENSHOT_LAT_E6      Seed latitude in degrees * 1e6 (default: 37774900)
   SCREENSHOT_LON_E6      Seed longitude in degrees * 1e6 (default: -122419400)
   SCREENSHOT_TZ_MIN      Seed timezone offset minutes (default: -480)
+  BENCH_MINUTES          Measured minutes per cycle setting (default: 5)
+  BENCH_WARMUP_SECONDS   Settling time before measuring (default: 150)
+  BENCH_RESULTS          Results JSON (default: build/emulator-bench/results.json)
+  BENCH_UPDATE_BASELINE  Accept this run as the new baseline (default: 0)
+  BENCH_TOLERANCE_SCALE  Multiply every regression threshold (default: 1.0)
 USAGE
 }
 
 capture_gif=0
+run_bench=0
 positional=()
 for arg in "$@"; do
   case "$arg" in
     --gif)
       capture_gif=1
       ;;
+    --bench)
+      run_bench=1
+      ;;
     -h|--help)
       usage
       exit 0
@@ -97,6 +113,12 @@ seed_emulator_data="${SEED_EMULATOR_DATA:-1}"
 seed_lat_e6="${SCREENSHOT_LAT_E6:-37774900}"
 seed_lon_e6="${SCREENSHOT_LON_E6:--122419400}"
 seed_tz_min="${SCREENSHOT_TZ_MIN:--480}"
+bench_minutes="${BENCH_MINUTES:-5}"
+bench_warmup_seconds="${BENCH_WARMUP_SECONDS:-150}"
+bench_results="${BENCH_RESULTS:-${ROOT_DIR}/build/emulator-bench/results.json}"
+bench_update_baseline="${BENCH_UPDATE_BASELINE:-0}"
+bench_tolerance_scale="${BENCH_TOLERANCE_SCALE:-1.0}"
+bench_logs_pid=""
 bundle="${ROOT_DIR}/build/yes-watch.pbw"
 message_keys_file="${ROOT_DIR}/build/src/message_keys.auto.c"
 compat_dir=""
@@ -111,6 +133,9 @@ default_output_for_model() {
 }
 
 cleanup() {
+  if [ -n "$bench_logs_pid" ]; then
+    kill "$bench_logs_pid" >/dev/null 2>&1 || true
+  fi
   if [ -n "$compat_dir" ] && [ -d "$compat_dir" ]; then
     rm -rf "$compat_dir"
   fi
@@ -239,6 +264,17 @@ seed_watchface_data() {
       "$(message_key MESSAGE_KEY_KEY_MOON_PHASE_E6)=500000"
 }
 
+# Cycle under test, low power off and a full battery so auto low power stays out of the numbers.
+send_bench_settings() {
+  local interval="$1"
+
+  pebble emu-battery --emulator "$model" --percent 100 >/dev/null 2>&1 || true
+  run_with_retries "Bench settings on ${model}" \
+    pebble send-app-message --emulator "$model" --int \
+      "$(message_key MESSAGE_KEY_KEY_UI_UPDATE_INTERVAL_SEC)=${interval}" \
+      "$(message_key MESSAGE_KEY_KEY_LOW_POWER_MODE)=2"
+}
+
 validate_model() {
   local supported
   for supported in "${ALL_MODELS[@]}"; do
@@ -304,6 +340,80 @@ capture_asset() {
   fi
 }
 
+# Each cycle setting reinstalls the face, which restarts it with fresh profiler counters and
+# streams its log from the first frame.
+bench_asset() {
+  local interval log_dir log
+
+  validate_model
+  prepare_emulator
+  log_dir="$(dirname "$bench_results")/logs"
+  mkdir -p "$log_dir"
+
+  echo "Starting ${model} emulator and installing watchface..."
+  install_watchface
+
+  for interval in $(python3 "${ROOT_DIR}/scripts/emulator-bench.py" intervals); do
+    log="${log_dir}/${model}-${interval}s.log"
+    echo "Benchmarking ${model} at a ${interval}s corner cycle (${bench_minutes} min, log ${log})..."
+    pebble install "$bundle" --emulator "$model" --logs >"$log" 2>&1 &
+    bench_logs_pid=$!
+    sleep "$startup_delay_seconds"
+
+    if [ "$seed_emulator_data" != "0" ]; then
+      seed_watchface_data
+    fi
+    send_bench_settings "$interval"
+
+    sleep $((bench_warmup_seconds + bench_minutes * 60 + 30))
+    kill "$bench_logs_pid" >/dev/null 2>&1 || true
+    wait "$bench_logs_pid" 2>/dev/null || true
+    bench_logs_pid=""
+
+    python3 "${ROOT_DIR}/scripts/emulator-bench.py" record \
+      --platform "$model" --interval "$interval" --log "$log" --results "$bench_results" \
+      --skip $((bench_warmup_seconds / 60)) || return 1
+  done
+
+  if [ "$kill_emulator_on_exit" != "0" ]; then
+    pebble kill >/dev/null 2>&1 || true
+    sleep 1
+  fi
+}
+
+run_model() {
+  if [ "$run_bench" = "1" ]; then
+    bench_asset
+  else
+    capture_asset "$1"
+  fi
+}
+
+build_bundle() {
+  echo "Building ${bundle}..."
+  if [ "$run_bench" = "1" ]; then
+    # Profiler on, with its APP_LOG summary every minute instead of every ten.
+    (cd "$ROOT_DIR" && YES_APP_DEFINES="ENABLE_DEBUG_SCREEN=1 PROF_LOG_EVERY_MIN=1" pebble build)
+    rm -f "$bench_results"
+    mkdir -p "$(dirname "$bench_results")"
+  else
+    (cd "$ROOT_DIR" && pebble build)
+  fi
+}
+
+bench_report() {
+  local report_args=(report --results "$bench_results" --tolerance-scale "$bench_tolerance_scale")
+  if [ "$bench_update_baseline" != "0" ]; then
+    report_args+=(--update)
+  fi
+  python3 "${ROOT_DIR}/scripts/emulator-bench.py" "${report_args[@]}"
+}
+
+if [ "$capture_gif" = "1" ] && [ "$run_bench" = "1" ]; then
+  echo "--gif and --bench cannot be combined." >&2
+  exit 2
+fi
+
 load_target_platforms
 
 if [ "$model" = "all" ]; then
@@ -312,9 +422,7 @@ if [ "$model" = "all" ]; then
   fi
 
   setup_pebble_emulator_compat
-
-  echo "Building ${bundle}..."
-  (cd "$ROOT_DIR" && pebble build)
+  build_bundle
 
   succeeded_models=()
   failed_models=()
@@ -322,7 +430,7 @@ if [ "$model" = "all" ]; then
   for model in "${ALL_MODELS[@]}"; do
     echo ""
     echo "=== ${model} ==="
-    if capture_asset "$(default_output_for_model "$model")"; then
+    if run_model "$(default_output_for_model "$model")"; then
       succeeded_models+=("$model")
     else
       failed_models+=("$model")
@@ -331,6 +439,15 @@ if [ "$model" = "all" ]; then
   done
 
   echo ""
+  if [ "$run_bench" = "1" ] && [ "${#succeeded_models[@]}" -gt 0 ]; then
+    bench_status=0
+    bench_report || bench_status=$?
+    if [ "${#failed_models[@]}" -gt 0 ]; then
+      echo "Failed benchmarks for: ${failed_models[*]}" >&2
+      exit 1
+    fi
+    exit "$bench_status"
+  fi
   if [ "${#succeeded_models[@]}" -gt 0 ]; then
     if [ "$capture_gif" = "1" ]; then
       echo "Saved GIFs for: ${succeeded_models[*]}"
@@ -348,9 +465,10 @@ else
   fi
 
   setup_pebble_emulator_compat
+  build_bundle
 
-  echo "Building ${bundle}..."
-  (cd "$ROOT_DIR" && pebble build)
-
-  capture_asset "$output"
+  run_model "$output"
+  if [ "$run_bench" = "1" ]; then
+    bench_report
+  fi
 fi
@@ -1,11 +1,17 @@
 #include <pebble.h>
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 #include "message_keys.auto.h"
 #include "yes_types.h"
 #include "yes_astro.h"
+#include "yes_batt.h"
 #include "yes_draw.h"
 #include "yes_i18n.h"
+#include "yes_prof.h"
+#include "yes_sched.h"
+#include "yes_store.h"
+#include "yes_worker.h"
 
 // Pebble/newlib toolchain can omit errno plumbing; libm references __errno for some functions.
 // Provide a minimal stub to satisfy the linker.
@@ -19,10 +25,6 @@ static Layer *s_canvas_layer;
 #ifndef PBL_ROUND
 static Layer *s_corner_layer;
 #endif
-static AppTimer *s_startup_timer;
-#if ENABLE_DEBUG_SCREEN
-static bool s_debug;
-#endif
 
 // --- Watch-side fallback computations ---
 // This is now libm-free (uses Pebble fixed-point trig in yes_astro.c), so we can keep
@@ -31,6 +33,41 @@ static bool s_debug;
 // AppMessage keys are generated by pebble-tool into `message_keys.auto.h` / `message_keys.auto.c`.
 
 // --- Persist keys ---
+// Live state is kept as one versioned record per domain (see yes_store.h). Bump a record's version
+// whenever its layout changes; an outdated record is ignored and refilled from the phone.
+enum {
+  PERSIST_REC_SETTINGS = 200,
+  PERSIST_REC_HOME = YES_WORKER_HOME_KEY, // the worker reads it too
+  PERSIST_REC_EVENTS = 202,
+  PERSIST_REC_ALT = 203,
+  PERSIST_REC_WEATHER_V1 = 204, // retired with ALT v2; deleted on the first start that reads it
+};
+#define REC_SETTINGS_VERSION 1
+#define REC_HOME_VERSION YES_WORKER_HOME_VERSION
+#define REC_EVENTS_VERSION 1
+#define REC_ALT_VERSION 2 // v1 also held a tide snapshot
+
+typedef struct {
+  uint8_t net_on;
+  uint8_t ui_update_interval_sec;
+  uint8_t language;
+  uint8_t low_power_mode;
+} SettingsRecord;
+
+typedef struct {
+  int32_t home_ymd;
+  int32_t moon_ymd;
+  int32_t moon_phase_e6;
+  int16_t sunrise_min;
+  int16_t sunset_min;
+  int16_t moonrise_min;
+  int16_t moonset_min;
+  uint8_t sun_state;  // 0 normal, 1 always day, 2 always night, 3 invalid
+  uint8_t moon_state; // 0 normal, 1 always up, 2 always down, 3 invalid
+  uint8_t have_phase;
+} EventsRecord;
+
+// Older builds kept one key per field; migrate_legacy_keys() reads them once into records.
 enum {
   // HOME (current phone location)
   PERSIST_HOME_LAT_E6 = 100,
@@ -46,11 +83,14 @@ enum {
   PERSIST_HOME_MOONRISE_MIN = 125,
   PERSIST_HOME_MOONSET_MIN = 126,
   PERSIST_HOME_MOON_PHASE_E6 = 127,
+  PERSIST_HOME_MOON_YMD = 128, // day the moon keys belong to (sun fallback may stamp HOME_YMD alone)
+  PERSIST_HOME_ASTRO_DAYS = 129, // multi-day forecast blob, see ASTRO_DAYS_* below
 
   // Debug/behavior flags (sent from phone config)
   PERSIST_USE_INTERNET_FALLBACK = 140,
   PERSIST_UI_UPDATE_INTERVAL_SEC = 141,
   PERSIST_LANGUAGE = 142,
+  PERSIST_LOW_POWER_MODE = 143,
 
   // Tides (US-only NOAA; phone sends data when a nearby station is within 50km)
   PERSIST_TIDE_HAVE = 150,
@@ -59,6 +99,7 @@ enum {
   PERSIST_TIDE_NEXT_IS_HIGH = 153,
   PERSIST_TIDE_LEVEL_X10 = 154,
   PERSIST_TIDE_LEVEL_IS_FT = 155,
+  PERSIST_TIDE_EVENTS = 159, // upcoming highs/lows blob, see TIDE_EVENTS_* below
 
   // Altitude (phone-provided; used as a tide alternative inland / at elevation)
   PERSIST_ALT_VALID = 156,
@@ -75,87 +116,188 @@ enum {
   PERSIST_WEATHER_PRECIP_X10 = 166,
   PERSIST_WEATHER_UV_X10 = 167,
   PERSIST_WEATHER_PRESSURE_HPA_X10 = 168,
+  PERSIST_WEATHER_HOURS = 169, // hourly forecast blob, see WX_HOURS_* below
+};
+
+static const uint32_t s_legacy_keys[] = {
+  PERSIST_HOME_LAT_E6, PERSIST_HOME_LON_E6, PERSIST_HOME_TZ_OFFSET_MIN,
+  PERSIST_HOME_YMD, PERSIST_HOME_SUN_STATE, PERSIST_HOME_SUNRISE_MIN, PERSIST_HOME_SUNSET_MIN,
+  PERSIST_HOME_MOON_STATE, PERSIST_HOME_MOONRISE_MIN, PERSIST_HOME_MOONSET_MIN,
+  PERSIST_HOME_MOON_PHASE_E6, PERSIST_HOME_MOON_YMD,
+  PERSIST_USE_INTERNET_FALLBACK, PERSIST_UI_UPDATE_INTERVAL_SEC, PERSIST_LANGUAGE, PERSIST_LOW_POWER_MODE,
+  PERSIST_TIDE_HAVE, PERSIST_TIDE_LAST_UNIX, PERSIST_TIDE_NEXT_UNIX, PERSIST_TIDE_NEXT_IS_HIGH,
+  PERSIST_TIDE_LEVEL_X10, PERSIST_TIDE_LEVEL_IS_FT,
+  PERSIST_ALT_VALID, PERSIST_ALT_M, PERSIST_ALT_IS_FT,
+  PERSIST_WEATHER_TEMP_C10, PERSIST_WEATHER_CODE, PERSIST_WEATHER_IS_DAY, PERSIST_WEATHER_IS_F,
+  PERSIST_WEATHER_WIND_SPD_X10, PERSIST_WEATHER_WIND_DIR_DEG, PERSIST_WEATHER_PRECIP_X10,
+  PERSIST_WEATHER_UV_X10, PERSIST_WEATHER_PRESSURE_HPA_X10,
 };
 
 static GeoLoc s_home;
-static bool s_use_internet_fallback;
-static int s_ui_update_interval_sec = 5;
 static int s_language = YES_LANG_EN;
 
+// Low-power setting from the phone; AUTO follows the battery alert (see apply_low_power).
+typedef enum {
+  LOW_POWER_AUTO = 0,
+  LOW_POWER_ON = 1,
+  LOW_POWER_OFF = 2,
+} LowPowerMode;
+static int s_low_power_mode = LOW_POWER_AUTO;
+
 static SunTimes s_sun_home;
 
 static MoonTimes s_moon_home;
-static int32_t s_moon_phase_e6;
-static bool s_have_moon_phase;
-
-static bool s_have_tide;
-static int32_t s_tide_last_unix;
-static int32_t s_tide_next_unix;
-static bool s_tide_next_is_high;
-static int16_t s_tide_level_x10;
-static bool s_tide_level_is_ft;
 
-#ifndef PBL_ROUND
-static bool s_alt_valid;
-static int32_t s_alt_m;
-static bool s_alt_is_ft;
-#else
-// Avoid unused on round builds where corners are skipped.
-static bool s_alt_valid;
-static int32_t s_alt_m;
-static bool s_alt_is_ft;
-#endif
+// Cost split learned by the worker (samples 0 until it has enough), and what the face did since it
+// last reported to the worker.
+static YesBattFit s_batt_fit;
+static YesBattActivity s_activity;
+static uint32_t s_activity_sched_base;
+
+// Everything the draw code renders from (tide, altitude, weather, phase, battery, flags).
+// Updated in place and handed to yes_draw_* by const pointer.
+static YesFaceState s_state = {
+  .loc = &s_home,
+  .sun = &s_sun_home,
+  .moon = &s_moon_home,
+  .batt_fit = &s_batt_fit,
+  .battery_percent = 100,
+  .ui_update_interval_sec = 5,
+};
 
 // Battery alert logic: estimate time-to-empty from recent discharge rate.
-static int s_batt_last_percent = -1;
-static time_t s_batt_last_time = 0;
-static int32_t s_batt_rate_milli_per_hour = 0; // %/hour * 1000
-static bool s_batt_have_rate = false;
-static bool s_battery_alert = false;
-static uint8_t s_battery_percent = 100;
-
-static AppTimer *s_corner_timer;
+static YesBattModel s_batt;
 
 #ifndef PBL_ROUND
-// UI alternation timer: wake on configured cadence boundaries (rect watches only).
-static AppTimer *s_ui_timer;
+// UI alternation job: wake on configured cadence boundaries (rect watches only).
 static void schedule_ui_timer(void);
 #endif
 
-static bool s_have_weather;
-static int16_t s_weather_temp_c10;
-static uint8_t s_weather_code;
-static bool s_weather_is_day;
-static bool s_weather_is_f;
-static int16_t s_weather_wind_spd_x10;
-static int16_t s_weather_wind_dir_deg;
-static int16_t s_weather_precip_x10;
-static int16_t s_weather_uv_x10;
-static int16_t s_weather_pressure_hpa_x10;
-
 static int s_last_calc_year = -1;
 static int s_last_calc_month = -1;
 static int s_last_calc_day = -1;
 
 // Cached daily event stamp (yyyymmdd)
 static int s_home_ymd = 0;
+// Moon events are stamped separately: the sun fallback can advance s_home_ymd on its own.
+static int s_moon_ymd = 0;
+// UTC offset the cached events were taken under; a change (travel, DST) invalidates them.
+static int32_t s_events_tz_offset_min;
 
-// Fallback computation timer state
-static AppTimer *s_fallback_calc_timer;
+// Fallback computation state (slices run as YES_JOB_FALLBACK)
 typedef enum {
   CALC_PHASE_NONE = 0,
   CALC_PHASE_HOME_SUN,
+  CALC_PHASE_HOME_MOON_ANCHORS,
+  CALC_PHASE_HOME_MOON_SCAN,
 } CalcPhase;
 static CalcPhase s_calc_phase = CALC_PHASE_NONE;
-
-// Note: we no longer calculate sunrise/moonrise on-watch (too expensive on emulator/slow paths).
-// Phone-side JS computes and sends event times; the watch only renders.
+static MoonCalc s_moon_calc;
+static int s_moon_calc_ymd;
+
+// Multi-day astro forecast from the phone (KEY_HOME_ASTRO_DAYS), kept verbatim as one persist blob.
+// Little-endian. Header: u8 version, u8 count, i32 lat_e6, i32 lon_e6.
+// Entry: u32 yyyymmdd, i8 tz/15min, u8 sun_state | moon_state << 2,
+//        u16 sunrise, sunset, moonrise, moonset (local minutes), u16 phase (0..65535 at local noon).
+#define ASTRO_DAYS_VERSION 1
+#define ASTRO_DAYS_HEADER 10
+#define ASTRO_DAYS_ENTRY 16
+#define ASTRO_DAYS_MAX 14
+#define ASTRO_DAYS_LOC_TOL_E6 100000 // ~0.1 deg; sun/moon times move < 1 min
+static uint8_t s_astro_days[ASTRO_DAYS_HEADER + ASTRO_DAYS_MAX * ASTRO_DAYS_ENTRY];
+static int s_astro_days_len;
+
+// Hourly weather forecast from the phone (KEY_WEATHER_HOURS), kept verbatim as one persist blob.
+// Header: u8 version, u8 count, u8 flags (bit 0 imperial units), u8 0, u32 unix of entry 0's hour.
+// Entry (one hour): i8 temp (0.5 C), u8 WMO code | is_day << 7, u8 wind speed (km/h or mph),
+//                   u8 wind dir (360/256 deg), u8 precip x10 (mm or in), u8 UV x10, u8 hPa - 880.
+// Zero wind/precip/UV/pressure means missing, which hides that corner item as before.
+#define WX_HOURS_VERSION 1
+#define WX_HOURS_HEADER 8
+#define WX_HOURS_ENTRY 7
+#define WX_HOURS_MAX 24
+#define WX_PRESSURE_BASE_HPA 880
+static uint8_t s_wx_hours[WX_HOURS_HEADER + WX_HOURS_MAX * WX_HOURS_ENTRY];
+static int s_wx_hours_len;
+
+// Upcoming tide highs and lows (KEY_TIDE_EVENTS), also one persist blob. A count of 0 means no
+// station nearby. Header: u8 version, u8 count, u8 flags (bit 0 levels in ft), u8 0.
+// Entry: u32 unix, i16 level x10, u8 is_high, u8 0. Sorted by time, starting with the last past one.
+#define TIDE_EVENTS_VERSION 1
+#define TIDE_EVENTS_HEADER 4
+#define TIDE_EVENTS_ENTRY 8
+#define TIDE_EVENTS_MAX 8
+static uint8_t s_tide_events[TIDE_EVENTS_HEADER + TIDE_EVENTS_MAX * TIDE_EVENTS_ENTRY];
+static int s_tide_events_len;
+
+// Phone-side JS normally computes and sends event times. When the phone is away the watch
+// fills in: sun inline (analytic), moon across several timer slices (see yes_astro.h).
 
 static int normalize_ui_update_interval_sec(int sec) {
   if (sec == 10 || sec == 30 || sec == 60) return sec;
   return 5;
 }
 
+static int normalize_low_power_mode(int mode) {
+  return (mode == LOW_POWER_ON || mode == LOW_POWER_OFF) ? mode : LOW_POWER_AUTO;
+}
+
+// Low power pins the rect corners to their first item, which leaves the minute tick as the only
+// periodic wake, and lets the cached dial go longer between moon phase redraws.
+// Tells the phone whether low power is in effect, so it spaces out tide and weather fetches. The
+// flag stays pending until an outbox message carrying the current value is acknowledged; a busy
+// outbox, a failed send or a disconnect is retried from the minute tick, the failed handler and
+// Bluetooth reconnect. request_location carries the flag as well.
+#define LOW_POWER_MSG_RETRY_MS 30000
+static bool s_low_power_msg_pending;
+static int8_t s_low_power_msg_inflight = -1; // value in the outbox, -1 when none
+
+static void write_low_power_active(DictionaryIterator *out) {
+  dict_write_uint8(out, MESSAGE_KEY_KEY_LOW_POWER_ACTIVE, s_state.low_power ? 1 : 0);
+  s_low_power_msg_inflight = s_state.low_power ? 1 : 0;
+}
+
+static void send_low_power_active(void) {
+  if (!s_low_power_msg_pending || s_low_power_msg_inflight >= 0) return;
+  DictionaryIterator *out;
+  if (app_message_outbox_begin(&out) != APP_MSG_OK) return;
+  write_low_power_active(out);
+  dict_write_end(out);
+  app_message_outbox_send();
+}
+
+static void outbox_sent(DictionaryIterator *iter, void *context) {
+  (void)iter; (void)context;
+  if (s_low_power_msg_inflight >= 0 && s_low_power_msg_inflight == (s_state.low_power ? 1 : 0)) {
+    s_low_power_msg_pending = false;
+  }
+  s_low_power_msg_inflight = -1;
+  send_low_power_active(); // changed again while the last one was in flight
+}
+
+static void outbox_failed(DictionaryIterator *iter, AppMessageResult reason, void *context) {
+  (void)iter; (void)context;
+  if (s_low_power_msg_inflight < 0) return;
+  s_low_power_msg_inflight = -1;
+  APP_LOG(APP_LOG_LEVEL_WARNING, "low_power send failed: %d", (int)reason);
+  yes_sched_at(YES_JOB_LOW_POWER, LOW_POWER_MSG_RETRY_MS, LOW_POWER_MSG_RETRY_MS, send_low_power_active);
+}
+
+static void apply_low_power(void) {
+  const bool on = (s_low_power_mode == LOW_POWER_ON) ||
+                  (s_low_power_mode == LOW_POWER_AUTO && s_state.battery_alert);
+  if (on == s_state.low_power) return;
+  s_state.low_power = on;
+  APP_LOG(APP_LOG_LEVEL_INFO, "low_power=%d", on ? 1 : 0);
+#ifndef PBL_ROUND
+  if (s_corner_layer) layer_mark_dirty(s_corner_layer);
+  schedule_ui_timer();
+#endif
+  if (s_canvas_layer) layer_mark_dirty(s_canvas_layer);
+  s_low_power_msg_pending = true;
+  send_low_power_active();
+}
+
 static const GeoLoc* active_loc(void) {
   return &s_home;
 }
@@ -205,17 +347,41 @@ static int moon_state_from_struct(const MoonTimes *moon) {
   return 0;
 }
 
-static void persist_save_events_for_home(void) {
-  persist_write_int(PERSIST_HOME_YMD, s_home_ymd);
-  persist_write_int(PERSIST_HOME_SUN_STATE, sun_state_from_struct(&s_sun_home));
-  persist_write_int(PERSIST_HOME_SUNRISE_MIN, s_sun_home.sunrise_min);
-  persist_write_int(PERSIST_HOME_SUNSET_MIN, s_sun_home.sunset_min);
-  persist_write_int(PERSIST_HOME_MOON_STATE, moon_state_from_struct(&s_moon_home));
-  persist_write_int(PERSIST_HOME_MOONRISE_MIN, s_moon_home.moonrise_min);
-  persist_write_int(PERSIST_HOME_MOONSET_MIN, s_moon_home.moonset_min);
-  if (s_have_moon_phase) {
-    persist_write_int(PERSIST_HOME_MOON_PHASE_E6, s_moon_phase_e6);
-  }
+// --- Record packing (yes_store) ---
+static void pack_settings(void *buf) {
+  SettingsRecord *r = buf;
+  r->net_on = s_state.net_on ? 1 : 0;
+  r->ui_update_interval_sec = s_state.ui_update_interval_sec;
+  r->language = (uint8_t)s_language;
+  r->low_power_mode = (uint8_t)s_low_power_mode;
+}
+
+static void pack_home(void *buf) {
+  GeoLoc *r = buf;
+  r->lat_e6 = s_home.lat_e6;
+  r->lon_e6 = s_home.lon_e6;
+  r->tz_offset_min = s_home.tz_offset_min;
+  r->valid = s_home.valid;
+}
+
+// Sun and moon carry separate day stamps: the sun fallback can advance s_home_ymd on its own.
+static void pack_events(void *buf) {
+  EventsRecord *r = buf;
+  r->home_ymd = s_home_ymd;
+  r->moon_ymd = s_moon_ymd;
+  r->moon_phase_e6 = s_state.moon_phase_e6;
+  r->sunrise_min = (int16_t)s_sun_home.sunrise_min;
+  r->sunset_min = (int16_t)s_sun_home.sunset_min;
+  r->moonrise_min = (int16_t)s_moon_home.moonrise_min;
+  r->moonset_min = (int16_t)s_moon_home.moonset_min;
+  r->sun_state = (uint8_t)sun_state_from_struct(&s_sun_home);
+  r->moon_state = (uint8_t)moon_state_from_struct(&s_moon_home);
+  r->have_phase = s_state.have_phase ? 1 : 0;
+}
+
+static void pack_alt(void *buf) {
+  YesAltState *r = buf;
+  *r = s_state.alt;
 }
 
 static bool needs_fallback_for_home(void) {
@@ -226,16 +392,184 @@ static bool needs_fallback_for_home(void) {
   return !s_sun_home.valid;
 }
 
+static bool needs_moon_fallback(void) {
+  if (!s_home.valid) return false;
+  const int ymd = ymd_for_loc_now(&s_home, NULL, NULL, NULL);
+  if (ymd == 0) return false;
+  if (s_moon_ymd != ymd) return true;
+  return !s_moon_home.valid;
+}
+
 static void schedule_fallback_calc_if_needed(void);
 
-static void fallback_calc_cb(void *context) {
-  (void)context;
-  s_fallback_calc_timer = NULL;
+static uint16_t rd_u16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static int32_t rd_i32(const uint8_t *p) {
+  return (int32_t)((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+static bool astro_days_valid(const uint8_t *data, int len) {
+  if (len < ASTRO_DAYS_HEADER || data[0] != ASTRO_DAYS_VERSION) return false;
+  const int count = data[1];
+  return count > 0 && count <= ASTRO_DAYS_MAX && len == ASTRO_DAYS_HEADER + count * ASTRO_DAYS_ENTRY;
+}
+
+// Fill today's sun/moon/phase from the forecast. Only in-memory: the blob itself is the persisted copy.
+static bool apply_astro_days_for_today(void) {
+  if (!s_home.valid || !s_astro_days_len) return false;
+  if (abs(rd_i32(&s_astro_days[2]) - s_home.lat_e6) > ASTRO_DAYS_LOC_TOL_E6 ||
+      abs(rd_i32(&s_astro_days[6]) - s_home.lon_e6) > ASTRO_DAYS_LOC_TOL_E6) {
+    return false;
+  }
+  const int ymd = ymd_for_loc_now(&s_home, NULL, NULL, NULL);
+  const int32_t tz = yes_tz_offset_min(&s_home);
+  if (!ymd) return false;
+  for (int i = 0; i < s_astro_days[1]; i++) {
+    const uint8_t *e = &s_astro_days[ASTRO_DAYS_HEADER + i * ASTRO_DAYS_ENTRY];
+    if (rd_i32(e) != ymd) continue;
+    if ((int8_t)e[4] * 15 != tz) return false; // computed for another UTC offset (travel, DST)
+    set_sun_from_state_and_minutes(&s_sun_home, e[5] & 3, rd_u16(&e[6]), rd_u16(&e[8]));
+    set_moon_from_state_and_minutes(&s_moon_home, (e[5] >> 2) & 3, rd_u16(&e[10]), rd_u16(&e[12]));
+    s_state.moon_phase_e6 = (int32_t)(((int64_t)rd_u16(&e[14]) * 1000000 + 32767) / 65535);
+    s_state.have_phase = true;
+    s_home_ymd = ymd;
+    s_moon_ymd = ymd;
+    s_events_tz_offset_min = tz;
+    return true;
+  }
+  return false;
+}
+
+static bool wx_hours_valid(const uint8_t *data, int len) {
+  if (len < WX_HOURS_HEADER || data[0] != WX_HOURS_VERSION) return false;
+  const int count = data[1];
+  return count > 0 && count <= WX_HOURS_MAX && len == WX_HOURS_HEADER + count * WX_HOURS_ENTRY;
+}
+
+// Show the hour `now` falls in. Past the end of the forecast the corner hides, like the tide
+// corner, rather than show a reading that may be days old.
+static void apply_wx_hour(time_t now) {
+  if (!s_wx_hours_len) return;
+  const int count = s_wx_hours[1];
+  int32_t slot = (int32_t)(now - (time_t)rd_i32(&s_wx_hours[4])) / 3600;
+  if (slot < 0) slot = 0;
+  YesWeatherState *w = &s_state.weather;
+  if (slot >= count) {
+    w->valid = false;
+    return;
+  }
+  const uint8_t *e = &s_wx_hours[WX_HOURS_HEADER + slot * WX_HOURS_ENTRY];
+  w->temp_c10 = (int16_t)((int8_t)e[0] * 5);
+  w->code = e[1] & 0x7f;
+  w->is_day = (e[1] & 0x80) != 0;
+  w->wind_spd_x10 = (int16_t)(e[2] * 10);
+  w->wind_dir_deg = (int16_t)((e[3] * 360 + 128) / 256 % 360);
+  w->precip_x10 = e[4];
+  w->uv_x10 = e[5];
+  w->pressure_hpa_x10 = e[6] ? (int16_t)((WX_PRESSURE_BASE_HPA + e[6]) * 10) : 0;
+  w->is_f = (s_wx_hours[2] & 1) != 0;
+  w->valid = true;
+}
+
+static bool tide_events_valid(const uint8_t *data, int len) {
+  if (len < TIDE_EVENTS_HEADER || data[0] != TIDE_EVENTS_VERSION) return false;
+  const int count = data[1];
+  return count <= TIDE_EVENTS_MAX && len == TIDE_EVENTS_HEADER + count * TIDE_EVENTS_ENTRY;
+}
+
+// Pick the high/low pair around `now` and estimate the level between them with the usual
+// half-cosine curve. Once the list runs out the corner hides rather than show a stale countdown.
+static void apply_tide_events(time_t now) {
+  if (!s_tide_events_len) return;
+  YesTideState *t = &s_state.tide;
+  t->valid = false;
+  t->level_is_ft = (s_tide_events[2] & 1) != 0;
+  for (int i = 0; i + 1 < s_tide_events[1]; i++) {
+    const uint8_t *a = &s_tide_events[TIDE_EVENTS_HEADER + i * TIDE_EVENTS_ENTRY];
+    const uint8_t *b = a + TIDE_EVENTS_ENTRY;
+    const int32_t t0 = rd_i32(a);
+    const int32_t t1 = rd_i32(b);
+    if ((int32_t)now < t0 || (int32_t)now >= t1 || t1 <= t0) continue;
+    const int32_t l0 = (int16_t)rd_u16(&a[4]);
+    const int32_t l1 = (int16_t)rd_u16(&b[4]);
+    const int32_t angle = (int32_t)(((int64_t)((int32_t)now - t0) * (TRIG_MAX_ANGLE / 2)) / (t1 - t0));
+    const int32_t rise = TRIG_MAX_RATIO - cos_lookup(angle); // 0 .. 2 * TRIG_MAX_RATIO
+    t->last_unix = t0;
+    t->next_unix = t1;
+    t->next_is_high = b[6] != 0;
+    t->level_x10 = (int16_t)(l0 + ((l1 - l0) * rise) / (2 * TRIG_MAX_RATIO));
+    t->valid = true;
+    return;
+  }
+}
+
+// The worker's keys hold a version byte and the struct, the same framing as the yes_store records.
+static bool read_worker_record(uint32_t key, uint8_t version, void *buf, int size) {
+  uint8_t rec[1 + YES_WORKER_RECORD_MAX];
+  if (size > (int)sizeof(rec) - 1) return false;
+  const int len = persist_read_data(key, rec, sizeof(rec));
+  if (len != 1 + size || rec[0] != version) return false;
+  memcpy(buf, &rec[1], size);
+  return true;
+}
+
+// Events the worker solved ahead of time: its today/tomorrow pair holds today's entry on either
+// side of midnight.
+static bool apply_worker_events_for_today(void) {
+  if (!s_home.valid) return false;
+  YesWorkerEventDays days;
+  if (!read_worker_record(YES_WORKER_EVENTS_KEY, YES_WORKER_EVENTS_VERSION, &days, sizeof(days))) return false;
+  const int ymd = ymd_for_loc_now(&s_home, NULL, NULL, NULL);
+  const int32_t tz = yes_tz_offset_min(&s_home);
+  const YesWorkerEvents *ev = yes_worker_events_find(&days, ymd, s_home.lat_e6, s_home.lon_e6, tz,
+                                                     ASTRO_DAYS_LOC_TOL_E6);
+  if (!ev) return false;
+  s_sun_home = ev->sun;
+  s_moon_home = ev->moon;
+  s_home_ymd = ymd;
+  s_moon_ymd = ymd;
+  s_events_tz_offset_min = tz;
+  yes_store_mark(YES_STORE_EVENTS);
+  return true;
+}
+
+static bool begin_moon_calc(void) {
+  int y=0,m=0,d=0;
+  s_moon_calc_ymd = ymd_for_loc_now(&s_home, &y, &m, &d);
+  if (!s_moon_calc_ymd) return false;
+  moon_calc_begin(&s_moon_calc, y, m, d, s_home.lat_e6, s_home.lon_e6, yes_tz_offset_min(&s_home));
+  return true;
+}
+
+// Analytic sunrise/sunset is cheap enough to run inline (on wake, day rollover, tz change).
+// Returns false when the timer-sliced solver is still needed (polar edges, work in flight).
+static bool fallback_calc_fast(void) {
+  if (s_calc_phase != CALC_PHASE_NONE || yes_sched_pending(YES_JOB_FALLBACK)) return false;
+  if (!needs_fallback_for_home()) return false;
+  int y=0,m=0,d=0;
+  const int ymd = ymd_for_loc_now(&s_home, &y, &m, &d);
+  if (!ymd) return false;
+  SunTimes sun;
+  if (!calc_sunrise_sunset_fast(y, m, d, s_home.lat_e6, s_home.lon_e6, yes_tz_offset_min(&s_home), &sun)) {
+    return false;
+  }
+  s_home_ymd = ymd;
+  s_sun_home = sun;
+  yes_store_mark(YES_STORE_EVENTS);
+  if (s_canvas_layer) layer_mark_dirty(s_canvas_layer);
+  return true;
+}
+
+static void fallback_calc_slice(void) {
 
   // Determine next needed phase if we're not already mid-run.
   if (s_calc_phase == CALC_PHASE_NONE) {
     if (needs_fallback_for_home()) {
       s_calc_phase = CALC_PHASE_HOME_SUN;
+    } else if (needs_moon_fallback() && begin_moon_calc()) {
+      s_calc_phase = CALC_PHASE_HOME_MOON_ANCHORS;
     } else {
       return;
     }
@@ -245,53 +579,102 @@ static void fallback_calc_cb(void *context) {
     int y=0,m=0,d=0;
     s_home_ymd = ymd_for_loc_now(&s_home, &y, &m, &d);
     if (s_home_ymd) {
-      const double lat = (double)s_home.lat_e6 / 1e6;
-      const double lon = (double)s_home.lon_e6 / 1e6;
-      s_sun_home = calc_sunrise_sunset_local(y, m, d, lat, lon, yes_tz_offset_min(&s_home));
-    }
-    // Persist only if we already have moon from cache/phone; otherwise keep previous moon values.
-    if (s_home_ymd && s_moon_home.valid) {
-      persist_save_events_for_home();
-    } else if (s_home_ymd) {
-      // Still stamp the day so we don't recompute sun repeatedly; moon will remain stale until phone updates.
-      persist_write_int(PERSIST_HOME_YMD, s_home_ymd);
-      persist_write_int(PERSIST_HOME_SUN_STATE, sun_state_from_struct(&s_sun_home));
-      persist_write_int(PERSIST_HOME_SUNRISE_MIN, s_sun_home.sunrise_min);
-      persist_write_int(PERSIST_HOME_SUNSET_MIN, s_sun_home.sunset_min);
+      s_sun_home = calc_sunrise_sunset_e6(y, m, d, s_home.lat_e6, s_home.lon_e6, yes_tz_offset_min(&s_home));
     }
+    yes_store_mark(YES_STORE_EVENTS);
     s_calc_phase = CALC_PHASE_NONE;
+    if (s_canvas_layer) layer_mark_dirty(s_canvas_layer);
+  } else if (s_calc_phase == CALC_PHASE_HOME_MOON_ANCHORS || s_calc_phase == CALC_PHASE_HOME_MOON_SCAN) {
+    // One slice per callback; nothing is drawn until the day is complete.
+    const bool done = moon_calc_step(&s_moon_calc);
+    if (moon_calc_anchors_done(&s_moon_calc)) s_calc_phase = CALC_PHASE_HOME_MOON_SCAN;
+    if (done) {
+      s_calc_phase = CALC_PHASE_NONE;
+      // Phone may have delivered events (or the day rolled) while we were slicing.
+      if (needs_moon_fallback() && ymd_for_loc_now(&s_home, NULL, NULL, NULL) == s_moon_calc_ymd) {
+        s_moon_home = moon_calc_result(&s_moon_calc);
+        s_moon_ymd = s_moon_calc_ymd;
+        yes_store_mark(YES_STORE_EVENTS);
+        if (s_canvas_layer) layer_mark_dirty(s_canvas_layer);
+      }
+    }
   }
 
-  if (s_canvas_layer) layer_mark_dirty(s_canvas_layer);
-
   // Continue next phase (slice via timer to avoid blocking)
   schedule_fallback_calc_if_needed();
 }
 
+static void fallback_calc_cb(void) {
+  YES_PROF_BEGIN(t0);
+  fallback_calc_slice();
+  YES_PROF_END(YES_PROF_FALLBACK, t0);
+}
+
 static void schedule_fallback_calc_if_needed(void) {
-  if (s_fallback_calc_timer) return;
-  // If there is work queued or needed, run soon.
-  if (s_calc_phase != CALC_PHASE_NONE || needs_fallback_for_home()) {
-    s_fallback_calc_timer = app_timer_register(100, fallback_calc_cb, NULL);
+  // A forecast pushed earlier covers most days without any on-watch math.
+  if ((needs_fallback_for_home() || needs_moon_fallback()) &&
+      (apply_astro_days_for_today() || apply_worker_events_for_today())) {
+    if (s_canvas_layer) layer_mark_dirty(s_canvas_layer);
   }
+  fallback_calc_fast();
+  if (yes_sched_pending(YES_JOB_FALLBACK)) return;
+  // If there is work queued or needed, run soon. Slices are not urgent; let them share wakes.
+  if (s_calc_phase != CALC_PHASE_NONE || needs_fallback_for_home() || needs_moon_fallback()) {
+    yes_sched_at(YES_JOB_FALLBACK, 100, 400, fallback_calc_cb);
+  }
+}
+
+static void wr_u16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void wr_i32(uint8_t *p, int32_t v) {
+  wr_u16(p, (uint16_t)v);
+  wr_u16(p + 2, (uint16_t)((uint32_t)v >> 16));
+}
+
+// KEY_BATT_MODEL for the config page, little-endian: u8 version, u8 samples, u16 capacity mAh,
+// i32 base (1e-6 %/h), i32 per redraw, per wake, per message (1e-6 %), u16 redraws, wakes and
+// messages per hour. Rides along with each location request.
+#define BATT_MODEL_VERSION 1
+#define BATT_MODEL_LEN 26
+
+static void pack_batt_model(uint8_t *p) {
+  p[0] = BATT_MODEL_VERSION;
+  p[1] = s_batt_fit.samples;
+  wr_u16(&p[2], YES_BATT_CAPACITY_MAH);
+  wr_i32(&p[4], s_batt_fit.base_uph);
+  wr_i32(&p[8], s_batt_fit.redraw_u);
+  wr_i32(&p[12], s_batt_fit.wake_u);
+  wr_i32(&p[16], s_batt_fit.msg_u);
+  wr_u16(&p[20], s_batt_fit.redraws_ph);
+  wr_u16(&p[22], s_batt_fit.wakes_ph);
+  wr_u16(&p[24], s_batt_fit.msgs_ph);
 }
 
 static void request_location(void) {
   DictionaryIterator *out;
   if (app_message_outbox_begin(&out) != APP_MSG_OK) return;
   dict_write_uint8(out, MESSAGE_KEY_KEY_REQUEST_LOC, 1);
+  write_low_power_active(out);
+  if (s_batt_fit.samples) {
+    uint8_t model[BATT_MODEL_LEN];
+    pack_batt_model(model);
+    dict_write_data(out, MESSAGE_KEY_KEY_BATT_MODEL, model, sizeof(model));
+  }
   dict_write_end(out);
   app_message_outbox_send();
 }
 
-static void startup_timer_cb(void *context) {
-  (void)context;
-  s_startup_timer = NULL;
+static void startup_location_cb(void) {
   request_location();
 }
 
 static void inbox_received(DictionaryIterator *iter, void *context) {
   (void)context;
+  YES_PROF_BEGIN(t0);
+  s_activity.msgs++;
   Tuple *t_lat = dict_find(iter, MESSAGE_KEY_KEY_LAT_E6);
   Tuple *t_lon = dict_find(iter, MESSAGE_KEY_KEY_LON_E6);
   Tuple *t_tz  = dict_find(iter, MESSAGE_KEY_KEY_TZ_OFFSET_MIN);
@@ -303,60 +686,46 @@ static void inbox_received(DictionaryIterator *iter, void *context) {
   Tuple *t_home_moonrise = dict_find(iter, MESSAGE_KEY_KEY_HOME_MOONRISE_MIN);
   Tuple *t_home_moonset = dict_find(iter, MESSAGE_KEY_KEY_HOME_MOONSET_MIN);
   Tuple *t_moon_phase = dict_find(iter, MESSAGE_KEY_KEY_MOON_PHASE_E6);
-  Tuple *t_tide_have = dict_find(iter, MESSAGE_KEY_KEY_TIDE_HAVE);
-  Tuple *t_tide_last = dict_find(iter, MESSAGE_KEY_KEY_TIDE_LAST_UNIX);
-  Tuple *t_tide_next = dict_find(iter, MESSAGE_KEY_KEY_TIDE_NEXT_UNIX);
-  Tuple *t_tide_next_is_high = dict_find(iter, MESSAGE_KEY_KEY_TIDE_NEXT_IS_HIGH);
-  Tuple *t_tide_level = dict_find(iter, MESSAGE_KEY_KEY_TIDE_LEVEL_X10);
-  Tuple *t_tide_level_is_ft = dict_find(iter, MESSAGE_KEY_KEY_TIDE_LEVEL_IS_FT);
+  Tuple *t_astro_days = dict_find(iter, MESSAGE_KEY_KEY_HOME_ASTRO_DAYS);
+  Tuple *t_tide_events = dict_find(iter, MESSAGE_KEY_KEY_TIDE_EVENTS);
   Tuple *t_alt_valid = dict_find(iter, MESSAGE_KEY_KEY_ALT_VALID);
   Tuple *t_alt_m = dict_find(iter, MESSAGE_KEY_KEY_ALT_M);
   Tuple *t_alt_is_ft = dict_find(iter, MESSAGE_KEY_KEY_ALT_IS_FT);
-  Tuple *t_w_temp = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_TEMP_C10);
-  Tuple *t_w_code = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_CODE);
-  Tuple *t_w_day  = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_IS_DAY);
-  Tuple *t_w_f    = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_IS_F);
-  Tuple *t_w_wind_spd = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_WIND_SPD_X10);
-  Tuple *t_w_wind_dir = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_WIND_DIR_DEG);
-  Tuple *t_w_precip = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_PRECIP_X10);
-  Tuple *t_w_uv = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_UV_X10);
-  Tuple *t_w_p = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_PRESSURE_HPA_X10);
+  Tuple *t_wx_hours = dict_find(iter, MESSAGE_KEY_KEY_WEATHER_HOURS);
   Tuple *t_use_internet = dict_find(iter, MESSAGE_KEY_KEY_USE_INTERNET_FALLBACK);
   Tuple *t_ui_update_interval = dict_find(iter, MESSAGE_KEY_KEY_UI_UPDATE_INTERVAL_SEC);
   Tuple *t_language = dict_find(iter, MESSAGE_KEY_KEY_LANGUAGE);
+  Tuple *t_low_power = dict_find(iter, MESSAGE_KEY_KEY_LOW_POWER_MODE);
 
+  const uint32_t state_hash = yes_face_state_hash(&s_state, YES_STATE_ALL);
   bool changed = false;
   if (t_lat && t_lon) {
     s_home.lat_e6 = (int32_t)t_lat->value->int32;
     s_home.lon_e6 = (int32_t)t_lon->value->int32;
     s_home.valid = true;
-    persist_write_int(PERSIST_HOME_LAT_E6, s_home.lat_e6);
-    persist_write_int(PERSIST_HOME_LON_E6, s_home.lon_e6);
+    yes_store_mark(YES_STORE_HOME);
     changed = true;
   }
   if (t_tz) {
     s_home.tz_offset_min = (int32_t)t_tz->value->int32;
-    persist_write_int(PERSIST_HOME_TZ_OFFSET_MIN, s_home.tz_offset_min);
+    yes_store_mark(YES_STORE_HOME);
     changed = true;
   }
   (void)t_ts;
 
   if (t_use_internet) {
-    s_use_internet_fallback = (t_use_internet->value->uint8 != 0);
-    persist_write_int(PERSIST_USE_INTERNET_FALLBACK, s_use_internet_fallback ? 1 : 0);
+    s_state.net_on = (t_use_internet->value->uint8 != 0);
+    yes_store_mark(YES_STORE_SETTINGS);
     changed = true;
   }
   if (t_ui_update_interval) {
     const int next_interval = normalize_ui_update_interval_sec((int)t_ui_update_interval->value->int32);
-    if (s_ui_update_interval_sec != next_interval) {
-      s_ui_update_interval_sec = next_interval;
-      persist_write_int(PERSIST_UI_UPDATE_INTERVAL_SEC, s_ui_update_interval_sec);
+    if (s_state.ui_update_interval_sec != next_interval) {
+      s_state.ui_update_interval_sec = (uint8_t)next_interval;
+      yes_store_mark(YES_STORE_SETTINGS);
       changed = true;
 #ifndef PBL_ROUND
-      if (s_ui_timer) {
-        app_timer_cancel(s_ui_timer);
-        s_ui_timer = NULL;
-      }
+      yes_sched_cancel(YES_JOB_UI);
 #endif
     }
   }
@@ -365,7 +734,16 @@ static void inbox_received(DictionaryIterator *iter, void *context) {
     if (s_language != next_language) {
       s_language = next_language;
       yes_i18n_set_language(s_language);
-      persist_write_int(PERSIST_LANGUAGE, s_language);
+      yes_store_mark(YES_STORE_SETTINGS);
+      changed = true;
+    }
+  }
+  if (t_low_power) {
+    const int next_mode = normalize_low_power_mode((int)t_low_power->value->int32);
+    if (s_low_power_mode != next_mode) {
+      s_low_power_mode = next_mode;
+      yes_store_mark(YES_STORE_SETTINGS);
+      apply_low_power();
       changed = true;
     }
   }
@@ -387,116 +765,53 @@ static void inbox_received(DictionaryIterator *iter, void *context) {
   }
 
   if (t_moon_phase) {
-    s_moon_phase_e6 = (int32_t)t_moon_phase->value->int32;
-    if (s_moon_phase_e6 < 0) s_moon_phase_e6 = 0;
-    if (s_moon_phase_e6 > 1000000) s_moon_phase_e6 = 1000000;
-    s_have_moon_phase = true;
-    persist_write_int(PERSIST_HOME_MOON_PHASE_E6, s_moon_phase_e6);
+    s_state.moon_phase_e6 = (int32_t)t_moon_phase->value->int32;
+    if (s_state.moon_phase_e6 < 0) s_state.moon_phase_e6 = 0;
+    if (s_state.moon_phase_e6 > 1000000) s_state.moon_phase_e6 = 1000000;
+    s_state.have_phase = true;
+    yes_store_mark(YES_STORE_EVENTS);
     changed = true;
   }
 
-  if (t_tide_have) {
-    s_have_tide = (t_tide_have->value->uint8 != 0);
-    persist_write_int(PERSIST_TIDE_HAVE, s_have_tide ? 1 : 0);
-    changed = true;
-  }
-  if (t_tide_last) {
-    s_tide_last_unix = (int32_t)t_tide_last->value->int32;
-    if (s_tide_last_unix < 0) s_tide_last_unix = 0;
-    persist_write_int(PERSIST_TIDE_LAST_UNIX, s_tide_last_unix);
-    changed = true;
+  if (t_astro_days && t_astro_days->type == TUPLE_BYTE_ARRAY &&
+      astro_days_valid(t_astro_days->value->data, t_astro_days->length)) {
+    s_astro_days_len = t_astro_days->length;
+    memcpy(s_astro_days, t_astro_days->value->data, s_astro_days_len);
+    yes_store_mark(YES_STORE_ASTRO_DAYS);
+    if (apply_astro_days_for_today()) changed = true;
   }
-  if (t_tide_next) {
-    s_tide_next_unix = (int32_t)t_tide_next->value->int32;
-    if (s_tide_next_unix < 0) s_tide_next_unix = 0;
-    persist_write_int(PERSIST_TIDE_NEXT_UNIX, s_tide_next_unix);
-    changed = true;
-  }
-  if (t_tide_next_is_high) {
-    s_tide_next_is_high = (t_tide_next_is_high->value->uint8 != 0);
-    persist_write_int(PERSIST_TIDE_NEXT_IS_HIGH, s_tide_next_is_high ? 1 : 0);
-    changed = true;
-  }
-  if (t_tide_level) {
-    s_tide_level_x10 = (int16_t)t_tide_level->value->int32;
-    persist_write_int(PERSIST_TIDE_LEVEL_X10, s_tide_level_x10);
-    changed = true;
-  }
-  if (t_tide_level_is_ft) {
-    s_tide_level_is_ft = (t_tide_level_is_ft->value->uint8 != 0);
-    persist_write_int(PERSIST_TIDE_LEVEL_IS_FT, s_tide_level_is_ft ? 1 : 0);
+
+  if (t_tide_events && t_tide_events->type == TUPLE_BYTE_ARRAY &&
+      tide_events_valid(t_tide_events->value->data, t_tide_events->length)) {
+    s_tide_events_len = t_tide_events->length;
+    memcpy(s_tide_events, t_tide_events->value->data, s_tide_events_len);
+    yes_store_mark(YES_STORE_TIDE_EVENTS);
+    apply_tide_events(time(NULL));
     changed = true;
   }
 
   if (t_alt_valid) {
-    s_alt_valid = (t_alt_valid->value->uint8 != 0);
-    persist_write_int(PERSIST_ALT_VALID, s_alt_valid ? 1 : 0);
+    s_state.alt.valid = (t_alt_valid->value->uint8 != 0);
+    yes_store_mark(YES_STORE_ALT);
     changed = true;
   }
   if (t_alt_m) {
-    s_alt_m = (int32_t)t_alt_m->value->int32;
-    persist_write_int(PERSIST_ALT_M, (int)s_alt_m);
+    s_state.alt.m = (int32_t)t_alt_m->value->int32;
+    yes_store_mark(YES_STORE_ALT);
     changed = true;
   }
   if (t_alt_is_ft) {
-    s_alt_is_ft = (t_alt_is_ft->value->uint8 != 0);
-    persist_write_int(PERSIST_ALT_IS_FT, s_alt_is_ft ? 1 : 0);
+    s_state.alt.is_ft = (t_alt_is_ft->value->uint8 != 0);
+    yes_store_mark(YES_STORE_ALT);
     changed = true;
   }
 
-  if (t_w_temp) {
-    s_weather_temp_c10 = (int16_t)t_w_temp->value->int32;
-    persist_write_int(PERSIST_WEATHER_TEMP_C10, s_weather_temp_c10);
-    s_have_weather = true;
-    changed = true;
-  }
-  if (t_w_code) {
-    s_weather_code = (uint8_t)t_w_code->value->uint8;
-    persist_write_int(PERSIST_WEATHER_CODE, (int)s_weather_code);
-    s_have_weather = true;
-    changed = true;
-  }
-  if (t_w_day) {
-    s_weather_is_day = (t_w_day->value->uint8 != 0);
-    persist_write_int(PERSIST_WEATHER_IS_DAY, s_weather_is_day ? 1 : 0);
-    s_have_weather = true;
-    changed = true;
-  }
-  if (t_w_f) {
-    s_weather_is_f = (t_w_f->value->uint8 != 0);
-    persist_write_int(PERSIST_WEATHER_IS_F, s_weather_is_f ? 1 : 0);
-    s_have_weather = true;
-    changed = true;
-  }
-
-  if (t_w_wind_spd) {
-    s_weather_wind_spd_x10 = (int16_t)t_w_wind_spd->value->int32;
-    persist_write_int(PERSIST_WEATHER_WIND_SPD_X10, s_weather_wind_spd_x10);
-    s_have_weather = true;
-    changed = true;
-  }
-  if (t_w_wind_dir) {
-    s_weather_wind_dir_deg = (int16_t)t_w_wind_dir->value->int32;
-    persist_write_int(PERSIST_WEATHER_WIND_DIR_DEG, s_weather_wind_dir_deg);
-    s_have_weather = true;
-    changed = true;
-  }
-  if (t_w_precip) {
-    s_weather_precip_x10 = (int16_t)t_w_precip->value->int32;
-    persist_write_int(PERSIST_WEATHER_PRECIP_X10, s_weather_precip_x10);
-    s_have_weather = true;
-    changed = true;
-  }
-  if (t_w_uv) {
-    s_weather_uv_x10 = (int16_t)t_w_uv->value->int32;
-    persist_write_int(PERSIST_WEATHER_UV_X10, s_weather_uv_x10);
-    s_have_weather = true;
-    changed = true;
-  }
-  if (t_w_p) {
-    s_weather_pressure_hpa_x10 = (int16_t)t_w_p->value->int32;
-    persist_write_int(PERSIST_WEATHER_PRESSURE_HPA_X10, s_weather_pressure_hpa_x10);
-    s_have_weather = true;
+  if (t_wx_hours && t_wx_hours->type == TUPLE_BYTE_ARRAY &&
+      wx_hours_valid(t_wx_hours->value->data, t_wx_hours->length)) {
+    s_wx_hours_len = t_wx_hours->length;
+    memcpy(s_wx_hours, t_wx_hours->value->data, s_wx_hours_len);
+    yes_store_mark(YES_STORE_WX_HOURS);
+    apply_wx_hour(time(NULL));
     changed = true;
   }
 
@@ -505,16 +820,21 @@ static void inbox_received(DictionaryIterator *iter, void *context) {
     // Stamp and persist events when phone provides them.
     if (s_home.valid && (t_home_sun_state || t_home_moon_state)) {
       s_home_ymd = ymd_for_loc_now(&s_home, NULL, NULL, NULL);
-      persist_save_events_for_home();
-    }
-    if (s_canvas_layer) {
-      layer_mark_dirty(s_canvas_layer);
+      if (t_home_moon_state) s_moon_ymd = s_home_ymd;
+      s_events_tz_offset_min = yes_tz_offset_min(&s_home);
+      yes_store_mark(YES_STORE_EVENTS);
     }
+    // Phones resend unchanged values on every refresh; only repaint when something rendered moved.
+    if (yes_face_state_hash(&s_state, YES_STATE_ALL) != state_hash) {
+      if (s_canvas_layer) {
+        layer_mark_dirty(s_canvas_layer);
+      }
 #ifndef PBL_ROUND
-    if (s_corner_layer) {
-      layer_mark_dirty(s_corner_layer);
-    }
+      if (s_corner_layer) {
+        layer_mark_dirty(s_corner_layer);
+      }
 #endif
+    }
     // Kick the UI alternation timer for corner widgets (tide/weather).
 #ifndef PBL_ROUND
     schedule_ui_timer();
@@ -524,148 +844,148 @@ static void inbox_received(DictionaryIterator *iter, void *context) {
   }
 
   APP_LOG(APP_LOG_LEVEL_INFO, "inbox_received changed=%d", changed ? 1 : 0);
+  YES_PROF_END(YES_PROF_INBOX, t0);
 }
 
 #ifndef PBL_ROUND
 static void schedule_ui_timer(void);
 
-static bool ui_timer_needed(void) {
-  // Run a redraw timer when any corner widget needs configured-cadence alternation.
-  // - weather corner cycles when weather is present
-  // - tide corner cycles when tide is present
-  // - top-left alternates steps/battery when battery_alert is true
-  // - bottom-right fallback cycles between sun/moon/phase (when tide absent)
-  if (s_have_weather) return true;
-  if (s_have_tide) return true;
-  if (s_battery_alert) return true;
-  if (s_alt_valid) return true;
-  if (s_home.valid && (s_sun_home.valid || s_moon_home.valid || s_have_moon_phase)) return true;
-  return false;
+// The corner overlay sits on top of the dial, so any mark re-renders the whole face.
+// Only mark it when a slot would actually show something different.
+static void mark_corners_dirty_if_changed(void) {
+  if (!s_corner_layer) return;
+  if (yes_draw_corners(s_corner_layer, NULL, &s_state)) layer_mark_dirty(s_corner_layer);
 }
 
-static void ui_timer_cb(void *context) {
-  (void)context;
-  s_ui_timer = NULL;
-  if (ui_timer_needed() && s_corner_layer) {
-    layer_mark_dirty(s_corner_layer);
-  }
+static void ui_timer_cb(void) {
+  mark_corners_dirty_if_changed();
   schedule_ui_timer();
 }
 
+// Wake only for the next moment a corner's content actually changes. Slots with a single item and
+// no countdown report nothing, and minute-boundary changes ride on the tick's full redraw.
+// Recomputed on every call, since new data can move the next change earlier or drop it.
 static void schedule_ui_timer(void) {
-  if (s_ui_timer) return;
-  if (!ui_timer_needed()) return;
-  const int interval = normalize_ui_update_interval_sec(s_ui_update_interval_sec);
-  const time_t now = time(NULL);
-  const int sec = (int)(now % interval);
-  const uint32_t ms = (uint32_t)((sec == 0 ? interval : (interval - sec)) * 1000);
-  s_ui_timer = app_timer_register(ms, ui_timer_cb, NULL);
+  yes_sched_cancel(YES_JOB_UI);
+  if (!s_corner_layer) return;
+  time_t now = 0;
+  uint16_t now_ms = 0;
+  time_ms(&now, &now_ms);
+  time_t at = yes_draw_corners_next_change(s_corner_layer, &s_state, now);
+  while (at && at % 60 == 0 && at < now + 60) {
+    at = yes_draw_corners_next_change(s_corner_layer, &s_state, at);
+  }
+  // Nothing before the next tick: the tick re-arms from there.
+  if (!at || at % 60 == 0 || at - now >= 60) return;
+  // Land just past the boundary so time() already reports the new content.
+  yes_sched_at(YES_JOB_UI, (uint32_t)(at - now) * 1000 - now_ms + 20, 250, ui_timer_cb);
 }
 #endif
 
 static bool battery_should_alert(void) {
   BatteryChargeState st = battery_state_service_peek();
-  s_battery_percent = st.charge_percent;
-
-  // If charging / plugged, no recharge warning.
-  if (st.is_plugged) {
-    s_batt_have_rate = false;
-    return false;
-  }
-
-  const time_t now = time(NULL);
-  if (s_batt_last_percent >= 0 && s_batt_last_time > 0 && now > s_batt_last_time) {
-    const int dp = s_batt_last_percent - (int)st.charge_percent;
-    const int32_t dt = (int32_t)(now - s_batt_last_time);
-    if (dp > 0 && dt >= 60) {
-      // milli(%/hour) = dp * 3600 / dt * 1000 = dp * 3600000 / dt
-      const int32_t new_rate = (int32_t)((int64_t)dp * 3600000LL / (int64_t)dt);
-      if (new_rate > 0) {
-        if (!s_batt_have_rate) {
-          s_batt_rate_milli_per_hour = new_rate;
-          s_batt_have_rate = true;
-        } else {
-          // Smooth a bit (EMA-ish)
-          s_batt_rate_milli_per_hour = (s_batt_rate_milli_per_hour * 3 + new_rate) / 4;
-        }
-      }
-    }
-  }
-
-  s_batt_last_percent = (int)st.charge_percent;
-  s_batt_last_time = now;
-
-  // Always alert when very low.
-  if (st.charge_percent <= 10) return true;
-
-  if (s_batt_have_rate && s_batt_rate_milli_per_hour > 0) {
-    // hours_left ~= percent / (rate %/h)
-    const int32_t hours_left_x1000 = (int32_t)((int32_t)st.charge_percent * 1000 / s_batt_rate_milli_per_hour);
-    return hours_left_x1000 <= 8000;
-  }
-
-  // Fallback heuristic if rate is unknown.
-  return st.charge_percent <= 25;
+  s_state.battery_percent = st.charge_percent;
+  // A running worker owns the model; its updates arrive through worker_message_handler.
+  if (!app_worker_is_running()) yes_batt_sample(&s_batt, st, time(NULL));
+  return yes_batt_should_alert(&s_batt, st);
 }
 
 #ifndef PBL_ROUND
-static void schedule_corner_timer(uint32_t ms);
-
-static void corner_timer_cb(void *context) {
-  (void)context;
-  s_corner_timer = NULL;
-
-  const bool alert = battery_should_alert();
-  const bool changed = (alert != s_battery_alert);
-  s_battery_alert = alert;
-
-  if (changed || alert) {
-    if (s_corner_layer) layer_mark_dirty(s_corner_layer);
-  }
-
-  schedule_corner_timer(alert ? (uint32_t)normalize_ui_update_interval_sec(s_ui_update_interval_sec) * 1000 : 60000);
-}
-
-static void schedule_corner_timer(uint32_t ms) {
-  if (s_corner_timer) {
-    app_timer_cancel(s_corner_timer);
-    s_corner_timer = NULL;
-  }
-  s_corner_timer = app_timer_register(ms, corner_timer_cb, NULL);
+// Battery state is re-read on the minute tick; the steps/battery alternation itself runs on the
+// UI cadence (an alert makes the top-left slot rotate).
+static void battery_job_cb(void) {
+  s_state.battery_alert = battery_should_alert();
+  apply_low_power();
+  // A new alert needs the cadence job that was not running before.
+  schedule_ui_timer();
+  mark_corners_dirty_if_changed();
 }
 
 static void battery_handler(BatteryChargeState state) {
   (void)state;
-  const bool alert = battery_should_alert();
-  const bool changed = (alert != s_battery_alert);
-  s_battery_alert = alert;
-  if (changed && s_corner_layer) layer_mark_dirty(s_corner_layer);
+  battery_job_cb();
   // Re-evaluate quickly after changes.
-  schedule_corner_timer(alert ? (uint32_t)normalize_ui_update_interval_sec(s_ui_update_interval_sec) * 1000 : 1000);
+  yes_sched_at(YES_JOB_BATTERY, 1000, 1000, battery_job_cb);
 }
 #endif // !PBL_ROUND
 
+// Hand the activity tally to the worker, which files it against the current battery level.
+static void report_activity(void) {
+  const uint32_t sched = yes_sched_wake_count();
+  s_activity.wakes += sched - s_activity_sched_base;
+  s_activity_sched_base = sched;
+  if (app_worker_is_running()) {
+    AppWorkerMessage msg = {
+      .data0 = (uint16_t)(s_activity.redraws > 0xffff ? 0xffff : s_activity.redraws),
+      .data1 = (uint16_t)(s_activity.wakes > 0xffff ? 0xffff : s_activity.wakes),
+      .data2 = (uint16_t)(s_activity.msgs > 0xffff ? 0xffff : s_activity.msgs),
+    };
+    app_worker_send_message(YES_WORKER_MSG_ACTIVITY, &msg);
+  }
+  s_activity = (YesBattActivity){ 0 };
+}
+
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
   (void)units_changed;
   (void)tick_time;
+  // Anything already due rides on this wake instead of taking its own.
+  yes_sched_run_due();
+  yes_prof_tick();
+  s_activity.wakes++;
+  if (tick_time && tick_time->tm_min % 10 == 0) report_activity();
+  // The whole face repaints below, which also refreshes the corners.
+  s_state.battery_alert = battery_should_alert();
+  apply_low_power();
+  send_low_power_active();
+  // Step the forecasts along before the corners read them (no phone round-trip needed).
+  const time_t now = time(NULL);
+  apply_wx_hour(now);
+  apply_tide_events(now);
+#ifndef PBL_ROUND
+  // Cadence jobs stop short of each minute boundary; arm the next one from here.
+  schedule_ui_timer();
+#endif
   // If the local day rolled over and the phone isn't around to refresh events,
   // compute daily sun/moon events on-watch.
   if (tick_time && tick_time->tm_min == 0) {
     schedule_fallback_calc_if_needed();
   }
+  const int32_t tz = yes_tz_offset_min(&s_home);
+  if (tz != s_events_tz_offset_min) {
+    s_events_tz_offset_min = tz;
+    if (s_home.valid) {
+      s_home_ymd = 0;
+      s_moon_ymd = 0;
+      schedule_fallback_calc_if_needed();
+    }
+  }
   if (s_canvas_layer) {
     layer_mark_dirty(s_canvas_layer);
   }
 }
 
 #if ENABLE_DEBUG_SCREEN
+// Off -> info page -> perf page -> battery page -> off.
 static void debug_toggle(void) {
-  s_debug = !s_debug;
+  if (!s_state.debug) {
+    s_state.debug = true;
+    s_state.debug_perf = false;
+    s_state.debug_batt = false;
+  } else if (!s_state.debug_perf && !s_state.debug_batt) {
+    s_state.debug_perf = true;
+  } else if (s_state.debug_perf) {
+    s_state.debug_perf = false;
+    s_state.debug_batt = true;
+  } else {
+    s_state.debug = false;
+    s_state.debug_batt = false;
+  }
   if (s_canvas_layer) {
     layer_mark_dirty(s_canvas_layer);
   }
 #ifndef PBL_ROUND
   if (s_corner_layer) layer_mark_dirty(s_corner_layer);
+  schedule_ui_timer();
 #endif
 }
 
@@ -692,89 +1012,35 @@ static void click_config_provider(void *context) {
                              NULL);
 }
 
+// Startup is staged so frame 0 only waits for what it renders: prv_init restores the records and
+// pushes the window, and the first face draw arms the rest (startup_services_cb).
+typedef enum {
+  STARTUP_FIRST_FRAME = 0,
+  STARTUP_SERVICES,
+  STARTUP_DONE,
+} StartupStage;
+static StartupStage s_startup_stage;
+static void startup_services_cb(void);
+
 static void canvas_update_proc(Layer *layer, GContext *ctx) {
-  const bool have_loc = s_home.valid;
-  const bool have_sun = s_sun_home.valid;
-  const bool have_moon = s_moon_home.valid;
-  yes_draw_face(layer, ctx,
-#if ENABLE_DEBUG_SCREEN
-                s_debug,
-#else
-                false,
-#endif
-                s_use_internet_fallback,
-                have_loc,
-                have_sun,
-                have_moon,
-                s_have_tide,
-                s_tide_last_unix,
-                s_tide_next_unix,
-                s_tide_next_is_high,
-                s_tide_level_x10,
-                s_tide_level_is_ft,
-                s_alt_valid,
-                s_alt_m,
-                s_alt_is_ft,
-                s_battery_alert,
-                s_battery_percent,
-                s_have_weather,
-                s_weather_temp_c10,
-                s_weather_code,
-                s_weather_is_day,
-                s_weather_is_f,
-                s_weather_wind_spd_x10,
-                s_weather_wind_dir_deg,
-                s_weather_precip_x10,
-                s_weather_uv_x10,
-                s_weather_pressure_hpa_x10,
-                s_have_moon_phase,
-                s_moon_phase_e6,
-                active_loc(),
-                active_sun(),
-                active_moon());
+  YES_PROF_BEGIN(t0);
+  yes_draw_face(layer, ctx, &s_state);
+  YES_PROF_END(YES_PROF_FACE, t0);
+  yes_prof_startup_frame(yes_draw_face_ready(&s_state));
+  if (s_startup_stage == STARTUP_FIRST_FRAME) {
+    s_startup_stage = STARTUP_SERVICES;
+    yes_sched_at(YES_JOB_STARTUP, 0, 50, startup_services_cb);
+  }
+  yes_prof_count_redraw();
+  yes_prof_sample_heap();
+  s_activity.redraws++;
 }
 
 #ifndef PBL_ROUND
 static void corner_update_proc(Layer *layer, GContext *ctx) {
-  const bool have_loc = s_home.valid;
-  const bool have_sun = s_sun_home.valid;
-  const bool have_moon = s_moon_home.valid;
-  yes_draw_corners(layer, ctx,
-#if ENABLE_DEBUG_SCREEN
-                   s_debug,
-#else
-                   false,
-#endif
-                   have_loc,
-                   have_sun,
-                   have_moon,
-                   s_have_tide,
-                   s_tide_last_unix,
-                   s_tide_next_unix,
-                   s_tide_next_is_high,
-                   s_tide_level_x10,
-                   s_tide_level_is_ft,
-                   s_alt_valid,
-                   s_alt_m,
-                   s_alt_is_ft,
-                   s_battery_alert,
-                   s_battery_percent,
-                   s_have_weather,
-                   s_weather_temp_c10,
-                   s_weather_code,
-                   s_weather_is_day,
-                   s_weather_is_f,
-                   s_weather_wind_spd_x10,
-                   s_weather_wind_dir_deg,
-                   s_weather_precip_x10,
-                   s_weather_uv_x10,
-                   s_weather_pressure_hpa_x10,
-                   s_have_moon_phase,
-                   s_moon_phase_e6,
-                   s_ui_update_interval_sec,
-                   active_loc(),
-                   active_sun(),
-                   active_moon());
+  YES_PROF_BEGIN(t0);
+  yes_draw_corners(layer, ctx, &s_state);
+  YES_PROF_END(YES_PROF_CORNERS, t0);
 }
 #endif
 
@@ -794,11 +1060,6 @@ static void prv_window_load(Window *window) {
   yes_draw_init();
 
   APP_LOG(APP_LOG_LEVEL_INFO, "window_load");
-
-  // Defer initial request until after the event loop is fully running.
-  if (!s_startup_timer) {
-    s_startup_timer = app_timer_register(500, startup_timer_cb, NULL);
-  }
 }
 
 static void prv_window_unload(Window *window) {
@@ -818,96 +1079,48 @@ static void accel_tap_handler(AccelAxisType axis, int32_t direction) {
 }
 #endif
 
-#ifndef PBL_ROUND
 static void bt_handler(bool connected) {
-  (void)connected;
-  if (s_corner_layer) layer_mark_dirty(s_corner_layer);
-}
+  if (connected) send_low_power_active();
+#ifndef PBL_ROUND
+  mark_corners_dirty_if_changed();
+  schedule_ui_timer();
 #endif
+}
 
-static void prv_init(void) {
-  APP_LOG(APP_LOG_LEVEL_INFO, "init");
+static bool have_legacy_keys(void) {
+  for (size_t i = 0; i < sizeof(s_legacy_keys) / sizeof(s_legacy_keys[0]); i++) {
+    if (persist_exists(s_legacy_keys[i])) return true;
+  }
+  return false;
+}
+
+// Pre-record builds stored one key per field. Read them once (the old startup path), rewrite the
+// state as records and drop the old keys.
+static void migrate_legacy_keys(void) {
   // HOME (current phone location)
   s_home.valid = persist_exists(PERSIST_HOME_LAT_E6) && persist_exists(PERSIST_HOME_LON_E6);
   if (s_home.valid) {
     s_home.lat_e6 = persist_read_int(PERSIST_HOME_LAT_E6);
     s_home.lon_e6 = persist_read_int(PERSIST_HOME_LON_E6);
     s_home.tz_offset_min = persist_exists(PERSIST_HOME_TZ_OFFSET_MIN) ? persist_read_int(PERSIST_HOME_TZ_OFFSET_MIN) : 0;
-  } else {
-    s_home.lat_e6 = 0;
-    s_home.lon_e6 = 0;
-    s_home.tz_offset_min = 0;
   }
 
   // Settings from phone config (optional)
-  s_use_internet_fallback = persist_exists(PERSIST_USE_INTERNET_FALLBACK) ? (persist_read_int(PERSIST_USE_INTERNET_FALLBACK) != 0) : false;
-  s_ui_update_interval_sec = persist_exists(PERSIST_UI_UPDATE_INTERVAL_SEC)
+  s_state.net_on = persist_exists(PERSIST_USE_INTERNET_FALLBACK) ? (persist_read_int(PERSIST_USE_INTERNET_FALLBACK) != 0) : false;
+  s_state.ui_update_interval_sec = (uint8_t)(persist_exists(PERSIST_UI_UPDATE_INTERVAL_SEC)
     ? normalize_ui_update_interval_sec(persist_read_int(PERSIST_UI_UPDATE_INTERVAL_SEC))
-    : 5;
+    : 5);
   s_language = persist_exists(PERSIST_LANGUAGE)
     ? yes_i18n_normalize_language(persist_read_int(PERSIST_LANGUAGE))
     : YES_LANG_EN;
-  yes_i18n_set_language(s_language);
-  s_last_calc_year = s_last_calc_month = s_last_calc_day = -1;
-  clear_events();
-  s_have_moon_phase = false;
-  s_moon_phase_e6 = 0;
-  s_have_tide = persist_exists(PERSIST_TIDE_HAVE) ? (persist_read_int(PERSIST_TIDE_HAVE) != 0) : false;
-  s_tide_last_unix = persist_exists(PERSIST_TIDE_LAST_UNIX) ? persist_read_int(PERSIST_TIDE_LAST_UNIX) : 0;
-  s_tide_next_unix = persist_exists(PERSIST_TIDE_NEXT_UNIX) ? persist_read_int(PERSIST_TIDE_NEXT_UNIX) : 0;
-  s_tide_next_is_high = persist_exists(PERSIST_TIDE_NEXT_IS_HIGH) ? (persist_read_int(PERSIST_TIDE_NEXT_IS_HIGH) != 0) : false;
-  s_tide_level_x10 = persist_exists(PERSIST_TIDE_LEVEL_X10) ? (int16_t)persist_read_int(PERSIST_TIDE_LEVEL_X10) : 0;
-  s_tide_level_is_ft = persist_exists(PERSIST_TIDE_LEVEL_IS_FT) ? (persist_read_int(PERSIST_TIDE_LEVEL_IS_FT) != 0) : false;
-#ifndef PBL_ROUND
-  s_ui_timer = NULL;
-  schedule_ui_timer();
-#endif
-
-  s_alt_valid = persist_exists(PERSIST_ALT_VALID) ? (persist_read_int(PERSIST_ALT_VALID) != 0) : false;
-  s_alt_m = persist_exists(PERSIST_ALT_M) ? (int32_t)persist_read_int(PERSIST_ALT_M) : 0;
-  s_alt_is_ft = persist_exists(PERSIST_ALT_IS_FT) ? (persist_read_int(PERSIST_ALT_IS_FT) != 0) : false;
-
-  // Battery corner behavior
-  s_batt_last_percent = -1;
-  s_batt_last_time = 0;
-  s_batt_rate_milli_per_hour = 0;
-  s_batt_have_rate = false;
-  s_battery_percent = battery_state_service_peek().charge_percent;
-  s_battery_alert = battery_should_alert();
-  // On round watches we don't render corner complications; avoid extra timers/redraws.
-#ifndef PBL_ROUND
-  battery_state_service_subscribe(battery_handler);
-  schedule_corner_timer(s_battery_alert ? (uint32_t)normalize_ui_update_interval_sec(s_ui_update_interval_sec) * 1000 : 60000);
-  bluetooth_connection_service_subscribe(bt_handler);
-#endif
-
-  s_have_weather = false;
-  s_weather_temp_c10 = 0;
-  s_weather_code = 0;
-  s_weather_is_day = false;
-  s_weather_is_f = false;
-  s_weather_wind_spd_x10 = 0;
-  s_weather_wind_dir_deg = 0;
-  s_weather_precip_x10 = 0;
-  s_weather_uv_x10 = 0;
-  s_weather_pressure_hpa_x10 = 0;
-  if (persist_exists(PERSIST_WEATHER_TEMP_C10) && persist_exists(PERSIST_WEATHER_CODE)) {
-    s_weather_temp_c10 = (int16_t)persist_read_int(PERSIST_WEATHER_TEMP_C10);
-    s_weather_code = (uint8_t)persist_read_int(PERSIST_WEATHER_CODE);
-    s_weather_is_day = persist_exists(PERSIST_WEATHER_IS_DAY) ? (persist_read_int(PERSIST_WEATHER_IS_DAY) != 0) : false;
-    s_weather_is_f = persist_exists(PERSIST_WEATHER_IS_F) ? (persist_read_int(PERSIST_WEATHER_IS_F) != 0) : false;
-    s_weather_wind_spd_x10 = persist_exists(PERSIST_WEATHER_WIND_SPD_X10) ? (int16_t)persist_read_int(PERSIST_WEATHER_WIND_SPD_X10) : 0;
-    s_weather_wind_dir_deg = persist_exists(PERSIST_WEATHER_WIND_DIR_DEG) ? (int16_t)persist_read_int(PERSIST_WEATHER_WIND_DIR_DEG) : 0;
-    s_weather_precip_x10 = persist_exists(PERSIST_WEATHER_PRECIP_X10) ? (int16_t)persist_read_int(PERSIST_WEATHER_PRECIP_X10) : 0;
-    s_weather_uv_x10 = persist_exists(PERSIST_WEATHER_UV_X10) ? (int16_t)persist_read_int(PERSIST_WEATHER_UV_X10) : 0;
-    s_weather_pressure_hpa_x10 = persist_exists(PERSIST_WEATHER_PRESSURE_HPA_X10) ? (int16_t)persist_read_int(PERSIST_WEATHER_PRESSURE_HPA_X10) : 0;
-    s_have_weather = true;
-  }
-
-#ifndef PBL_ROUND
-  // If we boot with cached tide/weather, ensure the UI timer starts.
-  schedule_ui_timer();
-#endif
+  s_low_power_mode = persist_exists(PERSIST_LOW_POWER_MODE)
+    ? normalize_low_power_mode(persist_read_int(PERSIST_LOW_POWER_MODE))
+    : LOW_POWER_AUTO;
+  // The old tide and weather snapshots are not carried over: they may be days old, and the
+  // phone's next forecast blobs replace them.
+  s_state.alt.valid = persist_exists(PERSIST_ALT_VALID) ? (persist_read_int(PERSIST_ALT_VALID) != 0) : false;
+  s_state.alt.m = persist_exists(PERSIST_ALT_M) ? (int32_t)persist_read_int(PERSIST_ALT_M) : 0;
+  s_state.alt.is_ft = persist_exists(PERSIST_ALT_IS_FT) ? (persist_read_int(PERSIST_ALT_IS_FT) != 0) : false;
 
   // Load cached daily events if available for today (per-location local date)
   if (s_home.valid && persist_exists(PERSIST_HOME_YMD)) {
@@ -917,6 +1130,8 @@ static void prv_init(void) {
         persist_exists(PERSIST_HOME_SUN_STATE) && persist_exists(PERSIST_HOME_SUNRISE_MIN) && persist_exists(PERSIST_HOME_SUNSET_MIN) &&
         persist_exists(PERSIST_HOME_MOON_STATE) && persist_exists(PERSIST_HOME_MOONRISE_MIN) && persist_exists(PERSIST_HOME_MOONSET_MIN)) {
       s_home_ymd = ymd;
+      // Older caches have no moon stamp; recompute once rather than trust possibly stale moon keys.
+      s_moon_ymd = persist_exists(PERSIST_HOME_MOON_YMD) ? persist_read_int(PERSIST_HOME_MOON_YMD) : 0;
       set_sun_from_state_and_minutes(&s_sun_home,
                                      persist_read_int(PERSIST_HOME_SUN_STATE),
                                      persist_read_int(PERSIST_HOME_SUNRISE_MIN),
@@ -929,14 +1144,152 @@ static void prv_init(void) {
   }
 
   if (persist_exists(PERSIST_HOME_MOON_PHASE_E6)) {
-    s_moon_phase_e6 = persist_read_int(PERSIST_HOME_MOON_PHASE_E6);
-    if (s_moon_phase_e6 < 0) s_moon_phase_e6 = 0;
-    if (s_moon_phase_e6 > 1000000) s_moon_phase_e6 = 1000000;
-    s_have_moon_phase = true;
+    s_state.moon_phase_e6 = persist_read_int(PERSIST_HOME_MOON_PHASE_E6);
+    if (s_state.moon_phase_e6 < 0) s_state.moon_phase_e6 = 0;
+    if (s_state.moon_phase_e6 > 1000000) s_state.moon_phase_e6 = 1000000;
+    s_state.have_phase = true;
   }
 
+  for (int i = 0; i < YES_STORE_COUNT; i++) yes_store_mark((YesStoreId)i);
+  yes_store_flush();
+  for (size_t i = 0; i < sizeof(s_legacy_keys) / sizeof(s_legacy_keys[0]); i++) {
+    persist_delete(s_legacy_keys[i]);
+  }
+}
+
+// Startup costs one read per record. A domain whose record is missing or from another version keeps
+// its zero/default state and is rewritten; the others are left as they are.
+static void load_store_records(void) {
+  yes_store_register(YES_STORE_SETTINGS, PERSIST_REC_SETTINGS, REC_SETTINGS_VERSION, sizeof(SettingsRecord), pack_settings);
+  yes_store_register(YES_STORE_HOME, PERSIST_REC_HOME, REC_HOME_VERSION, sizeof(GeoLoc), pack_home);
+  yes_store_register(YES_STORE_EVENTS, PERSIST_REC_EVENTS, REC_EVENTS_VERSION, sizeof(EventsRecord), pack_events);
+  yes_store_register(YES_STORE_ALT, PERSIST_REC_ALT, REC_ALT_VERSION, sizeof(YesAltState), pack_alt);
+  yes_store_register_blob(YES_STORE_ASTRO_DAYS, PERSIST_HOME_ASTRO_DAYS, s_astro_days, &s_astro_days_len);
+  yes_store_register_blob(YES_STORE_TIDE_EVENTS, PERSIST_TIDE_EVENTS, s_tide_events, &s_tide_events_len);
+  yes_store_register_blob(YES_STORE_WX_HOURS, PERSIST_WEATHER_HOURS, s_wx_hours, &s_wx_hours_len);
+
+  // Settings are written on the first start on records, so legacy keys are only looked for then.
+  SettingsRecord set;
+  if (!yes_store_read(YES_STORE_SETTINGS, &set)) {
+    if (have_legacy_keys()) {
+      migrate_legacy_keys();
+      return;
+    }
+    yes_store_mark(YES_STORE_SETTINGS);
+  } else {
+    s_state.net_on = set.net_on != 0;
+    s_state.ui_update_interval_sec = (uint8_t)normalize_ui_update_interval_sec(set.ui_update_interval_sec);
+    s_language = yes_i18n_normalize_language(set.language);
+    s_low_power_mode = normalize_low_power_mode(set.low_power_mode);
+  }
+
+  GeoLoc home;
+  if (yes_store_read(YES_STORE_HOME, &home)) s_home = home;
+  else yes_store_mark(YES_STORE_HOME);
+
+  YesAltState alt;
+  if (yes_store_read(YES_STORE_ALT, &alt)) {
+    s_state.alt = alt;
+  } else {
+    yes_store_mark(YES_STORE_ALT);
+    if (persist_exists(PERSIST_REC_WEATHER_V1)) persist_delete(PERSIST_REC_WEATHER_V1);
+  }
+
+  // Today's events only; the phase is kept across days (the phone or forecast refreshes it).
+  EventsRecord ev;
+  if (!yes_store_read(YES_STORE_EVENTS, &ev)) {
+    yes_store_mark(YES_STORE_EVENTS);
+    return;
+  }
+  const int ymd_now = s_home.valid ? ymd_for_loc_now(&s_home, NULL, NULL, NULL) : 0;
+  if (ymd_now != 0 && ev.home_ymd == ymd_now) {
+    s_home_ymd = ev.home_ymd;
+    s_moon_ymd = ev.moon_ymd;
+    set_sun_from_state_and_minutes(&s_sun_home, ev.sun_state, ev.sunrise_min, ev.sunset_min);
+    set_moon_from_state_and_minutes(&s_moon_home, ev.moon_state, ev.moonrise_min, ev.moonset_min);
+  }
+  if (ev.have_phase) {
+    s_state.moon_phase_e6 = ev.moon_phase_e6;
+    if (s_state.moon_phase_e6 < 0) s_state.moon_phase_e6 = 0;
+    if (s_state.moon_phase_e6 > 1000000) s_state.moon_phase_e6 = 1000000;
+    s_state.have_phase = true;
+  }
+}
+
+// The worker wrote one of its keys; pick it up (the face no longer samples the battery itself).
+static void worker_message_handler(uint16_t type, AppWorkerMessage *data) {
+  (void)data;
+  if (type == YES_WORKER_MSG_BATT) {
+    read_worker_record(YES_WORKER_BATT_KEY, YES_WORKER_BATT_VERSION, &s_batt, sizeof(s_batt));
+    read_worker_record(YES_WORKER_FIT_KEY, YES_WORKER_FIT_VERSION, &s_batt_fit, sizeof(s_batt_fit));
+    s_state.battery_alert = battery_should_alert();
+    apply_low_power();
+  } else if (type == YES_WORKER_MSG_EVENTS) {
+    schedule_fallback_calc_if_needed();
+  }
+}
+
+// Everything frame 0 does not need, run once it is on screen.
+static void startup_services_cb(void) {
+  s_startup_stage = STARTUP_DONE;
   app_message_register_inbox_received(inbox_received);
+  app_message_register_outbox_sent(outbox_sent);
+  app_message_register_outbox_failed(outbox_failed);
   app_message_open(256, 256);
+  bluetooth_connection_service_subscribe(bt_handler);
+#ifndef PBL_ROUND
+  battery_state_service_subscribe(battery_handler);
+  yes_draw_refresh_steps();
+  mark_corners_dirty_if_changed();
+  // Cached tide/weather may already need corner wakes.
+  schedule_ui_timer();
+#endif
+  // Sliced moon solver if today's events are still missing (the analytic sun ran in init).
+  schedule_fallback_calc_if_needed();
+  // The worker outlives the face; the system only asks the user when another app's worker runs.
+  app_worker_message_subscribe(worker_message_handler);
+  if (!app_worker_is_running()) app_worker_launch();
+  // The phone may already be sending; ask anyway once the event loop has settled.
+  yes_sched_at(YES_JOB_STARTUP, 500, 500, startup_location_cb);
+}
+
+static void prv_init(void) {
+  yes_prof_startup_begin();
+  APP_LOG(APP_LOG_LEVEL_INFO, "init");
+  s_last_calc_year = s_last_calc_month = s_last_calc_day = -1;
+  clear_events();
+  load_store_records();
+  yes_i18n_set_language(s_language);
+
+  // Battery corner behavior
+  if (!read_worker_record(YES_WORKER_BATT_KEY, YES_WORKER_BATT_VERSION, &s_batt, sizeof(s_batt))) {
+    yes_batt_reset(&s_batt);
+  }
+  read_worker_record(YES_WORKER_FIT_KEY, YES_WORKER_FIT_VERSION, &s_batt_fit, sizeof(s_batt_fit));
+  s_state.battery_percent = battery_state_service_peek().charge_percent;
+  s_state.battery_alert = battery_should_alert();
+  apply_low_power();
+
+  // Forecast blob wins over the single-day keys when it has an entry for today.
+  const int astro_len = yes_store_read_blob(YES_STORE_ASTRO_DAYS, s_astro_days, sizeof(s_astro_days));
+  if (astro_len > 0) {
+    s_astro_days_len = astro_days_valid(s_astro_days, astro_len) ? astro_len : 0;
+    apply_astro_days_for_today();
+  }
+  // Then whatever the worker solved for today.
+  if (needs_fallback_for_home() || needs_moon_fallback()) apply_worker_events_for_today();
+  // Tide and weather are kept only as forecast blobs, so what shows is stepped to the current time.
+  const int wx_len = yes_store_read_blob(YES_STORE_WX_HOURS, s_wx_hours, sizeof(s_wx_hours));
+  if (wx_len > 0 && wx_hours_valid(s_wx_hours, wx_len)) s_wx_hours_len = wx_len;
+  const int tide_len = yes_store_read_blob(YES_STORE_TIDE_EVENTS, s_tide_events, sizeof(s_tide_events));
+  if (tide_len > 0 && tide_events_valid(s_tide_events, tide_len)) s_tide_events_len = tide_len;
+  apply_wx_hour(time(NULL));
+  apply_tide_events(time(NULL));
+
+  s_events_tz_offset_min = yes_tz_offset_min(&s_home);
+  // Analytic sunrise/sunset is cheap; a day rollover since the last run would otherwise put the
+  // loading screen up for frame 0.
+  fallback_calc_fast();
 
   s_window = window_create();
   window_set_click_config_provider(s_window, click_config_provider);
@@ -957,10 +1310,6 @@ static void prv_init(void) {
   accel_tap_service_subscribe(accel_tap_handler);
 #endif
 
-  // Ask phone for location (and it will also send sun/moon event times)
-  // done via startup timer in window_load
-  // Fallback: if phone isn't around, compute daily events on-watch.
-  schedule_fallback_calc_if_needed();
 }
 
 static void prv_deinit(void) {
@@ -968,28 +1317,15 @@ static void prv_deinit(void) {
 #if ENABLE_DEBUG_SCREEN
   accel_tap_service_unsubscribe();
 #endif
-  if (s_fallback_calc_timer) {
-    app_timer_cancel(s_fallback_calc_timer);
-    s_fallback_calc_timer = NULL;
-  }
+  report_activity();
+  // Pending coalesced writes would be lost with the scheduler.
+  yes_store_flush();
+  yes_sched_deinit();
   s_calc_phase = CALC_PHASE_NONE;
-  if (s_startup_timer) {
-    app_timer_cancel(s_startup_timer);
-    s_startup_timer = NULL;
-  }
-  if (s_corner_timer) {
-    app_timer_cancel(s_corner_timer);
-    s_corner_timer = NULL;
-  }
-#ifndef PBL_ROUND
-  if (s_ui_timer) {
-    app_timer_cancel(s_ui_timer);
-    s_ui_timer = NULL;
-  }
-#endif
+  app_worker_message_unsubscribe();
+  bluetooth_connection_service_unsubscribe();
 #ifndef PBL_ROUND
   battery_state_service_unsubscribe();
-  bluetooth_connection_service_unsubscribe();
 #endif
   window_destroy(s_window);
 }
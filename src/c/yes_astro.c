@@ -1,6 +1,7 @@
 #include "yes_astro.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #ifndef MIN
 #define MIN(a,b) ((a) < (b) ? (a) : (b))
@@ -88,10 +89,16 @@ bool get_location_local_tm(const GeoLoc *loc, struct tm *out_tm, int *out_minute
   return yes_local_tm_now(loc, out_tm, out_minutes_since_midnight);
 }
 
-// Compute sin(altitude) of sun at a given minute using NOAA "equation of time" approximation
-// (sin/cos series in gamma). All math is fixed-point using Pebble trig lookup.
-// Returns sin(alt) scaled by TRIG_MAX_RATIO.
-static int32_t sun_sin_alt_scaled(int N, int minute_of_day, int32_t lat_e6, int32_t lon_e6, int32_t tz_offset_min) {
+// Equation of time and declination for one instant. These move by well under a degree per
+// day, so the solvers evaluate them once per event instead of once per sample.
+typedef struct {
+  int32_t eqtime_sec;
+  int32_t decl_trig;
+} SunDayTerms;
+
+// NOAA "equation of time" approximation (sin/cos series in gamma). All math is fixed-point
+// using Pebble trig lookup.
+static SunDayTerms sun_day_terms(int N, int minute_of_day) {
   // gamma = 2*pi/365 * (N-1 + (minute-720)/1440)
   const int64_t a = (int64_t)TRIG_MAX_ANGLE * (int64_t)(N - 1) / 365LL;
   const int64_t b = (int64_t)TRIG_MAX_ANGLE * (int64_t)(minute_of_day - 720) / (365LL * 1440LL);
@@ -104,14 +111,14 @@ static int32_t sun_sin_alt_scaled(int N, int minute_of_day, int32_t lat_e6, int3
   const int32_t sin3 = trig_sin(gamma * 3);
   const int32_t cos3 = trig_cos(gamma * 3);
 
-  // eqtime (seconds) = 13750800 * (0.000075 + 0.001868 cosγ - 0.032077 sinγ - 0.014615 cos2γ - 0.040849 sin2γ)
+  // eqtime (seconds) = 13750.8 * (0.000075 + 0.001868 cosγ - 0.032077 sinγ - 0.014615 cos2γ - 0.040849 sin2γ)
   // We evaluate the bracket term in 1e6 scale, using trig scaled by TRIG_MAX_RATIO.
   int64_t sum_e6 = 75;
   sum_e6 += (int64_t)1868  * cos1 / TRIG_MAX_RATIO;
   sum_e6 += (int64_t)-32077 * sin1 / TRIG_MAX_RATIO;
   sum_e6 += (int64_t)-14615 * cos2 / TRIG_MAX_RATIO;
   sum_e6 += (int64_t)-40849 * sin2 / TRIG_MAX_RATIO;
-  const int32_t eqtime_sec = (int32_t)((int64_t)13750800 * sum_e6 / 1000000LL);
+  const int32_t eqtime_sec = (int32_t)((int64_t)137508 * sum_e6 / 10000000LL);
 
   // decl (rad, 1e6 scale):
   // 0.006918 - 0.399912 cosγ + 0.070257 sinγ - 0.006758 cos2γ + 0.000907 sin2γ - 0.002697 cos3γ + 0.00148 sin3γ
@@ -122,7 +129,14 @@ static int32_t sun_sin_alt_scaled(int N, int minute_of_day, int32_t lat_e6, int3
   decl_e6 += (int64_t)   907 * sin2 / TRIG_MAX_RATIO;
   decl_e6 += (int64_t) -2697 * cos3 / TRIG_MAX_RATIO;
   decl_e6 += (int64_t)  1480 * sin3 / TRIG_MAX_RATIO;
-  const int32_t decl_trig = rad_e6_to_trig((int32_t)decl_e6);
+  return (SunDayTerms){ .eqtime_sec = eqtime_sec, .decl_trig = rad_e6_to_trig((int32_t)decl_e6) };
+}
+
+// Compute sin(altitude) of sun at a given minute. Returns sin(alt) scaled by TRIG_MAX_RATIO.
+static int32_t sun_sin_alt_scaled(int N, int minute_of_day, int32_t lat_e6, int32_t lon_e6, int32_t tz_offset_min) {
+  const SunDayTerms t = sun_day_terms(N, minute_of_day);
+  const int32_t eqtime_sec = t.eqtime_sec;
+  const int32_t decl_trig = t.decl_trig;
 
   // True solar time (seconds):
   // tst_min = minutes + eqtime_min + 4*lon - tz_offset_min
@@ -153,21 +167,118 @@ static int32_t sun_sin_alt_scaled(int N, int minute_of_day, int32_t lat_e6, int3
   return (int32_t)s;
 }
 
-SunTimes calc_sunrise_sunset_local(int year, int month_1_12, int day_1_31,
-                                   double lat_deg, double lon_deg,
-                                   int32_t tz_offset_min) {
-  SunTimes out = (SunTimes){ .valid = true, .always_day = false, .always_night = false, .sunrise_min = 0, .sunset_min = 0 };
+static uint32_t isqrt32(uint32_t n) {
+  uint32_t root = 0;
+  uint32_t bit = 1u << 30;
+  while (bit > n) bit >>= 2;
+  while (bit) {
+    if (n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
 
-  // Convert degrees (double) to e6 integers (avoid lround/libm).
-  const int32_t lat_e6 = (int32_t)(lat_deg * 1000000.0 + (lat_deg >= 0 ? 0.5 : -0.5));
-  const int32_t lon_e6 = (int32_t)(lon_deg * 1000000.0 + (lon_deg >= 0 ? 0.5 : -0.5));
+// acos for x scaled by TRIG_MAX_RATIO, returning a Pebble angle in [0, TRIG_MAX_ANGLE / 2].
+static int32_t trig_acos(int32_t x) {
+  // atan2_lookup takes int16 operands: work in 2^14 scale.
+  int32_t xs = x / 4;
+  if (xs > (1 << 14)) xs = 1 << 14;
+  if (xs < -(1 << 14)) xs = -(1 << 14);
+  const int32_t ys = (int32_t)isqrt32((uint32_t)((1 << 28) - xs * xs));
+  return atan2_lookup((int16_t)ys, (int16_t)xs);
+}
+
+// |cos(H0)| above this (0.96) means an event within ~16 degrees of hour angle of midnight/noon:
+// the day-constant declination is no longer good enough there, so use the scan.
+// The SUN_* knobs can be overridden at build time to measure accuracy against cost
+// (tools/host/sun_sweep.sh); 0 for the edge disables the analytic path.
+#ifndef SUN_COS_H0_EDGE_PCT
+#define SUN_COS_H0_EDGE_PCT 96
+#endif
+#define SUN_COS_H0_EDGE ((int32_t)TRIG_MAX_RATIO * SUN_COS_H0_EDGE_PCT / 100)
+
+// Hour angle of the -0.833 deg crossing for the given terms, or false if it is too close to
+// (or beyond) polar day/night for the analytic solution.
+static bool sun_hour_angle(const SunDayTerms *t, int32_t sin_lat, int32_t cos_lat, int32_t sin_h0,
+                           int32_t *out_ha_trig) {
+  const int32_t sin_dec = trig_sin(t->decl_trig);
+  const int32_t cos_dec = trig_cos(t->decl_trig);
+  const int64_t den = (int64_t)cos_lat * (int64_t)cos_dec / TRIG_MAX_RATIO;
+  if (den < TRIG_MAX_RATIO / 64) return false; // within ~1 degree of a pole
+  const int64_t num = (int64_t)sin_h0 - (int64_t)sin_lat * (int64_t)sin_dec / TRIG_MAX_RATIO;
+  const int64_t cos_h = num * TRIG_MAX_RATIO / den;
+  if (SUN_COS_H0_EDGE_PCT <= 0 || cos_h >= SUN_COS_H0_EDGE || cos_h <= -SUN_COS_H0_EDGE) return false;
+  *out_ha_trig = trig_acos((int32_t)cos_h);
+  return true;
+}
+
+// Local clock second of the event with hour angle ha_trig (negative = morning).
+static int32_t sun_event_local_sec(const SunDayTerms *t, int32_t ha_trig, int32_t lon_e6, int32_t tz_offset_min) {
+  // True solar time is 43200 at local noon: clock = tst - eqtime - 4*lon + tz.
+  const int64_t lon_term_sec = (int64_t)240 * (int64_t)lon_e6 / 1000000LL;
+  const int64_t ha_sec = (int64_t)ha_trig * 86400LL / TRIG_MAX_ANGLE;
+  int64_t sec = 43200 + ha_sec - t->eqtime_sec - lon_term_sec + (int64_t)tz_offset_min * 60;
+  sec %= 86400;
+  if (sec < 0) sec += 86400;
+  return (int32_t)sec;
+}
+
+static int sec_to_minute(int32_t sec) {
+  return (int)(((sec + 30) / 60) % 1440);
+}
+
+bool calc_sunrise_sunset_fast(int year, int month_1_12, int day_1_31,
+                              int32_t lat_e6, int32_t lon_e6,
+                              int32_t tz_offset_min, SunTimes *out) {
   const int N = day_of_year(year, month_1_12, day_1_31);
+  const int32_t lat_trig = deg_e6_to_trig(lat_e6);
+  const int32_t sin_lat = trig_sin(lat_trig);
+  const int32_t cos_lat = trig_cos(lat_trig);
+  const int32_t sin_h0 = trig_sin(deg_e6_to_trig(-833000));
+
+  // First pass with the terms at local noon, then one refinement per event with the terms
+  // re-evaluated at the estimated event time (declination drift over half a day).
+  const SunDayTerms noon = sun_day_terms(N, 720);
+  int32_t ha = 0;
+  if (!sun_hour_angle(&noon, sin_lat, cos_lat, sin_h0, &ha)) return false;
+
+  int minutes[2];
+  for (int i = 0; i < 2; i++) {
+    const int32_t ha_signed = (i == 0) ? -ha : ha;
+    const int est = sec_to_minute(sun_event_local_sec(&noon, ha_signed, lon_e6, tz_offset_min));
+    const SunDayTerms t = sun_day_terms(N, est);
+    int32_t ha_i = 0;
+    if (!sun_hour_angle(&t, sin_lat, cos_lat, sin_h0, &ha_i)) return false;
+    minutes[i] = sec_to_minute(sun_event_local_sec(&t, (i == 0) ? -ha_i : ha_i, lon_e6, tz_offset_min));
+  }
+
+  *out = (SunTimes){ .valid = true, .always_day = false, .always_night = false,
+                     .sunrise_min = minutes[0], .sunset_min = minutes[1] };
+  return true;
+}
+
+// Scan step and bisection halvings for the sampled solver: 10 min halved 10 times is well
+// below the 1-minute output resolution.
+#ifndef SUN_SCAN_STEP_MIN
+#define SUN_SCAN_STEP_MIN 10
+#endif
+#ifndef SUN_BISECT_STEPS
+#define SUN_BISECT_STEPS 10
+#endif
+
+static SunTimes calc_sunrise_sunset_scan(int N, int32_t lat_e6, int32_t lon_e6, int32_t tz_offset_min) {
+  SunTimes out = (SunTimes){ .valid = true, .always_day = false, .always_night = false, .sunrise_min = 0, .sunset_min = 0 };
 
   // Sunrise/sunset convention: sun center at -0.833 degrees altitude (refraction + radius)
   const int32_t h0_trig = deg_e6_to_trig(-833000);
   const int32_t sin_h0 = trig_sin(h0_trig);
 
-  const int step = 10; // minutes
+  const int step = SUN_SCAN_STEP_MIN;
   int rise = -1, set = -1;
   int above_count = 0;
 
@@ -184,7 +295,7 @@ SunTimes calc_sunrise_sunset_local(int year, int month_1_12, int day_1_31,
     if (above != prev_above) {
       int lo = m - step;
       int hi = m;
-      for (int i = 0; i < 10; i++) {
+      for (int i = 0; i < SUN_BISECT_STEPS && hi - lo > 1; i++) {
         const int mid = (lo + hi) / 2;
         const int32_t sm = sun_sin_alt_scaled(N, mid, lat_e6, lon_e6, tz_offset_min);
         const bool ab = (sm > sin_h0);
@@ -214,3 +325,312 @@ SunTimes calc_sunrise_sunset_local(int year, int month_1_12, int day_1_31,
   return out;
 }
 
+SunTimes calc_sunrise_sunset_e6(int year, int month_1_12, int day_1_31,
+                                int32_t lat_e6, int32_t lon_e6,
+                                int32_t tz_offset_min) {
+  SunTimes out = { 0 };
+  if (calc_sunrise_sunset_fast(year, month_1_12, day_1_31, lat_e6, lon_e6, tz_offset_min, &out)) {
+    return out;
+  }
+  return calc_sunrise_sunset_scan(day_of_year(year, month_1_12, day_1_31), lat_e6, lon_e6, tz_offset_min);
+}
+
+#ifndef YES_WORKER
+SunTimes calc_sunrise_sunset_local(int year, int month_1_12, int day_1_31,
+                                   double lat_deg, double lon_deg,
+                                   int32_t tz_offset_min) {
+  // Convert degrees (double) to e6 integers (avoid lround/libm).
+  const int32_t lat_e6 = (int32_t)(lat_deg * 1000000.0 + (lat_deg >= 0 ? 0.5 : -0.5));
+  const int32_t lon_e6 = (int32_t)(lon_deg * 1000000.0 + (lon_deg >= 0 ? 0.5 : -0.5));
+  return calc_sunrise_sunset_e6(year, month_1_12, day_1_31, lat_e6, lon_e6, tz_offset_min);
+}
+#endif
+
+// --- Moon rise/set (watch-side fallback) ---
+//
+// Same model as calcMoonriseMoonsetMinutes in src/pkjs/index.js (Meeus ch. 47 periodic terms,
+// -0.3 deg topocentric horizon), reduced to fixed point. Accuracy budget versus the JS version:
+//   - series truncated to |lon| >= 0.002 deg and |lat| >= 0.001 deg terms:  <= 0.012 deg lon, 0.009 deg lat
+//   - E (eccentricity) factor and T^2.. terms dropped (2000-2050):           < 0.001 deg
+//   - distance only to 1 km, parallax as pi - 0.3 deg geocentric horizon:   < 0.01 deg
+//   - geodetic latitude flattening ignored:                                 < 0.01 deg
+//   - RA/Dec linear between 3-hour anchors:                                 < 0.001 deg
+//   - atan2_lookup / sin_lookup quantisation (2^14 operands):                ~0.005 deg
+// The Moon's altitude changes at most ~0.25 deg/min near the horizon, so the angular error sum
+// (< 0.05 deg) stays within a fraction of a minute. Rise/set times then agree with JS within the
+// 1-minute resolution of both scans. Measured 2024-2030, lat -60..65: 95% identical, 99.98%
+// within 1 min, worst 6 min on grazing rises where the Moon skims the horizon for a while.
+
+#define MOON_J2000_UNIX 946728000 // 2000-01-01 12:00 UTC
+#define MOON_STEP_MIN 10
+#define MOON_SCAN_SLICE_MIN 360
+#define MOON_ANCHORS_PER_SLICE 3
+
+// Mean arguments at J2000 and their rates, in 2^32-per-revolution units (per day).
+typedef struct {
+  uint32_t base;
+  int64_t per_day;
+} MoonArg;
+
+static const MoonArg MOON_LP = { 2604616675u, 157200533 }; // mean longitude
+static const MoonArg MOON_D  = { 3553491206u, 145441302 }; // mean elongation
+static const MoonArg MOON_M  = { 4265488421u,  11758669 }; // Sun's mean anomaly
+static const MoonArg MOON_MP = { 1610176038u, 155871437 }; // Moon's mean anomaly
+static const MoonArg MOON_F  = { 1112779438u, 157832296 }; // argument of latitude
+static const MoonArg GMST    = { 3346025510u, 4306726527LL };
+
+typedef struct {
+  int8_t d, m, mp, f;
+  int32_t lon_e6; // 1e-6 deg
+  int16_t dist_km;
+} MoonTermLR;
+
+typedef struct {
+  int8_t d, m, mp, f;
+  int32_t lat_e6; // 1e-6 deg
+} MoonTermB;
+
+static const MoonTermLR MOON_TERMS_LR[] = {
+  {  0,  0,  1,  0,  6288774, -20905 },
+  {  2,  0, -1,  0,  1274027,  -3699 },
+  {  2,  0,  0,  0,   658314,  -2956 },
+  {  0,  0,  2,  0,   213618,   -570 },
+  {  0,  1,  0,  0,  -185116,     49 },
+  {  0,  0,  0,  2,  -114332,     -3 },
+  {  2,  0, -2,  0,    58793,    246 },
+  {  2, -1, -1,  0,    57066,   -152 },
+  {  2,  0,  1,  0,    53322,   -171 },
+  {  2, -1,  0,  0,    45758,   -205 },
+  {  0,  1, -1,  0,   -40923,   -130 },
+  {  1,  0,  0,  0,   -34720,    109 },
+  {  0,  1,  1,  0,   -30383,    105 },
+  {  2,  0,  0, -2,    15327,     10 },
+  {  0,  0,  1,  2,   -12528,      0 },
+  {  0,  0,  1, -2,    10980,     80 },
+  {  4,  0, -1,  0,    10675,    -35 },
+  {  0,  0,  3,  0,    10034,    -23 },
+  {  4,  0, -2,  0,     8548,    -22 },
+  {  2,  1, -1,  0,    -7888,     24 },
+  {  2,  1,  0,  0,    -6766,     31 },
+  {  1,  0, -1,  0,    -5163,     -8 },
+  {  1,  1,  0,  0,     4987,    -17 },
+  {  2, -1,  1,  0,     4036,    -13 },
+  {  2,  0,  2,  0,     3994,    -10 },
+  {  4,  0,  0,  0,     3861,    -12 },
+  {  2,  0, -3,  0,     3665,     14 },
+  {  0,  1, -2,  0,    -2689,     -7 },
+  {  2,  0, -1,  2,    -2602,      0 },
+  {  2, -1, -2,  0,     2390,     10 },
+  {  1,  0,  1,  0,    -2348,      6 },
+  {  2, -2,  0,  0,     2236,    -10 },
+  {  0,  1,  2,  0,    -2120,      6 },
+  {  0,  2,  0,  0,    -2069,      0 },
+  {  2, -2, -1,  0,     2048,     -5 },
+};
+
+static const MoonTermB MOON_TERMS_B[] = {
+  {  0,  0,  0,  1,  5128122 },
+  {  0,  0,  1,  1,   280602 },
+  {  0,  0,  1, -1,   277693 },
+  {  2,  0,  0, -1,   173237 },
+  {  2,  0, -1,  1,    55413 },
+  {  2,  0, -1, -1,    46271 },
+  {  2,  0,  0,  1,    32573 },
+  {  0,  0,  2,  1,    17198 },
+  {  2,  0,  1, -1,     9266 },
+  {  0,  0,  2, -1,     8822 },
+  {  2, -1,  0, -1,     8216 },
+  {  2,  0, -2, -1,     4324 },
+  {  2,  0,  1,  1,     4200 },
+  {  2,  1,  0, -1,    -3359 },
+  {  2, -1, -1,  1,     2463 },
+  {  2, -1,  0,  1,     2211 },
+  {  2, -1, -1, -1,     2065 },
+  {  0,  1, -1, -1,    -1870 },
+  {  4,  0, -1, -1,     1828 },
+  {  0,  1,  0,  1,    -1794 },
+  {  0,  0,  0,  3,    -1749 },
+  {  0,  1, -1,  1,    -1565 },
+  {  1,  0,  0,  1,    -1491 },
+  {  0,  1,  1,  1,    -1475 },
+  {  0,  1,  1, -1,    -1410 },
+  {  0,  1,  0, -1,    -1344 },
+  {  1,  0,  0, -1,    -1335 },
+  {  0,  0,  3,  1,     1107 },
+  {  4,  0,  0, -1,     1021 },
+};
+
+static uint32_t moon_arg_at(const MoonArg *a, int32_t j2000_min) {
+  return a->base + (uint32_t)(a->per_day * (int64_t)j2000_min / 1440LL);
+}
+
+// 1e-6 deg -> 2^32-per-revolution units
+static int64_t deg_e6_to_u32(int64_t deg_e6) {
+  return deg_e6 * 4294967296LL / 360000000LL;
+}
+
+static int32_t u32_to_trig(uint32_t a) {
+  return (int32_t)(a >> 16);
+}
+
+static int32_t trig_wrap_signed(int32_t a) {
+  a %= TRIG_MAX_ANGLE;
+  if (a > TRIG_MAX_ANGLE / 2) a -= TRIG_MAX_ANGLE;
+  if (a <= -TRIG_MAX_ANGLE / 2) a += TRIG_MAX_ANGLE;
+  return a;
+}
+
+// Geocentric RA/Dec (TRIG angles, dec signed) and distance of the Moon.
+static void moon_ra_dec(int32_t j2000_min, int32_t *out_ra, int32_t *out_dec, int32_t *out_dist_km) {
+  const uint32_t D = moon_arg_at(&MOON_D, j2000_min);
+  const uint32_t M = moon_arg_at(&MOON_M, j2000_min);
+  const uint32_t Mp = moon_arg_at(&MOON_MP, j2000_min);
+  const uint32_t F = moon_arg_at(&MOON_F, j2000_min);
+
+  int64_t sum_l = 0;
+  int64_t sum_r = 0;
+  for (size_t i = 0; i < sizeof(MOON_TERMS_LR) / sizeof(MOON_TERMS_LR[0]); i++) {
+    const MoonTermLR *t = &MOON_TERMS_LR[i];
+    const uint32_t arg = (uint32_t)t->d * D + (uint32_t)t->m * M + (uint32_t)t->mp * Mp + (uint32_t)t->f * F;
+    const int32_t a = u32_to_trig(arg);
+    sum_l += (int64_t)t->lon_e6 * trig_sin(a) / TRIG_MAX_RATIO;
+    if (t->dist_km) sum_r += (int64_t)t->dist_km * trig_cos(a) / TRIG_MAX_RATIO;
+  }
+  int64_t sum_b = 0;
+  for (size_t i = 0; i < sizeof(MOON_TERMS_B) / sizeof(MOON_TERMS_B[0]); i++) {
+    const MoonTermB *t = &MOON_TERMS_B[i];
+    const uint32_t arg = (uint32_t)t->d * D + (uint32_t)t->m * M + (uint32_t)t->mp * Mp + (uint32_t)t->f * F;
+    sum_b += (int64_t)t->lat_e6 * trig_sin(u32_to_trig(arg)) / TRIG_MAX_RATIO;
+  }
+
+  const uint32_t lon = moon_arg_at(&MOON_LP, j2000_min) + (uint32_t)deg_e6_to_u32(sum_l);
+  const int32_t lon_trig = u32_to_trig(lon);
+  const int32_t lat_trig = deg_e6_to_trig((int32_t)sum_b);
+  // Mean obliquity: 23.439291 - 0.0130042 T
+  const int32_t eps_e6 = 23439291 - (int32_t)((int64_t)13004 * j2000_min / (36525LL * 1440LL));
+  const int32_t eps_trig = deg_e6_to_trig(eps_e6);
+
+  const int32_t cb = trig_cos(lat_trig);
+  const int32_t x = (int32_t)((int64_t)trig_cos(lon_trig) * cb / TRIG_MAX_RATIO);
+  const int32_t y = (int32_t)((int64_t)trig_sin(lon_trig) * cb / TRIG_MAX_RATIO);
+  const int32_t z = trig_sin(lat_trig);
+  const int32_t ce = trig_cos(eps_trig);
+  const int32_t se = trig_sin(eps_trig);
+  const int32_t yeq = (int32_t)(((int64_t)y * ce - (int64_t)z * se) / TRIG_MAX_RATIO);
+  const int32_t zeq = (int32_t)(((int64_t)y * se + (int64_t)z * ce) / TRIG_MAX_RATIO);
+  const int32_t rho = (int32_t)isqrt32((uint32_t)((int64_t)x * x + (int64_t)yeq * yeq));
+
+  *out_ra = atan2_lookup((int16_t)(yeq / 4), (int16_t)(x / 4));
+  *out_dec = trig_wrap_signed(atan2_lookup((int16_t)(zeq / 4), (int16_t)(rho / 4)));
+  *out_dist_km = (int32_t)(385001 + sum_r);
+}
+
+static int64_t days_from_civil(int y, int m, int d) {
+  // Howard Hinnant's algorithm; days since 1970-01-01.
+  y -= (m <= 2) ? 1 : 0;
+  const int era = (y >= 0 ? y : y - 399) / 400;
+  const int yoe = y - era * 400;
+  const int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return (int64_t)era * 146097 + doe - 719468;
+}
+
+void moon_calc_begin(MoonCalc *mc, int year, int month_1_12, int day_1_31,
+                     int32_t lat_e6, int32_t lon_e6, int32_t tz_offset_min) {
+  memset(mc, 0, sizeof(*mc));
+  const int64_t midnight_unix = days_from_civil(year, month_1_12, day_1_31) * 86400LL - (int64_t)tz_offset_min * 60;
+  mc->t0_j2000_min = (int32_t)((midnight_unix - MOON_J2000_UNIX) / 60);
+  const int32_t lat_trig = deg_e6_to_trig(lat_e6);
+  mc->sin_lat = trig_sin(lat_trig);
+  mc->cos_lat = trig_cos(lat_trig);
+  mc->lon_trig = deg_e6_to_trig(lon_e6);
+  mc->rise = -1;
+  mc->set = -1;
+}
+
+static void moon_ra_dec_at(const MoonCalc *mc, int minute, int32_t *out_ra, int32_t *out_dec) {
+  int k = minute / MOON_ANCHOR_STEP_MIN;
+  if (k >= MOON_CALC_ANCHORS - 1) k = MOON_CALC_ANCHORS - 2;
+  const int32_t f = minute - k * MOON_ANCHOR_STEP_MIN;
+  const int32_t dra = trig_wrap_signed(mc->ra[k + 1] - mc->ra[k]);
+  *out_ra = mc->ra[k] + dra * f / MOON_ANCHOR_STEP_MIN;
+  *out_dec = mc->dec[k] + (mc->dec[k + 1] - mc->dec[k]) * f / MOON_ANCHOR_STEP_MIN;
+}
+
+// Moon above the rise/set horizon at local minute 0..1440?
+static bool moon_above(const MoonCalc *mc, int minute) {
+  int32_t ra = 0, dec = 0;
+  moon_ra_dec_at(mc, minute, &ra, &dec);
+  const int32_t lst = u32_to_trig(moon_arg_at(&GMST, mc->t0_j2000_min + minute)) + mc->lon_trig;
+  const int32_t ha = lst - ra;
+  const int64_t t1 = (int64_t)mc->sin_lat * trig_sin(dec) / TRIG_MAX_RATIO;
+  const int64_t t2 = (int64_t)mc->cos_lat * trig_cos(dec) / TRIG_MAX_RATIO * trig_cos(ha) / TRIG_MAX_RATIO;
+  return (t1 + t2) > mc->sin_h0;
+}
+
+bool moon_calc_anchors_done(const MoonCalc *mc) {
+  return mc->anchors_done >= MOON_CALC_ANCHORS;
+}
+
+bool moon_calc_step(MoonCalc *mc) {
+  if (!moon_calc_anchors_done(mc)) {
+    for (int i = 0; i < MOON_ANCHORS_PER_SLICE && mc->anchors_done < MOON_CALC_ANCHORS; i++) {
+      const int k = mc->anchors_done++;
+      int32_t dist_km = 0;
+      moon_ra_dec(mc->t0_j2000_min + k * MOON_ANCHOR_STEP_MIN, &mc->ra[k], &mc->dec[k], &dist_km);
+      if (k == MOON_CALC_ANCHORS / 2) {
+        // Topocentric -0.3 deg horizon == geocentric (parallax - 0.3 deg); sin(parallax) = R_earth / dist.
+        const int32_t parallax_e6 = (int32_t)(6378137LL * 57295780LL / ((int64_t)dist_km * 1000LL));
+        mc->sin_h0 = trig_sin(deg_e6_to_trig(parallax_e6 - 300000));
+      }
+    }
+    return false;
+  }
+
+  if (mc->scan_min == 0 && !mc->have_prev) {
+    mc->prev_above = moon_above(mc, 0);
+    mc->have_prev = true;
+    if (mc->prev_above) mc->above_count++;
+  }
+  const int end = MIN(1440, mc->scan_min + MOON_SCAN_SLICE_MIN);
+  for (int m = mc->scan_min + MOON_STEP_MIN; m <= end; m += MOON_STEP_MIN) {
+    const int mm = (m == 1440) ? 1439 : m;
+    const bool above = moon_above(mc, mm);
+    if (above) mc->above_count++;
+    if (above != mc->prev_above) {
+      int lo = m - MOON_STEP_MIN;
+      int hi = m;
+      while (hi - lo > 1) {
+        const int mid = (lo + hi) / 2;
+        if (moon_above(mc, mid) == mc->prev_above) lo = mid; else hi = mid;
+      }
+      if (!mc->prev_above && above && mc->rise < 0) mc->rise = (int16_t)hi;
+      if (mc->prev_above && !above && mc->set < 0) mc->set = (int16_t)hi;
+    }
+    mc->prev_above = above;
+  }
+  mc->scan_min = (int16_t)end;
+  return end >= 1440;
+}
+
+MoonTimes moon_calc_result(const MoonCalc *mc) {
+  MoonTimes out = (MoonTimes){ .valid = true, .always_up = false, .always_down = false, .moonrise_min = 0, .moonset_min = 0 };
+  if (mc->rise < 0 && mc->set < 0) {
+    const int samples = 1440 / MOON_STEP_MIN;
+    if (mc->above_count > samples / 2) out.always_up = true;
+    else out.always_down = true;
+    return out;
+  }
+  out.moonrise_min = (mc->rise < 0) ? 0 : (mc->rise % 1440);
+  out.moonset_min = (mc->set < 0) ? 0 : (mc->set % 1440);
+  return out;
+}
+
+MoonTimes calc_moonrise_moonset_local(int year, int month_1_12, int day_1_31,
+                                      int32_t lat_e6, int32_t lon_e6, int32_t tz_offset_min) {
+  MoonCalc mc;
+  moon_calc_begin(&mc, year, month_1_12, day_1_31, lat_e6, lon_e6, tz_offset_min);
+  while (!moon_calc_step(&mc)) {
+  }
+  return moon_calc_result(&mc);
+}
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <pebble.h>
 #include "yes_types.h"
 
 // Minutes east of UTC: watch system timezone when set, else loc fallback.
@@ -14,8 +13,55 @@ int ymd_for_loc_now(const GeoLoc *loc, int *out_y, int *out_m, int *out_d);
 
 bool get_location_local_tm(const GeoLoc *loc, struct tm *out_tm, int *out_minutes_since_midnight);
 
+// Analytic sunrise/sunset (day-constant declination, fixed-point acos) with one refinement per
+// event. Cheap enough to run inline. Returns false near polar day/night, where the caller needs the
+// sampled solver.
+bool calc_sunrise_sunset_fast(int year, int month_1_12, int day_1_31,
+                              int32_t lat_e6, int32_t lon_e6,
+                              int32_t tz_offset_min, SunTimes *out);
+
+// Full solver: fast path when possible, else a 10-minute scan with bisection at each crossing.
+SunTimes calc_sunrise_sunset_e6(int year, int month_1_12, int day_1_31,
+                                int32_t lat_e6, int32_t lon_e6,
+                                int32_t tz_offset_min);
+
+#ifndef YES_WORKER
+// Same, from degrees (host tools). Kept out of the worker, whose binary has no soft-float code.
 SunTimes calc_sunrise_sunset_local(int year, int month_1_12, int day_1_31,
                                    double lat_deg, double lon_deg,
                                    int32_t tz_offset_min);
+#endif
+
+// Moonrise/moonset for a local day, computed in slices so no single call blocks the UI:
+// begin, then call moon_calc_step until it returns true (7 calls), then read the result.
+// Anchor positions come first (moon_calc_anchors_done() turns true), then the horizon scan.
+// See yes_astro.c for the accuracy budget against the phone-side JS.
+#define MOON_CALC_ANCHORS 9
+#define MOON_ANCHOR_STEP_MIN 180
+
+typedef struct {
+  int32_t t0_j2000_min; // local midnight, UTC minutes since J2000.0
+  int32_t sin_lat;
+  int32_t cos_lat;
+  int32_t lon_trig;
+  int32_t sin_h0;
+  int32_t ra[MOON_CALC_ANCHORS];
+  int32_t dec[MOON_CALC_ANCHORS];
+  int16_t anchors_done;
+  int16_t scan_min;
+  int16_t rise;
+  int16_t set;
+  int16_t above_count;
+  bool prev_above;
+  bool have_prev;
+} MoonCalc;
 
+void moon_calc_begin(MoonCalc *mc, int year, int month_1_12, int day_1_31,
+                     int32_t lat_e6, int32_t lon_e6, int32_t tz_offset_min);
+bool moon_calc_step(MoonCalc *mc);
+bool moon_calc_anchors_done(const MoonCalc *mc);
+MoonTimes moon_calc_result(const MoonCalc *mc);
 
+// All slices back to back.
+MoonTimes calc_moonrise_moonset_local(int year, int month_1_12, int day_1_31,
+                                      int32_t lat_e6, int32_t lon_e6, int32_t tz_offset_min);
@@ -0,0 +1,183 @@
+#include "yes_batt.h"
+
+void yes_batt_reset(YesBattModel *m) {
+  *m = (YesBattModel){ .last_percent = -1 };
+}
+
+void yes_batt_sample(YesBattModel *m, BatteryChargeState st, time_t now) {
+  // Charging restarts the estimate once the cable comes off.
+  if (st.is_plugged) {
+    yes_batt_reset(m);
+    return;
+  }
+  const int percent = (int)st.charge_percent;
+  if (percent == m->last_percent) return;
+
+  if (m->last_percent >= 0 && m->last_time > 0 && now > m->last_time) {
+    const int dp = m->last_percent - percent;
+    const int32_t dt = (int32_t)(now - m->last_time);
+    if (dp > 0 && dt >= 60) {
+      // milli(%/hour) = dp * 3600 / dt * 1000 = dp * 3600000 / dt
+      const int32_t new_rate = (int32_t)((int64_t)dp * 3600000LL / (int64_t)dt);
+      if (new_rate > 0) {
+        if (!m->have_rate) {
+          m->rate_milli_per_hour = new_rate;
+          m->have_rate = true;
+        } else {
+          // Smooth a bit (EMA-ish)
+          m->rate_milli_per_hour = (m->rate_milli_per_hour * 3 + new_rate) / 4;
+        }
+      }
+    }
+  }
+
+  m->last_percent = (int8_t)percent;
+  m->last_time = (int32_t)now;
+}
+
+bool yes_batt_should_alert(const YesBattModel *m, BatteryChargeState st) {
+  // If charging / plugged, no recharge warning.
+  if (st.is_plugged) return false;
+
+  // Always alert when very low.
+  if (st.charge_percent <= 10) return true;
+
+  if (m->have_rate && m->rate_milli_per_hour > 0) {
+    // hours_left ~= percent / (rate %/h)
+    const int32_t hours_left_x1000 = (int32_t)((int32_t)st.charge_percent * 1000 / m->rate_milli_per_hour);
+    return hours_left_x1000 <= 8000;
+  }
+
+  // Fallback heuristic if rate is unknown.
+  return st.charge_percent <= 25;
+}
+
+void yes_batt_history_push(YesBattHistory *h, const YesBattSample *s) {
+  if (h->head >= YES_BATT_SAMPLES) h->head = 0;
+  h->s[h->head] = *s;
+  h->head = (uint8_t)((h->head + 1) % YES_BATT_SAMPLES);
+  if (h->count < YES_BATT_SAMPLES) h->count++;
+}
+
+#define FIT_TERMS 4 // base, redraws, wakes, messages
+
+// Fixed point, like the rest of the worker: no soft-float solver in its binary. Samples outside
+// these bounds are dropped, which keeps every product below in int64.
+#define FIT_MAX_MINUTES (7 * 24 * 60)
+#define FIT_MAX_RATE_PH 3600     // events per hour, per term
+#define FIT_MEAN_SHIFT 4         // fractional bits of the weighted means
+#define FIT_X_SHIFT 8            // fractional bits of the solution while iterating
+#define FIT_MAX_BASE_UPH 100000000 // 100 %/h
+#define FIT_MAX_COST_U 1000000     // 1 % per event
+#define FIT_SWEEPS 400
+
+static int64_t div_round(int64_t n, int64_t d) {
+  return n >= 0 ? (n + d / 2) / d : -((-n + d / 2) / d);
+}
+
+// Projected Gauss-Seidel on a x = b (a symmetric positive definite): every sweep solves each row
+// for its term with the others held, clamping at 0 and at the bounds. Converges to the
+// non-negative least-squares answer, so a cost that would come out negative is pinned to 0 with
+// the others refit around it. Terms in `off` stay 0. x is scaled by 2^FIT_X_SHIFT.
+static void solve(const int64_t a[FIT_TERMS][FIT_TERMS], const int64_t b[FIT_TERMS],
+                  const bool off[FIT_TERMS], int64_t x[FIT_TERMS]) {
+  for (int sweep = 0; sweep < FIT_SWEEPS; sweep++) {
+    bool moved = false;
+    for (int j = 0; j < FIT_TERMS; j++) {
+      if (off[j]) continue;
+      int64_t r = b[j] * (1 << FIT_X_SHIFT);
+      for (int k = 0; k < FIT_TERMS; k++) {
+        if (k != j) r -= a[j][k] * x[k];
+      }
+      int64_t v = div_round(r, a[j][j]);
+      const int64_t max = (int64_t)(j ? FIT_MAX_COST_U : FIT_MAX_BASE_UPH) << FIT_X_SHIFT;
+      if (v < 0) v = 0;
+      if (v > max) v = max;
+      if (v != x[j]) {
+        x[j] = v;
+        moved = true;
+      }
+    }
+    if (!moved) break;
+  }
+}
+
+bool yes_batt_fit(const YesBattHistory *h, YesBattFit *out) {
+  *out = (YesBattFit){ 0 };
+  const int n = h->count < YES_BATT_SAMPLES ? h->count : YES_BATT_SAMPLES;
+
+  // Weighted least squares over per-hour rates, each sample weighted by its minutes m. With
+  // x_j = 60 c_j / m (events per hour) and y = 6e7 drop / m (1e-6 %/h), the weighted sums are
+  //   m x_0 x_0 = m, m x_0 x_j = 60 c_j, m x_j x_k = 3600 c_j c_k / m,
+  //   m x_0 y = 6e7 drop, m x_j y = 3.6e9 c_j drop / m.
+  int64_t s_xx[FIT_TERMS][FIT_TERMS] = { { 0 } };
+  int64_t s_xy[FIT_TERMS] = { 0 };
+  int used = 0;
+  for (int i = 0; i < n; i++) {
+    const YesBattSample *smp = &h->s[i];
+    const int64_t m = smp->minutes;
+    if (m <= 0 || m > FIT_MAX_MINUTES || smp->drop_percent == 0 || smp->drop_percent > 100) continue;
+    const int64_t c[FIT_TERMS] = { 0, smp->act.redraws, smp->act.wakes, smp->act.msgs };
+    bool ok = true;
+    for (int j = 1; j < FIT_TERMS; j++) {
+      if (c[j] * 60 > (int64_t)FIT_MAX_RATE_PH * m) ok = false;
+    }
+    if (!ok) continue;
+    const int64_t drop = smp->drop_percent;
+    s_xx[0][0] += m;
+    s_xy[0] += 60000000LL * drop;
+    for (int j = 1; j < FIT_TERMS; j++) {
+      s_xx[0][j] += 60 * c[j];
+      s_xy[j] += 3600000000LL * c[j] * drop / m;
+      for (int k = j; k < FIT_TERMS; k++) s_xx[j][k] += 3600 * c[j] * c[k] / m;
+    }
+    used++;
+  }
+  if (used < YES_BATT_FIT_MIN_SAMPLES) return false;
+  const int64_t total_m = s_xx[0][0];
+
+  // A term whose rate barely varied (under ~3% spread, or never happened) cannot be told apart
+  // from the base: it stays 0 and its share shows up as standby. With nothing left to split
+  // the history is singular.
+  bool off[FIT_TERMS] = { false };
+  bool any = false;
+  for (int j = 1; j < FIT_TERMS; j++) {
+    const int64_t mean2 = s_xx[0][j] * s_xx[0][j];
+    const int64_t spread = total_m * s_xx[j][j] - mean2;
+    off[j] = spread <= mean2 / 1000;
+    any |= !off[j];
+  }
+  if (!any) return false;
+
+  // Weighted means, so entries stay small whatever the history spans.
+  int64_t a[FIT_TERMS][FIT_TERMS];
+  int64_t b[FIT_TERMS];
+  for (int j = 0; j < FIT_TERMS; j++) {
+    for (int k = j; k < FIT_TERMS; k++) {
+      a[j][k] = a[k][j] = div_round(s_xx[j][k] << FIT_MEAN_SHIFT, total_m);
+    }
+    b[j] = div_round(s_xy[j] << FIT_MEAN_SHIFT, total_m);
+  }
+  // A little ridge on the activity terms: every wake also redraws, so without it the split between
+  // the two swings from sample to sample. It is 1% of each rate's spread about its mean
+  // (a[0][0] is the mean weight), so steady use is not shrunk into the base.
+  for (int j = 1; j < FIT_TERMS; j++) {
+    if (a[j][j] <= 0) off[j] = true;
+    const int64_t spread = a[j][j] - div_round(a[0][j] * a[0][j], a[0][0]);
+    if (spread > 0) a[j][j] += spread / 100;
+  }
+
+  int64_t x[FIT_TERMS] = { 0 };
+  solve(a, b, off, x);
+
+  const int64_t half = 1 << (FIT_X_SHIFT - 1);
+  out->base_uph = (int32_t)((x[0] + half) >> FIT_X_SHIFT);
+  out->redraw_u = (int32_t)((x[1] + half) >> FIT_X_SHIFT);
+  out->wake_u = (int32_t)((x[2] + half) >> FIT_X_SHIFT);
+  out->msg_u = (int32_t)((x[3] + half) >> FIT_X_SHIFT);
+  out->redraws_ph = (uint16_t)div_round(s_xx[0][1], total_m);
+  out->wakes_ph = (uint16_t)div_round(s_xx[0][2], total_m);
+  out->msgs_ph = (uint16_t)div_round(s_xx[0][3], total_m);
+  out->samples = (uint8_t)used;
+  return true;
+}
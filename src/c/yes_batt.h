@@ -0,0 +1,81 @@
+#pragma once
+
+#include "yes_sdk.h"
+
+// Discharge-rate estimate behind the battery alert. Shared with the background worker, which keeps
+// feeding it while the face is closed and persists it (see yes_worker.h).
+typedef struct {
+  int32_t last_time;           // when last_percent was first seen
+  int32_t rate_milli_per_hour; // %/hour * 1000, smoothed over drops
+  int8_t last_percent;         // -1 until the first sample
+  bool have_rate;
+} YesBattModel;
+
+void yes_batt_reset(YesBattModel *m);
+
+// Feed one battery reading. Only a change of percentage moves the anchor, so the rate spans the
+// whole time the previous level lasted rather than the gap since the last call.
+void yes_batt_sample(YesBattModel *m, BatteryChargeState st, time_t now);
+
+// About 8 hours left at the current rate, 10% at most, or 25% before a rate is known.
+bool yes_batt_should_alert(const YesBattModel *m, BatteryChargeState st);
+
+// --- Discharge history and per-feature cost ---
+// The worker closes one sample per percentage drop while unplugged: how long the level lasted and
+// what the face did meanwhile (reported by the face every few minutes). A weighted, non-negative
+// least-squares fit over the ring (int64 fixed point) then splits the discharge rate into a standby
+// base and a cost per redraw, per wake and per phone message, which is what the debug page and the
+// config page show.
+#define YES_BATT_SAMPLES 12
+#define YES_BATT_FIT_MIN_SAMPLES 4
+
+// Face activity over some stretch of time.
+typedef struct {
+  uint32_t redraws;
+  uint32_t wakes; // minute ticks and scheduler timers
+  uint32_t msgs;  // AppMessages from the phone
+} YesBattActivity;
+
+typedef struct {
+  uint32_t minutes;
+  uint32_t drop_percent;
+  YesBattActivity act;
+} YesBattSample;
+
+typedef struct {
+  uint8_t head; // next slot to write
+  uint8_t count;
+  YesBattSample s[YES_BATT_SAMPLES];
+} YesBattHistory;
+
+// Costs in millionths of a percent of a full charge; activity means are per hour over the history.
+typedef struct {
+  int32_t base_uph;
+  int32_t redraw_u;
+  int32_t wake_u;
+  int32_t msg_u;
+  uint16_t redraws_ph;
+  uint16_t wakes_ph;
+  uint16_t msgs_ph;
+  uint8_t samples; // 0 until YES_BATT_FIT_MIN_SAMPLES are in
+} YesBattFit;
+
+void yes_batt_history_push(YesBattHistory *h, const YesBattSample *s);
+
+// Refit from the history. False (and samples 0) while there are too few usable samples, or when
+// no activity rate varied enough to be told apart from standby.
+bool yes_batt_fit(const YesBattHistory *h, YesBattFit *out);
+
+// Nominal capacity, only used to turn percentages into mAh for display.
+#if defined(PBL_PLATFORM_CHALK)
+#define YES_BATT_CAPACITY_MAH 66
+#elif defined(PBL_PLATFORM_DIORITE) || defined(PBL_PLATFORM_FLINT) || defined(PBL_PLATFORM_APLITE)
+#define YES_BATT_CAPACITY_MAH 130
+#else
+#define YES_BATT_CAPACITY_MAH 150
+#endif
+
+// cost (millionths of a percent per event) x events per hour -> mAh per day, x10.
+static inline int32_t yes_batt_mah_day_x10(int32_t cost_u, int32_t per_hour) {
+  return (int32_t)(((int64_t)cost_u * per_hour * 24 * YES_BATT_CAPACITY_MAH + 5000000) / 10000000);
+}
@@ -1,10 +1,12 @@
 #include "yes_draw.h"
 
-#include <math.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "yes_astro.h"
 #include "yes_i18n.h"
+#include "yes_layout.h"
+#include "yes_prof.h"
 
 #ifndef MIN
 #define MIN(a,b) ((a) < (b) ? (a) : (b))
@@ -14,22 +16,44 @@
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
 #endif
 
+// Dial background through the span rasterizer (one frame buffer pass, see dial_spans_compose)
+// instead of layered SDK fills. On by default on B/W, where the fills are not antialiased
+// anyway; color builds keep the antialiased primitives unless built with YES_DIAL_SPANS=1.
+#ifndef YES_DIAL_SPANS
+#ifdef PBL_COLOR
+#define YES_DIAL_SPANS 0
+#else
+#define YES_DIAL_SPANS 1
+#endif
+#endif
+
 // Reusable path for the 24h hand (tapered arrow)
 static GPath *s_hand_path;
 static GPoint s_hand_points[5];
 
-// Scale a "baseline Basalt" pixel value (for 144x168 => face_r ~72) to current face radius.
-static int16_t scale_px(int16_t base_px, int16_t face_r) {
-  const int16_t BASE_R = 72;
-  if (face_r <= 0) return base_px;
-  int32_t v = (int32_t)base_px * (int32_t)face_r;
-  v = (v + (BASE_R / 2)) / BASE_R; // round
-  if (v < 1) v = 1;
-  if (v > 32767) v = 32767;
-  return (int16_t)v;
-}
+// Static dial cache: everything below the hand (rings, night disk, day wedge, scale, moon) only
+// changes with the inputs in DialKey, so keep a copy of those framebuffer pixels and restore it
+// on plain minute ticks instead of re-rasterizing the whole dial.
+typedef struct {
+  uint32_t events_hash; // yes_face_state_hash(YES_STATE_EVENTS)
+  int16_t w;
+  int16_t h;
+  int16_t phase_step; // moon phase in 1/1000 cycle steps (1/100 in low power)
+} DialKey;
+
+static struct {
+  uint8_t *pixels;
+  size_t size;
+  DialKey key;
+  bool valid;
+  bool top_is_night;
+} s_dial_cache;
+
+static void half_chord_init(void);
+static void num_atlas_free(void);
 
 void yes_draw_init(void) {
+  half_chord_init();
   if (!s_hand_path) {
     const GPathInfo hand_info = {
       .num_points = (uint32_t)(sizeof(s_hand_points) / sizeof(s_hand_points[0])),
@@ -44,12 +68,379 @@ void yes_draw_deinit(void) {
     gpath_destroy(s_hand_path);
     s_hand_path = NULL;
   }
+  if (s_dial_cache.pixels) {
+    free(s_dial_cache.pixels);
+    s_dial_cache.pixels = NULL;
+  }
+  s_dial_cache.size = 0;
+  s_dial_cache.valid = false;
+  num_atlas_free();
+}
+
+// Frame buffer row as (pointer, byte length). Round displays use a circular layout where each
+// row only stores the visible span.
+static uint8_t *fb_row(GBitmap *fb, int16_t y, uint16_t *out_len) {
+#ifdef PBL_ROUND
+  const GBitmapDataRowInfo info = gbitmap_get_data_row_info(fb, (uint16_t)y);
+  *out_len = (uint16_t)(info.max_x - info.min_x + 1);
+  return info.data + info.min_x;
+#else
+  const uint16_t stride = gbitmap_get_bytes_per_row(fb);
+  *out_len = stride;
+  return gbitmap_get_data(fb) + (size_t)y * stride;
+#endif
+}
+
+// Row pointer indexed by absolute x, plus the row's visible x range.
+static uint8_t *fb_row_span(GBitmap *fb, int16_t y, int16_t *min_x, int16_t *max_x) {
+#ifdef PBL_ROUND
+  const GBitmapDataRowInfo info = gbitmap_get_data_row_info(fb, (uint16_t)y);
+  *min_x = info.min_x;
+  *max_x = info.max_x;
+  return info.data;
+#else
+  *min_x = 0;
+  *max_x = (int16_t)(gbitmap_get_bounds(fb).size.w - 1);
+  return gbitmap_get_data(fb) + (size_t)y * gbitmap_get_bytes_per_row(fb);
+#endif
+}
+
+static bool fb_px_lit(const uint8_t *row, int16_t x) {
+#ifdef PBL_COLOR
+  return row[x] != GColorBlack.argb;
+#else
+  return (row[x >> 3] >> (x & 7)) & 1;
+#endif
+}
+
+static void fb_px_set(uint8_t *row, int16_t x, GColor color) {
+#ifdef PBL_COLOR
+  row[x] = color.argb;
+#else
+  const uint8_t bit = (uint8_t)(1u << (x & 7));
+  if (color.argb == GColorWhite.argb) row[x >> 3] |= bit;
+  else row[x >> 3] &= (uint8_t)~bit;
+#endif
+}
+
+// Numeral atlas: the glyphs numeric labels use, rendered once per font and read back as a 1-bit
+// mask, so scale labels, the digital time and numeric corners are blitted instead of going through
+// the text engine every frame. Pebble has no offscreen text target, so the glyphs are drawn into
+// the frame buffer at the start of a frame that is about to paint over them. Strings with any other
+// character, or that would not fit their box, still use graphics_draw_text.
+#define NUM_ATLAS_CHARS "0123456789:.-%k"
+#define NUM_ATLAS_COUNT ((int)sizeof(NUM_ATLAS_CHARS) - 1)
+#define NUM_ATLAS_SLOTS 2 // corner/scale font and the digital time font
+
+typedef struct {
+  GFont font;     // set once a build was attempted, even if it failed
+  uint8_t *bits;  // row-major, w bits per row
+  int16_t w;
+  int16_t h;      // one glyph row (the font's line height)
+  GPoint at[NUM_ATLAS_COUNT];
+  int16_t adv[NUM_ATLAS_COUNT];
+} NumAtlas;
+
+static NumAtlas s_num_atlas[NUM_ATLAS_SLOTS];
+
+static void num_atlas_build(GContext *ctx, GRect bounds, NumAtlas *a, GFont font) {
+  a->font = font;
+  // Wrap into rows that also fit a round display's visible span around the center.
+  const int16_t max_w = (int16_t)(bounds.size.w * 2 / 3);
+  char one[2] = { 0, 0 };
+  int16_t x = 0, row = 0, w = 0, h = 0;
+  for (int i = 0; i < NUM_ATLAS_COUNT; i++) {
+    one[0] = NUM_ATLAS_CHARS[i];
+    const GSize sz = graphics_text_layout_get_content_size(
+      one, font, GRect(0, 0, max_w, bounds.size.h), GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft);
+    if (sz.w <= 0 || sz.w > max_w) return;
+    if (x + sz.w > max_w) {
+      x = 0;
+      row++;
+    }
+    a->at[i] = GPoint(x, row);
+    a->adv[i] = sz.w;
+    x = (int16_t)(x + sz.w);
+    w = MAX(w, x);
+    h = MAX(h, sz.h);
+  }
+  const int16_t strip_h = (int16_t)((row + 1) * h);
+  if (h <= 0 || strip_h > bounds.size.h) return;
+  for (int i = 0; i < NUM_ATLAS_COUNT; i++) a->at[i].y = (int16_t)(a->at[i].y * h);
+
+  a->bits = (uint8_t *)calloc(((size_t)w * (size_t)strip_h + 7) / 8, 1);
+  if (!a->bits) return;
+
+  const GRect strip = GRect((int16_t)(bounds.origin.x + (bounds.size.w - w) / 2),
+                            (int16_t)(bounds.origin.y + (bounds.size.h - strip_h) / 2), w, strip_h);
+  graphics_context_set_fill_color(ctx, GColorBlack);
+  graphics_fill_rect(ctx, strip, 0, GCornerNone);
+  graphics_context_set_text_color(ctx, GColorWhite);
+  for (int i = 0; i < NUM_ATLAS_COUNT; i++) {
+    one[0] = NUM_ATLAS_CHARS[i];
+    graphics_draw_text(ctx, one, font,
+                       GRect((int16_t)(strip.origin.x + a->at[i].x), (int16_t)(strip.origin.y + a->at[i].y),
+                             a->adv[i], h),
+                       GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+  }
+
+  bool ok = false;
+  GBitmap *fb = graphics_capture_frame_buffer(ctx);
+  if (fb) {
+    ok = true;
+    for (int16_t r = 0; r < strip_h && ok; r++) {
+      int16_t min_x = 0, max_x = 0;
+      const uint8_t *src = fb_row_span(fb, (int16_t)(strip.origin.y + r), &min_x, &max_x);
+      if (strip.origin.x < min_x || strip.origin.x + w - 1 > max_x) {
+        ok = false;
+        break;
+      }
+      for (int16_t cx = 0; cx < w; cx++) {
+        if (!fb_px_lit(src, (int16_t)(strip.origin.x + cx))) continue;
+        const uint32_t bit = (uint32_t)r * (uint32_t)w + (uint32_t)cx;
+        a->bits[bit >> 3] |= (uint8_t)(1u << (bit & 7));
+      }
+    }
+    graphics_release_frame_buffer(ctx, fb);
+  }
+  graphics_fill_rect(ctx, strip, 0, GCornerNone);
+  if (!ok) {
+    free(a->bits);
+    a->bits = NULL;
+    return;
+  }
+  a->w = w;
+  a->h = h;
+}
+
+// Must run before anything is painted this frame: the glyphs are rendered where the dial goes.
+static void num_atlas_ensure(GContext *ctx, GRect bounds, GFont font) {
+  for (int i = 0; i < NUM_ATLAS_SLOTS; i++) {
+    if (s_num_atlas[i].font == font) return;
+    if (!s_num_atlas[i].font) {
+      num_atlas_build(ctx, bounds, &s_num_atlas[i], font);
+      return;
+    }
+  }
+}
+
+static void num_atlas_free(void) {
+  for (int i = 0; i < NUM_ATLAS_SLOTS; i++) {
+    free(s_num_atlas[i].bits);
+    s_num_atlas[i] = (NumAtlas){ 0 };
+  }
+}
+
+// Blit text from the atlas with graphics_draw_text's placement (single line, top of box).
+// The canvas and corner layers sit at the window origin, so box is in frame buffer coordinates.
+static bool num_atlas_draw(GContext *ctx, const char *text, GFont font, GRect box, GTextAlignment align,
+                           GColor color) {
+  const NumAtlas *a = NULL;
+  for (int i = 0; i < NUM_ATLAS_SLOTS; i++) {
+    if (s_num_atlas[i].font == font && s_num_atlas[i].bits) a = &s_num_atlas[i];
+  }
+  if (!a || !text) return false;
+#ifndef PBL_COLOR
+  // Gray text is dithered by the firmware; keep it there.
+  if (color.argb != GColorWhite.argb && color.argb != GColorBlack.argb) return false;
+#endif
+
+  uint8_t idx[12];
+  int n = 0;
+  int16_t w = 0;
+  for (const char *p = text; *p; p++) {
+    const char *hit = strchr(NUM_ATLAS_CHARS, *p);
+    if (!hit || n >= (int)sizeof(idx)) return false;
+    idx[n] = (uint8_t)(hit - NUM_ATLAS_CHARS);
+    w = (int16_t)(w + a->adv[idx[n]]);
+    n++;
+  }
+  if (n == 0 || w > box.size.w) return false;
+
+  int16_t x0 = box.origin.x;
+  if (align == GTextAlignmentCenter) x0 = (int16_t)(x0 + (box.size.w - w) / 2);
+  else if (align == GTextAlignmentRight) x0 = (int16_t)(x0 + box.size.w - w);
+  const int16_t rows = MIN(a->h, box.size.h);
+
+  GBitmap *fb = graphics_capture_frame_buffer(ctx);
+  if (!fb) return false;
+  const int16_t fb_h = gbitmap_get_bounds(fb).size.h;
+  for (int16_t r = 0; r < rows; r++) {
+    const int16_t y = (int16_t)(box.origin.y + r);
+    if (y < 0 || y >= fb_h) continue;
+    int16_t min_x = 0, max_x = 0;
+    uint8_t *dst = fb_row_span(fb, y, &min_x, &max_x);
+    int16_t pen = x0;
+    for (int k = 0; k < n; k++) {
+      const int g = idx[k];
+      const uint32_t base = (uint32_t)(a->at[g].y + r) * (uint32_t)a->w + (uint32_t)a->at[g].x;
+      for (int16_t gx = 0; gx < a->adv[g]; gx++) {
+        const uint32_t bit = base + (uint32_t)gx;
+        if (!(a->bits[bit >> 3] & (1u << (bit & 7)))) continue;
+        const int16_t px = (int16_t)(pen + gx);
+        if (px >= min_x && px <= max_x) fb_px_set(dst, px, color);
+      }
+      pen = (int16_t)(pen + a->adv[g]);
+    }
+  }
+  graphics_release_frame_buffer(ctx, fb);
+  return true;
+}
+
+// Single-line text through the atlas when possible; callers set the text color for the fallback.
+static void draw_num_text(GContext *ctx, const char *text, GFont font, GRect box, GTextAlignment align,
+                          GColor color) {
+  if (num_atlas_draw(ctx, text, font, box, align, color)) return;
+  graphics_draw_text(ctx, text, font, box, GTextOverflowModeTrailingEllipsis, align, NULL);
+}
+
+static uint32_t sig_mix(uint32_t h, int32_t v) {
+  // FNV-1a over the 32-bit value
+  h ^= (uint32_t)v;
+  return h * 16777619u;
+}
+#define SIG_SEED 2166136261u
+
+static uint32_t hash_sun(uint32_t h, const SunTimes *sun) {
+  if (!sun || !sun->valid) return sig_mix(h, 3);
+  h = sig_mix(h, sun->always_day ? 1 : (sun->always_night ? 2 : 0));
+  h = sig_mix(h, sun->sunrise_min);
+  return sig_mix(h, sun->sunset_min);
+}
+
+static uint32_t hash_moon(uint32_t h, const MoonTimes *moon) {
+  if (!moon || !moon->valid) return sig_mix(h, 3);
+  h = sig_mix(h, moon->always_up ? 1 : (moon->always_down ? 2 : 0));
+  h = sig_mix(h, moon->moonrise_min);
+  return sig_mix(h, moon->moonset_min);
+}
+
+uint32_t yes_face_state_hash(const YesFaceState *st, uint32_t parts) {
+  // Language changes every label, so it is part of every hash.
+  uint32_t h = sig_mix(SIG_SEED, (int32_t)yes_i18n_get_language());
+  if (parts & YES_STATE_EVENTS) {
+    h = hash_sun(h, st->sun);
+    h = hash_moon(h, st->moon);
+    h = sig_mix(h, st->have_phase ? st->moon_phase_e6 : -1);
+  }
+  if (parts & YES_STATE_LOC) {
+    const GeoLoc *loc = st->loc;
+    if (loc && loc->valid) {
+      h = sig_mix(h, loc->lat_e6);
+      h = sig_mix(h, loc->lon_e6);
+      h = sig_mix(h, loc->tz_offset_min);
+    } else {
+      h = sig_mix(h, -1);
+    }
+  }
+  if (parts & YES_STATE_TIDE) {
+    const YesTideState *t = &st->tide;
+    h = sig_mix(h, (t->valid ? 1 : 0) | (t->next_is_high ? 2 : 0) | (t->level_is_ft ? 4 : 0));
+    h = sig_mix(h, t->last_unix);
+    h = sig_mix(h, t->next_unix);
+    h = sig_mix(h, t->level_x10);
+  }
+  if (parts & YES_STATE_ALT) {
+    h = sig_mix(h, (st->alt.valid ? 1 : 0) | (st->alt.is_ft ? 2 : 0));
+    h = sig_mix(h, st->alt.m);
+  }
+  if (parts & YES_STATE_WEATHER) {
+    const YesWeatherState *w = &st->weather;
+    h = sig_mix(h, (w->valid ? 1 : 0) | (w->is_day ? 2 : 0) | (w->is_f ? 4 : 0) | ((int32_t)w->code << 8));
+    h = sig_mix(h, w->temp_c10);
+    h = sig_mix(h, ((int32_t)w->wind_spd_x10 << 16) ^ (uint16_t)w->wind_dir_deg);
+    h = sig_mix(h, w->precip_x10);
+    h = sig_mix(h, w->uv_x10);
+    h = sig_mix(h, w->pressure_hpa_x10);
+  }
+  if (parts & YES_STATE_MISC) {
+    h = sig_mix(h, (st->battery_alert ? 1 : 0) | (st->net_on ? 2 : 0) | (st->debug ? 4 : 0) | (st->debug_perf ? 8 : 0) |
+                   (st->low_power ? 16 : 0) | (st->debug_batt ? 32 : 0));
+    h = sig_mix(h, st->battery_percent);
+    h = sig_mix(h, st->ui_update_interval_sec);
+  }
+  return h;
+}
+
+static DialKey dial_key_make(GRect bounds, const YesFaceState *st, int32_t phase_e6) {
+  DialKey k;
+  memset(&k, 0, sizeof(k)); // padding must compare equal
+  k.events_hash = yes_face_state_hash(st, YES_STATE_EVENTS);
+  k.w = bounds.size.w;
+  k.h = bounds.size.h;
+  // Low power re-rasterizes the dial for the moon every ~7 h instead of every ~42 min.
+  k.phase_step = (int16_t)(phase_e6 / (st->low_power ? 10000 : 1000));
+  return k;
+}
+
+static bool dial_cache_restore(GContext *ctx, const DialKey *key, bool *out_top_is_night) {
+  if (!s_dial_cache.valid || !s_dial_cache.pixels) return false;
+  if (memcmp(&s_dial_cache.key, key, sizeof(*key)) != 0) return false;
+
+  GBitmap *fb = graphics_capture_frame_buffer(ctx);
+  if (!fb) return false;
+  const int16_t rows = gbitmap_get_bounds(fb).size.h;
+  const uint8_t *src = s_dial_cache.pixels;
+  const uint8_t *end = s_dial_cache.pixels + s_dial_cache.size;
+  bool ok = true;
+  for (int16_t y = 0; y < rows; y++) {
+    uint16_t len = 0;
+    uint8_t *dst = fb_row(fb, y, &len);
+    if (src + len > end) { ok = false; break; }
+    memcpy(dst, src, len);
+    src += len;
+  }
+  graphics_release_frame_buffer(ctx, fb);
+  if (!ok) {
+    s_dial_cache.valid = false;
+    return false;
+  }
+  *out_top_is_night = s_dial_cache.top_is_night;
+  return true;
+}
+
+static void dial_cache_store(GContext *ctx, const DialKey *key, bool top_is_night) {
+  s_dial_cache.valid = false;
+  GBitmap *fb = graphics_capture_frame_buffer(ctx);
+  if (!fb) return;
+  const int16_t rows = gbitmap_get_bounds(fb).size.h;
+
+  size_t need = 0;
+  for (int16_t y = 0; y < rows; y++) {
+    uint16_t len = 0;
+    (void)fb_row(fb, y, &len);
+    need += len;
+  }
+  if (s_dial_cache.pixels && s_dial_cache.size != need) {
+    free(s_dial_cache.pixels);
+    s_dial_cache.pixels = NULL;
+  }
+  if (!s_dial_cache.pixels) {
+    // Not fatal when the heap is tight: we simply keep redrawing the full dial.
+    s_dial_cache.pixels = (uint8_t *)malloc(need);
+    s_dial_cache.size = s_dial_cache.pixels ? need : 0;
+  }
+  if (s_dial_cache.pixels) {
+    uint8_t *dst = s_dial_cache.pixels;
+    for (int16_t y = 0; y < rows; y++) {
+      uint16_t len = 0;
+      const uint8_t *src = fb_row(fb, y, &len);
+      memcpy(dst, src, len);
+      dst += len;
+    }
+    s_dial_cache.key = *key;
+    s_dial_cache.top_is_night = top_is_night;
+    s_dial_cache.valid = true;
+  }
+  graphics_release_frame_buffer(ctx, fb);
 }
 
 static int32_t angle_from_local_minutes_24h(int minutes_since_midnight) {
   const int m = (minutes_since_midnight % 1440 + 1440) % 1440;
-  const int delta = m - 720; // minutes from noon
-  int32_t angle = (int32_t)lround((double)delta * (double)TRIG_MAX_ANGLE / 1440.0);
+  const int32_t delta = m - 720; // minutes from noon
+  // Integer round-half-away-from-zero of delta * TRIG_MAX_ANGLE / 1440 (|delta| <= 720, no overflow).
+  const int32_t num = delta * (int32_t)TRIG_MAX_ANGLE;
+  int32_t angle = (num >= 0) ? (num + 720) / 1440 : -((-num + 720) / 1440);
   angle %= TRIG_MAX_ANGLE;
   if (angle < 0) angle += TRIG_MAX_ANGLE;
   return angle;
@@ -153,10 +544,29 @@ static void draw_ring_arc(GContext *ctx, GRect bounds, uint16_t inset, uint16_t
   }
 }
 
-static void draw_outer_scale(GContext *ctx, GRect bounds, uint16_t moon_inset, uint16_t moon_ring_thickness) {
+// 24h scale geometry, indexed by half-hour (i * 30 minutes). Only depends on the layer size and
+// ring insets, so it is built once and reused instead of doing trig and text layout per frame.
+#define SCALE_STEPS 48
+static struct {
+  int16_t w;
+  int16_t h;
+  uint16_t moon_inset;
+  uint16_t moon_ring_thickness;
+  bool valid;
+  GPoint tick_p0[SCALE_STEPS]; // odd half-hours: short tick, odd hours: long tick
+  GPoint tick_p1[SCALE_STEPS];
+  GRect label[SCALE_STEPS / 4]; // even hours
+  char label_txt[SCALE_STEPS / 4][3];
+} s_scale_geom;
+
+static GPoint polar_point(GPoint c, int32_t sin_v, int32_t cos_v, int16_t r) {
+  return GPoint((int16_t)(c.x + sin_v * r / TRIG_MAX_RATIO),
+                (int16_t)(c.y - cos_v * r / TRIG_MAX_RATIO));
+}
+
+static void scale_geom_build(GRect bounds, uint16_t moon_inset, uint16_t moon_ring_thickness, GFont font) {
   const GPoint c = grect_center_point(&bounds);
-  const int min_dim = (int)MIN(bounds.size.w, bounds.size.h);
-  const int16_t face_r = (int16_t)(min_dim / 2);
+  const int16_t face_r = YES_FACE_R;
 
   const int16_t ring_outer_r = (int16_t)(face_r - (int16_t)moon_inset);
   const int16_t r_outer = (int16_t)(face_r - 1);
@@ -164,149 +574,228 @@ static void draw_outer_scale(GContext *ctx, GRect bounds, uint16_t moon_inset, u
   const int16_t band_inner = (int16_t)(ring_outer_r + (int16_t)moon_ring_thickness + 1);
   const int16_t band_outer = r_outer;
 
-  const int16_t label_h = scale_px(16, face_r);
-  const int16_t r_label = (int16_t)(band_outer - scale_px(8, face_r));
+  const int16_t label_h = YES_PX(16);
+  const int16_t r_label = (int16_t)(band_outer - YES_PX(8));
 
-  const int16_t long_len = scale_px(10, face_r);
-  const int16_t short_len = scale_px(5, face_r);
+  const int16_t long_len = YES_PX(10);
+  const int16_t short_len = YES_PX(5);
   const int16_t r_short_start = band_inner;
   const int16_t r_short_end = (int16_t)MIN(band_outer, r_short_start + short_len);
   const int16_t r_long_start = band_inner;
   const int16_t r_long_end = (int16_t)MIN(band_outer, r_long_start + long_len);
 
-  graphics_context_set_stroke_color(ctx, GColorWhite);
-  graphics_context_set_stroke_width(ctx, 1);
-  graphics_context_set_text_color(ctx, GColorWhite);
-  const GFont font = (min_dim >= 200)
-    ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-    : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-
-  for (int i = 1; i < 48; i++) {
+  for (int i = 0; i < SCALE_STEPS; i++) {
     const int m = i * 30;
-    if ((m % 60) == 0) continue;
-    if ((m % 120) == 0) continue;
-
     const int32_t a = angle_from_local_minutes_24h(m);
-    const int16_t x1 = (int16_t)(c.x + (int32_t)sin_lookup(a) * r_short_start / TRIG_MAX_RATIO);
-    const int16_t y1 = (int16_t)(c.y - (int32_t)cos_lookup(a) * r_short_start / TRIG_MAX_RATIO);
-    const int16_t x2 = (int16_t)(c.x + (int32_t)sin_lookup(a) * r_short_end / TRIG_MAX_RATIO);
-    const int16_t y2 = (int16_t)(c.y - (int32_t)cos_lookup(a) * r_short_end / TRIG_MAX_RATIO);
-    graphics_draw_line(ctx, GPoint(x1, y1), GPoint(x2, y2));
-  }
-
-  for (int h = 0; h < 24; h++) {
-    const int m = h * 60;
-    const int32_t a = angle_from_local_minutes_24h(m);
-
-    if ((h % 2) == 0) {
-      int label = (h == 0) ? 24 : h;
-      char buf[3];
-      snprintf(buf, sizeof(buf), "%d", label);
+    const int32_t sv = sin_lookup(a);
+    const int32_t cv = cos_lookup(a);
 
-      const int16_t x = (int16_t)(c.x + (int32_t)sin_lookup(a) * r_label / TRIG_MAX_RATIO);
-      const int16_t y = (int16_t)(c.y - (int32_t)cos_lookup(a) * r_label / TRIG_MAX_RATIO);
+    if ((m % 120) == 0) {
+      const int h = m / 60;
+      const int label = (h == 0) ? 24 : h;
+      char *buf = s_scale_geom.label_txt[h / 2];
+      snprintf(buf, sizeof(s_scale_geom.label_txt[0]), "%d", label);
 
+      const GPoint p = polar_point(c, sv, cv, r_label);
       const GSize sz = graphics_text_layout_get_content_size(
         buf, font, GRect(0, 0, 60, label_h),
         GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter
       );
       const int16_t w = (int16_t)(sz.w + 4);
 
-      int16_t rx = (int16_t)(x - w / 2);
-      int16_t ry = (int16_t)(y - label_h / 2);
+      int16_t rx = (int16_t)(p.x - w / 2);
+      int16_t ry = (int16_t)(p.y - label_h / 2);
       if (rx < 0) rx = 0;
       if (ry < 0) ry = 0;
       if (rx + w > bounds.size.w) rx = (int16_t)(bounds.size.w - w);
       if (ry + label_h > bounds.size.h) ry = (int16_t)(bounds.size.h - label_h);
-      const GRect r = GRect(rx, ry, w, label_h);
-      graphics_draw_text(ctx, buf, font, r, GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+      s_scale_geom.label[h / 2] = GRect(rx, ry, w, label_h);
+    } else if ((m % 60) == 0) {
+      s_scale_geom.tick_p0[i] = polar_point(c, sv, cv, r_long_start);
+      s_scale_geom.tick_p1[i] = polar_point(c, sv, cv, r_long_end);
     } else {
-      const int16_t x1 = (int16_t)(c.x + (int32_t)sin_lookup(a) * r_long_start / TRIG_MAX_RATIO);
-      const int16_t y1 = (int16_t)(c.y - (int32_t)cos_lookup(a) * r_long_start / TRIG_MAX_RATIO);
-      const int16_t x2 = (int16_t)(c.x + (int32_t)sin_lookup(a) * r_long_end / TRIG_MAX_RATIO);
-      const int16_t y2 = (int16_t)(c.y - (int32_t)cos_lookup(a) * r_long_end / TRIG_MAX_RATIO);
-      graphics_draw_line(ctx, GPoint(x1, y1), GPoint(x2, y2));
+      s_scale_geom.tick_p0[i] = polar_point(c, sv, cv, r_short_start);
+      s_scale_geom.tick_p1[i] = polar_point(c, sv, cv, r_short_end);
     }
   }
+
+  s_scale_geom.w = bounds.size.w;
+  s_scale_geom.h = bounds.size.h;
+  s_scale_geom.moon_inset = moon_inset;
+  s_scale_geom.moon_ring_thickness = moon_ring_thickness;
+  s_scale_geom.valid = true;
 }
 
-static double moon_phase_0_1(time_t now_utc) {
-  const time_t ref = 947182440;
-  const int64_t synodic_sec = 2551443;
-  int64_t delta = (int64_t)now_utc - (int64_t)ref;
-  int64_t m = delta % synodic_sec;
-  if (m < 0) m += synodic_sec;
-  return (double)m / (double)synodic_sec;
+static void draw_outer_scale(GContext *ctx, GRect bounds, uint16_t moon_inset, uint16_t moon_ring_thickness) {
+  const GFont font = fonts_get_system_font(YES_FONT_KEY_LABEL);
+
+  if (!s_scale_geom.valid || s_scale_geom.w != bounds.size.w || s_scale_geom.h != bounds.size.h ||
+      s_scale_geom.moon_inset != moon_inset || s_scale_geom.moon_ring_thickness != moon_ring_thickness) {
+    scale_geom_build(bounds, moon_inset, moon_ring_thickness, font);
+  }
+
+  graphics_context_set_stroke_color(ctx, GColorWhite);
+  graphics_context_set_stroke_width(ctx, 1);
+  graphics_context_set_text_color(ctx, GColorWhite);
+
+  for (int i = 1; i < SCALE_STEPS; i++) {
+    if ((i % 4) == 0) continue;
+    graphics_draw_line(ctx, s_scale_geom.tick_p0[i], s_scale_geom.tick_p1[i]);
+  }
+
+  for (int k = 0; k < SCALE_STEPS / 4; k++) {
+    draw_num_text(ctx, s_scale_geom.label_txt[k], font, s_scale_geom.label[k], GTextAlignmentCenter, GColorWhite);
+  }
 }
 
-static int16_t isqrt16(int16_t n) {
-  if (n <= 0) return 0;
-  int16_t x = 0;
-  while ((int32_t)(x + 1) * (int32_t)(x + 1) <= (int32_t)n) x++;
-  return x;
+static int32_t moon_phase_e6_now(time_t now_utc) {
+  const int32_t ref = 947182440;
+  const uint32_t synodic_sec = 2551443;
+  int32_t m = (int32_t)((int32_t)now_utc - ref) % (int32_t)synodic_sec;
+  if (m < 0) m += (int32_t)synodic_sec;
+  // m * 1e6 / synodic in two 32-bit steps (m * 1000 < 2^32).
+  const uint32_t num = (uint32_t)m * 1000u;
+  const uint32_t milli = num / synodic_sec;
+  const uint32_t rem = num % synodic_sec;
+  return (int32_t)(milli * 1000u + rem * 1000u / synodic_sec);
 }
 
-static void draw_moon(GContext *ctx, GPoint center, int radius, double phase) {
-  // Snap near endpoints so "full" and "new" look clean and don't show a stray terminator.
-  // Also, draw the terminator using scanlines so the shadow never paints outside the moon disk.
-  const double eps = 0.015; // ~0.44 days
-  if (phase < 0) phase = 0;
-  if (phase > 1) phase = 1;
+// floor(sqrt(n)), one result bit per step.
+static int16_t isqrt32(uint32_t n) {
+  uint32_t root = 0;
+  uint32_t bit = 1u << 30;
+  while (bit > n) bit >>= 2;
+  while (bit) {
+    if (n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (int16_t)root;
+}
 
-  if (radius <= 0) return;
+static int16_t isqrt16(int16_t n) {
+  return (n <= 0) ? 0 : isqrt32((uint32_t)n);
+}
 
-  if (phase < eps || phase > 1.0 - eps) {
-    // New moon: dark disk with bright outline
-    graphics_context_set_fill_color(ctx, GColorBlack);
-    graphics_fill_circle(ctx, center, radius);
-    graphics_context_set_stroke_color(ctx, GColorWhite);
-    graphics_draw_circle(ctx, center, radius);
-    return;
+// Half-chord widths floor(sqrt(r^2 - y^2)) for every radius up to MOON_R_MAX, stored as a
+// triangle: row r starts at r * (r + 1) / 2 and holds y = 0..r. Filled in yes_draw_init.
+#define MOON_R_MAX 24
+static uint8_t s_half_chord[(MOON_R_MAX + 1) * (MOON_R_MAX + 2) / 2];
+
+static void half_chord_init(void) {
+  for (int32_t r = 0; r <= MOON_R_MAX; r++) {
+    uint8_t *row = &s_half_chord[r * (r + 1) / 2];
+    int32_t x = r;
+    for (int32_t y = 0; y <= r; y++) {
+      while (x > 0 && x * x > r * r - y * y) x--;
+      row[y] = (uint8_t)x;
+    }
   }
+}
 
-  if (fabs(phase - 0.5) < eps) {
-    // Full moon: bright disk
-    graphics_context_set_fill_color(ctx, GColorWhite);
-    graphics_fill_circle(ctx, center, radius);
-    graphics_context_set_stroke_color(ctx, GColorWhite);
-    graphics_draw_circle(ctx, center, radius);
-    return;
+static int16_t half_chord(int16_t r, int16_t y) {
+  if (y < 0) y = (int16_t)(-y);
+  if (y > r) return 0;
+  if (r <= MOON_R_MAX) return s_half_chord[r * (r + 1) / 2 + y];
+  return isqrt16((int16_t)(r * r - y * y));
+}
+
+// Shadow spans of the last terminator drawn, one per scanline. The shape only depends on the
+// radius and the (integer) shadow offset, which moves a few times a day.
+static struct {
+  int16_t r;
+  int16_t dx;
+  bool valid;
+  int8_t x1[2 * MOON_R_MAX + 1];
+  int8_t x2[2 * MOON_R_MAX + 1];
+} s_moon_sprite;
+
+static void moon_sprite_build(int16_t r, int16_t dx) {
+  for (int16_t yy = -r; yy <= r; yy++) {
+    const int16_t x_disk = half_chord(r, yy);
+    int16_t x1 = (int16_t)(dx - x_disk);
+    int16_t x2 = (int16_t)(dx + x_disk);
+    // Clip to the moon disk extents for this scanline.
+    if (x1 < -x_disk) x1 = (int16_t)(-x_disk);
+    if (x2 >  x_disk) x2 = x_disk;
+    s_moon_sprite.x1[yy + r] = (int8_t)x1;
+    s_moon_sprite.x2[yy + r] = (int8_t)x2;
   }
+  s_moon_sprite.r = r;
+  s_moon_sprite.dx = dx;
+  s_moon_sprite.valid = true;
+}
 
-  // White base disk
-  graphics_context_set_fill_color(ctx, GColorWhite);
-  graphics_fill_circle(ctx, center, radius);
+typedef enum {
+  MOON_LOOK_NEW,     // dark disk
+  MOON_LOOK_FULL,    // lit disk
+  MOON_LOOK_PARTIAL, // lit disk minus a shadow disk offset by dx
+} MoonLook;
+
+// Near the endpoints the phase snaps to "new" or "full" so neither shows a stray terminator.
+static MoonLook moon_look(int radius, int32_t phase_e6, int16_t *out_dx) {
+  const int32_t eps = 15000; // ~0.44 days
+  if (phase_e6 < 0) phase_e6 = 0;
+  if (phase_e6 > 1000000) phase_e6 = 1000000;
+
+  const int32_t from_full = (phase_e6 > 500000) ? (phase_e6 - 500000) : (500000 - phase_e6);
+  if (phase_e6 < eps || phase_e6 > 1000000 - eps) return MOON_LOOK_NEW;
+  if (from_full < eps) return MOON_LOOK_FULL;
 
   // Shadow mask: same concept as the old "offset circle", but clipped to the moon disk via scanlines.
-  const double d = 2.0 * (double)radius * (1.0 - 2.0 * fabs(phase - 0.5)); // 0..2r
-  int16_t offset = (int16_t)lround(d);
+  // offset = round(2r * (1 - 2 * |phase - 0.5|)), 0..2r
+  const int32_t d_e6 = 2 * (int32_t)radius * (1000000 - 2 * from_full);
+  int16_t offset = (int16_t)((d_e6 + 500000) / 1000000);
   if (offset < 0) offset = 0;
   if (offset > 2 * radius) offset = (int16_t)(2 * radius);
   // When offset is ~2r the shadow-mask circle is tangent to the moon disk, which can produce
   // a single dark pixel. Treat this as "full enough" and draw no shadow.
-  if (offset >= (int16_t)(2 * radius - 1)) {
-    graphics_context_set_stroke_color(ctx, GColorWhite);
-    graphics_draw_circle(ctx, center, radius);
-    return;
+  if (offset >= (int16_t)(2 * radius - 1)) return MOON_LOOK_FULL;
+  const bool waxing = (phase_e6 < 500000);
+  *out_dx = waxing ? (int16_t)(-offset) : offset;
+  return MOON_LOOK_PARTIAL;
+}
+
+// Shadow span [x1, x2] (relative to the moon center) on scanline yy; false when it is empty.
+static bool moon_shadow_span(int16_t r, int16_t dx, int16_t yy, int16_t *out_x1, int16_t *out_x2) {
+  if (r <= MOON_R_MAX) {
+    if (!s_moon_sprite.valid || s_moon_sprite.r != r || s_moon_sprite.dx != dx) {
+      moon_sprite_build(r, dx);
+    }
+    *out_x1 = s_moon_sprite.x1[yy + r];
+    *out_x2 = s_moon_sprite.x2[yy + r];
+  } else {
+    const int16_t x_disk = half_chord(r, yy);
+    *out_x1 = MAX((int16_t)(dx - x_disk), (int16_t)(-x_disk));
+    *out_x2 = MIN((int16_t)(dx + x_disk), x_disk);
   }
-  const bool waxing = (phase < 0.5);
-  const int16_t dx = waxing ? (int16_t)(-offset) : offset;
+  return *out_x1 <= *out_x2;
+}
 
-  graphics_context_set_stroke_color(ctx, GColorBlack);
-  graphics_context_set_stroke_width(ctx, 1);
+static void draw_moon(GContext *ctx, GPoint center, int radius, int32_t phase_e6) {
+  if (radius <= 0) return;
 
-  const int16_t r = (int16_t)radius;
-  for (int16_t yy = -r; yy <= r; yy++) {
-    const int16_t x_disk = isqrt16((int16_t)(r * r - yy * yy));
-    int16_t x1 = (int16_t)(dx - x_disk);
-    int16_t x2 = (int16_t)(dx + x_disk);
-    // Clip to the moon disk extents for this scanline.
-    if (x1 < -x_disk) x1 = (int16_t)(-x_disk);
-    if (x2 >  x_disk) x2 = x_disk;
-    if (x1 <= x2) {
-      const GPoint p0 = GPoint((int16_t)(center.x + x1), (int16_t)(center.y + yy));
-      const GPoint p1 = GPoint((int16_t)(center.x + x2), (int16_t)(center.y + yy));
-      graphics_draw_line(ctx, p0, p1);
+  int16_t dx = 0;
+  const MoonLook look = moon_look(radius, phase_e6, &dx);
+  graphics_context_set_fill_color(ctx, look == MOON_LOOK_NEW ? GColorBlack : GColorWhite);
+  graphics_fill_circle(ctx, center, radius);
+
+  if (look == MOON_LOOK_PARTIAL) {
+    // Terminator as scanlines so the shadow never paints outside the moon disk.
+    graphics_context_set_stroke_color(ctx, GColorBlack);
+    graphics_context_set_stroke_width(ctx, 1);
+    const int16_t r = (int16_t)radius;
+    for (int16_t yy = -r; yy <= r; yy++) {
+      int16_t x1 = 0, x2 = 0;
+      if (moon_shadow_span(r, dx, yy, &x1, &x2)) {
+        const GPoint p0 = GPoint((int16_t)(center.x + x1), (int16_t)(center.y + yy));
+        const GPoint p1 = GPoint((int16_t)(center.x + x2), (int16_t)(center.y + yy));
+        graphics_draw_line(ctx, p0, p1);
+      }
     }
   }
 
@@ -315,7 +804,268 @@ static void draw_moon(GContext *ctx, GPoint center, int radius, double phase) {
   graphics_draw_circle(ctx, center, radius);
 }
 
+#if YES_DIAL_SPANS
+// Dial span rasterizer: one pass over the captured frame buffer paints the moon ring, the
+// day/night disk, the day wedge and the moon phase disk, writing every pixel once instead of
+// layering base disk, arc, night disk, wedge and moon fills (twice each when a sweep wraps past
+// 0 deg). Each row is cut at the x where some radius or sweep ray crosses it, so the color is
+// constant between cuts and decided once per segment.
+typedef struct {
+  int32_t s_x, s_y; // unit rays (TRIG_MAX_RATIO) at the start and end angles, y pointing down
+  int32_t e_x, e_y;
+  bool wide;        // longer than half a turn
+  bool all;
+  bool none;
+} DialSweep;
+
+static DialSweep dial_sweep_make(int32_t start, int32_t end, bool full_if_equal) {
+  start %= TRIG_MAX_ANGLE;
+  end %= TRIG_MAX_ANGLE;
+  if (start < 0) start += TRIG_MAX_ANGLE;
+  if (end < 0) end += TRIG_MAX_ANGLE;
+  DialSweep sw = {
+    .s_x = sin_lookup(start), .s_y = -cos_lookup(start),
+    .e_x = sin_lookup(end), .e_y = -cos_lookup(end),
+    .wide = ((end - start + TRIG_MAX_ANGLE) % TRIG_MAX_ANGLE) > TRIG_MAX_ANGLE / 2,
+    .all = (start == end) && full_if_equal,
+    .none = (start == end) && !full_if_equal,
+  };
+  return sw;
+}
+
+// Clockwise from start to end (screen coordinates): p is past the start ray and before the end ray.
+static bool dial_sweep_has(const DialSweep *sw, int32_t dx, int32_t dy) {
+  if (sw->all) return true;
+  if (sw->none) return false;
+  const bool after_start = sw->s_x * dy - sw->s_y * dx >= 0;
+  const bool before_end = dx * sw->e_y - dy * sw->e_x >= 0;
+  return sw->wide ? (after_start || before_end) : (after_start && before_end);
+}
+
+// Pixels within r of the center: d^2 <= r^2 + r, i.e. closer than r + 1/2.
+static int32_t dial_r2(int16_t r) {
+  return (r > 0) ? (int32_t)r * r + r : -1;
+}
+
+static int32_t div_floor(int32_t a, int32_t b) {
+  int32_t q = a / b;
+  if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+  return q;
+}
+
+typedef struct {
+  GPoint c;
+  int32_t base_r2;   // dark "moon down" ring
+  int32_t up_r2;     // moon-up arc, outer edge
+  int32_t arc_in_r2; // moon-up arc, inside its inner edge
+  int32_t solar_r2;  // day/night disk
+  int32_t day_r2;    // day wedge (the whole disk when always day)
+  DialSweep arc;
+  DialSweep day;
+  GPoint moon_c;
+  int16_t moon_r;
+  int16_t moon_dx;
+  MoonLook look;
+  GColor col_base, col_up, col_night, col_day;
+} DialSpans;
+
+typedef struct {
+  int32_t dy;
+  int32_t dy2;
+  int16_t moon_hw; // moon disk half-width on this row, -1 when the row misses it
+  int16_t sh_x1;   // moon shadow, relative to the moon center
+  int16_t sh_x2;
+} DialRow;
+
+static GColor dial_spans_px(const DialSpans *d, const DialRow *r, int16_t x) {
+  const int16_t mx = (int16_t)(x - d->moon_c.x);
+  if (mx >= -r->moon_hw && mx <= r->moon_hw) {
+    if (d->look == MOON_LOOK_NEW) return GColorBlack;
+    if (d->look == MOON_LOOK_PARTIAL && mx >= r->sh_x1 && mx <= r->sh_x2) return GColorBlack;
+    return GColorWhite;
+  }
+  const int32_t dx = x - d->c.x;
+  const int32_t d2 = dx * dx + r->dy2;
+  if (d2 <= d->solar_r2) {
+    return (d2 <= d->day_r2 && dial_sweep_has(&d->day, dx, r->dy)) ? d->col_day : d->col_night;
+  }
+  if (d2 > d->arc_in_r2 && d2 <= d->up_r2 && dial_sweep_has(&d->arc, dx, r->dy)) return d->col_up;
+  if (d2 <= d->base_r2) return d->col_base;
+  return GColorBlack;
+}
+
+static void dial_row_fill(uint8_t *row, int16_t x0, int16_t x1, int16_t y, GColor color) {
+#ifdef PBL_COLOR
+  (void)y;
+  memset(row + x0, color.argb, (size_t)(x1 - x0 + 1));
+#else
+  // Grays become the firmware's 50% checkerboard.
+  for (int16_t x = x0; x <= x1; x++) {
+    const bool on = (color.argb == GColorWhite.argb) ||
+                    (color.argb != GColorBlack.argb && ((x + y) & 1) == 0);
+    const uint8_t bit = (uint8_t)(1u << (x & 7));
+    if (on) row[x >> 3] |= bit;
+    else row[x >> 3] &= (uint8_t)~bit;
+  }
+#endif
+}
+
+#define DIAL_MAX_CUTS 28
+
+static int dial_cut_radius(int16_t *cuts, int n, int16_t cx, int32_t r2, int32_t dy2) {
+  if (r2 < dy2) return n;
+  const int16_t hw = isqrt32((uint32_t)(r2 - dy2));
+  cuts[n++] = (int16_t)(cx - hw);
+  cuts[n++] = (int16_t)(cx + hw + 1);
+  return n;
+}
+
+static int dial_cut_ray(int16_t *cuts, int n, int16_t cx, int32_t ray_x, int32_t ray_y, int32_t dy) {
+  if (ray_y == 0) return n; // parallel to the row: same side everywhere on it
+  const int32_t q = div_floor(ray_x * dy, ray_y);
+  if (q < -INT16_MAX / 2 || q > INT16_MAX / 2) return n;
+  cuts[n++] = (int16_t)(cx + q);
+  cuts[n++] = (int16_t)(cx + q + 1);
+  return n;
+}
+
+static int dial_cut_sweep(int16_t *cuts, int n, int16_t cx, const DialSweep *sw, int32_t dy) {
+  if (sw->all || sw->none) return n;
+  n = dial_cut_ray(cuts, n, cx, sw->s_x, sw->s_y, dy);
+  return dial_cut_ray(cuts, n, cx, sw->e_x, sw->e_y, dy);
+}
+
+static bool dial_spans_compose(GContext *ctx, GPoint c, const SunTimes *sun, const MoonTimes *moon,
+                               GPoint moon_c, int16_t moon_r, int32_t phase_e6,
+                               GColor col_base, GColor col_up, GColor col_night, GColor col_day,
+                               bool *out_top_is_night) {
+  GBitmap *fb = graphics_capture_frame_buffer(ctx);
+  if (!fb) return false;
+
+  const int16_t ring_r = (int16_t)(YES_FACE_R - YES_MOON_INSET);
+  const bool have_sun = sun && sun->valid;
+  DialSpans d = {
+    .c = c,
+    .base_r2 = dial_r2((int16_t)(ring_r + YES_MOON_BASE_THICKNESS / 2)),
+    .up_r2 = dial_r2((int16_t)(ring_r + YES_MOON_UP_THICKNESS / 2)),
+    .arc_in_r2 = dial_r2((int16_t)(ring_r - YES_MOON_UP_THICKNESS / 2 - 1)),
+    .solar_r2 = have_sun ? dial_r2((int16_t)(YES_FACE_R - YES_SOLAR_INSET)) : -1,
+    .day_r2 = dial_r2((int16_t)(YES_FACE_R - YES_NIGHT_INSET)),
+    .arc = dial_sweep_make(0, 0, false),
+    .day = dial_sweep_make(0, 0, false),
+    .moon_c = moon_c,
+    .moon_r = moon_r,
+    .col_base = col_base,
+    .col_up = col_up,
+    .col_night = col_night,
+    .col_day = col_day,
+  };
+  if (moon && moon->valid && !moon->always_down) {
+    d.arc = moon->always_up ? dial_sweep_make(0, 0, true)
+                            : dial_sweep_make(angle_from_local_minutes_24h(moon->moonrise_min),
+                                              angle_from_local_minutes_24h(moon->moonset_min), true);
+  }
+  bool top_is_night = false;
+  if (have_sun) {
+    if (sun->always_day) {
+      // Lit all the way out; the wedge otherwise stops just inside the disk edge.
+      d.day = dial_sweep_make(0, 0, true);
+      d.day_r2 = d.solar_r2;
+    } else if (sun->always_night) {
+      top_is_night = true;
+    } else {
+      const int32_t a_sunrise = angle_from_local_minutes_24h(sun->sunrise_min);
+      const int32_t a_sunset = angle_from_local_minutes_24h(sun->sunset_min);
+      d.day = dial_sweep_make(a_sunrise, a_sunset, false);
+      top_is_night = !angle_in_sweep(0, a_sunrise, a_sunset);
+    }
+  }
+  d.look = moon_look(moon_r, phase_e6, &d.moon_dx);
+  const int32_t outer_r2 = MAX(d.base_r2, d.up_r2);
+
+  const int16_t rows = gbitmap_get_bounds(fb).size.h;
+  for (int16_t y = 0; y < rows; y++) {
+    int16_t min_x = 0, max_x = 0;
+    uint8_t *row = fb_row_span(fb, y, &min_x, &max_x);
+    DialRow r = { .dy = y - c.y, .moon_hw = -1, .sh_x1 = 1, .sh_x2 = 0 };
+    r.dy2 = r.dy * r.dy;
+    if (r.dy2 > outer_r2) {
+      dial_row_fill(row, min_x, max_x, y, GColorBlack);
+      continue;
+    }
+
+    int16_t cuts[DIAL_MAX_CUTS];
+    int n = 0;
+    n = dial_cut_radius(cuts, n, c.x, d.base_r2, r.dy2);
+    n = dial_cut_radius(cuts, n, c.x, d.up_r2, r.dy2);
+    n = dial_cut_radius(cuts, n, c.x, d.arc_in_r2, r.dy2);
+    n = dial_cut_radius(cuts, n, c.x, d.solar_r2, r.dy2);
+    n = dial_cut_radius(cuts, n, c.x, d.day_r2, r.dy2);
+    n = dial_cut_sweep(cuts, n, c.x, &d.day, r.dy);
+    n = dial_cut_sweep(cuts, n, c.x, &d.arc, r.dy);
+    const int16_t my = (int16_t)(y - moon_c.y);
+    if (my >= -moon_r && my <= moon_r) {
+      r.moon_hw = half_chord(moon_r, my);
+      cuts[n++] = (int16_t)(moon_c.x - r.moon_hw);
+      cuts[n++] = (int16_t)(moon_c.x + r.moon_hw + 1);
+      if (d.look == MOON_LOOK_PARTIAL && moon_shadow_span(moon_r, d.moon_dx, my, &r.sh_x1, &r.sh_x2)) {
+        cuts[n++] = (int16_t)(moon_c.x + r.sh_x1);
+        cuts[n++] = (int16_t)(moon_c.x + r.sh_x2 + 1);
+      }
+    }
+    cuts[n++] = (int16_t)(max_x + 1);
+    for (int i = 1; i < n; i++) {
+      const int16_t v = cuts[i];
+      int j = i - 1;
+      while (j >= 0 && cuts[j] > v) {
+        cuts[j + 1] = cuts[j];
+        j--;
+      }
+      cuts[j + 1] = v;
+    }
+
+    int16_t x0 = min_x;
+    for (int i = 0; i < n && x0 <= max_x; i++) {
+      const int16_t x1 = MIN(cuts[i], (int16_t)(max_x + 1));
+      if (x1 <= x0) continue;
+      dial_row_fill(row, x0, (int16_t)(x1 - 1), y, dial_spans_px(&d, &r, x0));
+      x0 = x1;
+    }
+  }
+  graphics_release_frame_buffer(ctx, fb);
+  *out_top_is_night = top_is_night;
+  return true;
+}
+#endif
+
 #ifndef PBL_ROUND
+// Corner alternation period in seconds (configured cadence, normalised).
+static int corner_cycle_sec(int ui_update_interval_sec) {
+  return (ui_update_interval_sec == 10 || ui_update_interval_sec == 30 || ui_update_interval_sec == 60)
+    ? ui_update_interval_sec
+    : 5;
+}
+
+// First cycle boundary after now (when an alternating corner shows its next item).
+static time_t corner_cycle_next(time_t now, int ui_update_interval_sec) {
+  const int sec = corner_cycle_sec(ui_update_interval_sec);
+  return (now / sec + 1) * sec;
+}
+
+// Rotation step at now; low power pins every alternating corner to its first item.
+static time_t corner_cycle_index(const YesFaceState *st, time_t now) {
+  return st->low_power ? 0 : now / corner_cycle_sec(st->ui_update_interval_sec);
+}
+
+static time_t next_minute(time_t now) {
+  return (now / 60 + 1) * 60;
+}
+
+// Tide corner view: 0) progress ring, 1) minutes to next H/L, 2) current level + trend arrow.
+static int tide_view_mode(const YesFaceState *st, time_t now) {
+  return (int)(corner_cycle_index(st, now) % 3);
+}
+
 static void draw_tide_icon(GContext *ctx, GPoint origin, int16_t w, int16_t h, GColor col) {
   // Ocean wave glyph: two stacked sine-like waves.
   if (w < 8) w = 8;
@@ -344,11 +1094,11 @@ static void draw_tide_icon(GContext *ctx, GPoint origin, int16_t w, int16_t h, G
   }
 }
 
-static void draw_tide_clock(GContext *ctx, GRect bounds, int16_t face_r, int16_t corner_pad,
+static void draw_tide_clock(GContext *ctx, GRect bounds,
                             bool have_tide, int32_t tide_last_unix, int32_t tide_next_unix, bool tide_next_is_high,
                             int16_t tide_level_x10,
                             bool tide_level_is_ft,
-                            int ui_update_interval_sec,
+                            int mode,
                             GColor color_base, GColor color_prog, GColor color_text) {
   if (!have_tide) return;
   if (tide_last_unix <= 0 || tide_next_unix <= 0) return;
@@ -360,16 +1110,16 @@ static void draw_tide_clock(GContext *ctx, GRect bounds, int16_t face_r, int16_t
   if (t < 0) t = 0;
   if (t > span) t = span;
 
-  const int16_t r_path = scale_px(10, face_r);
-  const uint16_t stroke = (uint16_t)scale_px(2, face_r);
+  const int16_t r_path = YES_PX(10);
+  const uint16_t stroke = (uint16_t)YES_PX(2);
   const int16_t r_out = (int16_t)(r_path + (int16_t)(stroke / 2));
   const int16_t content_w = (int16_t)(2 * r_out);
-  const int16_t icon_w = scale_px(12, face_r);
-  const int16_t icon_h = scale_px(8, face_r);
-  const int16_t gap = scale_px(3, face_r);
+  const int16_t icon_w = YES_PX(12);
+  const int16_t icon_h = YES_PX(8);
+  const int16_t gap = YES_PX(3);
   // Fixed layout: [icon][gap][content box of width content_w] anchored to bottom-right.
-  const int16_t right = (int16_t)(bounds.origin.x + bounds.size.w - corner_pad);
-  const int16_t bottom = (int16_t)(bounds.origin.y + bounds.size.h - corner_pad);
+  const int16_t right = (int16_t)(bounds.origin.x + bounds.size.w - YES_CORNER_PAD);
+  const int16_t bottom = (int16_t)(bounds.origin.y + bounds.size.h - YES_CORNER_PAD);
   const int16_t content_x0 = (int16_t)(right - content_w);
   const int16_t content_y0 = (int16_t)(bottom - content_w);
   const int16_t icon_x0 = (int16_t)(content_x0 - gap - icon_w);
@@ -380,17 +1130,8 @@ static void draw_tide_clock(GContext *ctx, GRect bounds, int16_t face_r, int16_t
   const int16_t cy = (int16_t)(content_y0 + r_out);
   const GRect rect = GRect(cx - r_path, cy - r_path, (int16_t)(2 * r_path), (int16_t)(2 * r_path));
 
-  const int cycle_sec = (ui_update_interval_sec == 10 || ui_update_interval_sec == 30 || ui_update_interval_sec == 60)
-    ? ui_update_interval_sec
-    : 5;
-  // Cycle views on the configured corner update cadence.
-  // 0) progress ring, 1) minutes to next H/L, 2) current level + trend arrow.
-  const int mode = (int)((now / cycle_sec) % 3);
-
   graphics_context_set_text_color(ctx, color_text);
-  const GFont f_small = (MIN(bounds.size.w, bounds.size.h) >= 200)
-    ? fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD)
-    : fonts_get_system_font(FONT_KEY_GOTHIC_09);
+  const GFont f_small = fonts_get_system_font(YES_FONT_KEY_SMALL);
   const char *label = tide_next_is_high ? "H" : "L";
 
   const bool rising = tide_next_is_high;
@@ -448,23 +1189,19 @@ static void draw_tide_clock(GContext *ctx, GRect bounds, int16_t face_r, int16_t
     char time_buf[8];
     snprintf(time_buf, sizeof(time_buf), "%ld:%02ld", (long)hh, (long)mm);
 
-    const GFont f_lbl = (MIN(bounds.size.w, bounds.size.h) >= 200)
-      ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-    const GFont f_time = (MIN(bounds.size.w, bounds.size.h) >= 200)
-      ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+    const GFont f_lbl = fonts_get_system_font(YES_FONT_KEY_LABEL);
+    const GFont f_time = fonts_get_system_font(YES_FONT_KEY_LABEL);
 
     const int16_t block_w = (int16_t)(right - content_x0);
-    const int16_t lbl_h = scale_px(12, face_r);
-    const int16_t time_h = scale_px(14, face_r);
+    const int16_t lbl_h = YES_PX(12);
+    const int16_t time_h = YES_PX(14);
     const int16_t top_y = (int16_t)(bottom - (lbl_h + time_h));
     graphics_draw_text(ctx, label, f_lbl,
                        GRect(content_x0, top_y, block_w, lbl_h),
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentRight, NULL);
-    graphics_draw_text(ctx, time_buf, f_time,
-                       GRect(content_x0, (int16_t)(top_y + lbl_h - scale_px(1, face_r)), block_w, time_h),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentRight, NULL);
+    draw_num_text(ctx, time_buf, f_time,
+                  GRect(content_x0, (int16_t)(top_y + lbl_h - YES_PX(1)), block_w, time_h),
+                  GTextAlignmentRight, color_text);
     return;
   }
 
@@ -480,27 +1217,23 @@ static void draw_tide_clock(GContext *ctx, GRect bounds, int16_t face_r, int16_t
 
     const int16_t block_w = (int16_t)(right - content_x0);
 
-    const GFont f_lbl = (MIN(bounds.size.w, bounds.size.h) >= 200)
-      ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-    const GFont f_val = (MIN(bounds.size.w, bounds.size.h) >= 200)
-      ? fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD)
-      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+    const GFont f_lbl = fonts_get_system_font(YES_FONT_KEY_LABEL);
+    const GFont f_val = fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
 
     // Bottom-align the value using actual rendered height (matches weather temp style).
     const GSize val_sz = graphics_text_layout_get_content_size(
-      buf, f_val, GRect(0, 0, block_w, scale_px(24, face_r)),
+      buf, f_val, GRect(0, 0, block_w, YES_PX(24)),
       GTextOverflowModeTrailingEllipsis, GTextAlignmentRight
     );
     const int16_t val_h = (int16_t)val_sz.h;
     const int16_t val_y = (int16_t)(bottom - val_h);
 
     const GSize lbl_sz = graphics_text_layout_get_content_size(
-      label, f_lbl, GRect(0, 0, block_w, scale_px(24, face_r)),
+      label, f_lbl, GRect(0, 0, block_w, YES_PX(24)),
       GTextOverflowModeTrailingEllipsis, GTextAlignmentRight
     );
     const int16_t lbl_h = (int16_t)lbl_sz.h;
-    const int16_t lbl_y = (int16_t)(val_y - lbl_h + scale_px(1, face_r));
+    const int16_t lbl_y = (int16_t)(val_y - lbl_h + YES_PX(1));
 
     // Trend arrow (triangle) in the label line (left), and L/H on the right.
     int16_t s = (int16_t)(r_path / 4);
@@ -667,64 +1400,53 @@ static int16_t weather_icon_extra_bottom(uint8_t code, int16_t s) {
 typedef struct {
   GContext *ctx;
   GRect bounds;
-  int16_t face_r;
-  int16_t corner_pad;
   GColor color_txt;
   GColor color_base;
   GColor color_prog;
 
   // Shared state needed by corner complications
-  bool have_tide;
-  int32_t tide_last_unix;
-  int32_t tide_next_unix;
-  bool tide_next_is_high;
-  int16_t tide_level_x10;
-  bool tide_level_is_ft;
-
-  bool alt_valid;
-  int32_t alt_m;
-  bool alt_is_ft;
-
-  bool have_weather;
-  int16_t weather_temp_c10;
-  uint8_t weather_code;
-  bool weather_is_day;
-  bool weather_is_f;
-  int16_t weather_wind_spd_x10;
-  int16_t weather_wind_dir_deg;
-  int16_t weather_precip_x10;
-  int16_t weather_uv_x10;
-  int16_t weather_pressure_hpa_x10;
-
-  bool battery_alert;
-  uint8_t battery_percent;
-
-  bool have_phase;
-  int32_t moon_phase_e6;
-
-  const GeoLoc *loc;
-  const SunTimes *sun_times;
-  const MoonTimes *moon_times;
-
-  int min_dim;
-  int ui_update_interval_sec;
+  const YesFaceState *st;
 } CornerCtx;
 
 typedef bool (*CornerAvailFn)(const CornerCtx *c);
 typedef void (*CornerDrawFn)(const CornerCtx *c);
+// Signature of everything the comp would currently put on screen; equal values mean an
+// identical repaint, so the slot does not need a redraw.
+typedef uint32_t (*CornerSigFn)(const CornerCtx *c);
+// Next time > now at which the comp's own content changes with no new data (countdowns, views).
+// NULL means it only changes when its inputs do, which already triggers a redraw.
+typedef time_t (*CornerNextFn)(const CornerCtx *c, time_t now);
 
 // Generic "slot" helper: if any exclusive comp is available, show the first such comp.
 // Otherwise, cycle through all available comps on the configured update cadence.
 typedef struct {
   CornerAvailFn avail;
   CornerDrawFn draw;
+  CornerSigFn sig;
+  CornerNextFn next;
   bool exclusive;
 } SlotComp;
 
-static int slot_pick_index(const SlotComp *comps, int count, const CornerCtx *c, time_t now) {
+// Per-slot signatures of the last drawn corner frame (see yes_draw_corners).
+enum {
+  CORNER_SLOT_TOP_LEFT = 0,
+  CORNER_SLOT_TOP_RIGHT,
+  CORNER_SLOT_BOTTOM_LEFT,
+  CORNER_SLOT_BOTTOM_RIGHT,
+  CORNER_SLOT_COUNT,
+};
+static uint32_t s_corner_sig[CORNER_SLOT_COUNT];
+static bool s_corner_sig_valid;
+
+// out_n (optional) receives how many comps take turns in the slot (1 for an exclusive pick).
+static int slot_pick_index(const SlotComp *comps, int count, const CornerCtx *c, time_t now, int *out_n) {
+  if (out_n) *out_n = 0;
   // Exclusive-first
   for (int i = 0; i < count; i++) {
-    if (comps[i].exclusive && (!comps[i].avail || comps[i].avail(c))) return i;
+    if (comps[i].exclusive && (!comps[i].avail || comps[i].avail(c))) {
+      if (out_n) *out_n = 1;
+      return i;
+    }
   }
   // Cycle among available
   int idxs[12];
@@ -732,21 +1454,51 @@ static int slot_pick_index(const SlotComp *comps, int count, const CornerCtx *c,
   for (int i = 0; i < count && n < (int)(sizeof(idxs) / sizeof(idxs[0])); i++) {
     if (!comps[i].avail || comps[i].avail(c)) idxs[n++] = i;
   }
+  if (out_n) *out_n = n;
   if (n <= 0) return -1;
-  const int cycle_sec = (c->ui_update_interval_sec == 10 || c->ui_update_interval_sec == 30 || c->ui_update_interval_sec == 60)
-    ? c->ui_update_interval_sec
-    : 5;
-  const int k = (int)((now / cycle_sec) % (time_t)n);
+  const int k = (int)(corner_cycle_index(c->st, now) % (time_t)n);
   return idxs[k];
 }
 
+// Picks the slot's comp, optionally draws it, and returns the slot signature.
+static uint32_t slot_run(const SlotComp *comps, int count, const CornerCtx *c, time_t now) {
+  const int which = slot_pick_index(comps, count, c, now, NULL);
+  if (which < 0) return 0;
+  if (c->ctx) comps[which].draw(c);
+  const uint32_t h = sig_mix(SIG_SEED, which + 1);
+  return comps[which].sig ? sig_mix(h, (int32_t)comps[which].sig(c)) : h;
+}
+
+// Next time > now the slot shows something else: its rotation advances or the shown comp changes.
+// 0 when neither happens on its own.
+static time_t slot_next_change(const SlotComp *comps, int count, const CornerCtx *c, time_t now) {
+  int n = 0;
+  const int which = slot_pick_index(comps, count, c, now, &n);
+  if (which < 0) return 0;
+  time_t t = (n > 1) ? corner_cycle_next(now, c->st->ui_update_interval_sec) : 0;
+  if (comps[which].next) {
+    const time_t tc = comps[which].next(c, now);
+    if (tc && (!t || tc < t)) t = tc;
+  }
+  return t;
+}
+
+static bool tr_show_weekday(const CornerCtx *c, time_t now) {
+  return (corner_cycle_index(c->st, now) % 2) != 0;
+}
+
+static uint32_t tr_sig_date(const CornerCtx *c) {
+  struct tm tm_loc;
+  if (!yes_local_tm_now(c->st->loc, &tm_loc, NULL)) return 0;
+  uint32_t h = sig_mix(SIG_SEED, tm_loc.tm_year * 400 + tm_loc.tm_yday);
+  return sig_mix(h, tr_show_weekday(c, time(NULL)) ? 1 : 0);
+}
+
 static void draw_top_right_date(const CornerCtx *c) {
-  const int16_t pad = c->corner_pad;
-  const int16_t h = (c->min_dim >= 200) ? scale_px(24, c->face_r) : scale_px(20, c->face_r);
-  const GFont f_date = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                          : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-  const GFont f_detail = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                            : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+  const int16_t pad = YES_CORNER_PAD;
+  const int16_t h = YES_CORNER_LINE_H;
+  const GFont f_date = fonts_get_system_font(YES_FONT_KEY_LABEL);
+  const GFont f_detail = fonts_get_system_font(YES_FONT_KEY_LABEL);
   char date_buf[16];
   char year_buf[8];
   char weekday_buf[3];
@@ -755,7 +1507,7 @@ static void draw_top_right_date(const CornerCtx *c) {
   weekday_buf[0] = '\0';
 
   struct tm tm_loc;
-  if (yes_local_tm_now(c->loc, &tm_loc, NULL)) {
+  if (yes_local_tm_now(c->st->loc, &tm_loc, NULL)) {
     strftime(date_buf, sizeof(date_buf), "%b %e", &tm_loc);
     strftime(year_buf, sizeof(year_buf), "%Y", &tm_loc);
     if (tm_loc.tm_wday >= 0 && tm_loc.tm_wday < 7) {
@@ -765,13 +1517,10 @@ static void draw_top_right_date(const CornerCtx *c) {
     strcpy(date_buf, "--");
   }
 
-  const int cycle_sec = (c->ui_update_interval_sec == 10 || c->ui_update_interval_sec == 30 || c->ui_update_interval_sec == 60)
-    ? c->ui_update_interval_sec
-    : 5;
-  const bool show_weekday = weekday_buf[0] && (((time(NULL) / cycle_sec) % 2) != 0);
+  const bool show_weekday = weekday_buf[0] && tr_show_weekday(c, time(NULL));
   const char *detail = show_weekday ? weekday_buf : year_buf;
 
-  const int16_t detail_h = (c->min_dim >= 200) ? scale_px(20, c->face_r) : scale_px(18, c->face_r);
+  const int16_t detail_h = YES_LAYOUT_BIG ? YES_PX(20) : YES_PX(18);
   const int16_t max_w = (int16_t)(c->bounds.size.w / 2 - pad);
   const GSize date_sz = graphics_text_layout_get_content_size(
     date_buf, f_date, GRect(0, 0, max_w, h),
@@ -785,18 +1534,18 @@ static void draw_top_right_date(const CornerCtx *c) {
     weekday_buf, f_detail, GRect(0, 0, max_w, detail_h),
     GTextOverflowModeTrailingEllipsis, GTextAlignmentRight
   );
-  const int16_t pad_px = scale_px(2, c->face_r);
+  const int16_t pad_px = YES_PX(2);
   int16_t date_w = (int16_t)(date_sz.w + pad_px);
   int16_t detail_w = (int16_t)(MAX(year_sz.w, weekday_sz.w) + pad_px);
   if (date_w > max_w) date_w = max_w;
   if (detail_w > max_w) detail_w = max_w;
-  const int16_t detail_nudge_up = scale_px(2, c->face_r);
-  const int16_t detail_nudge_right = scale_px(2, c->face_r);
+  const int16_t detail_nudge_up = YES_PX(2);
+  const int16_t detail_nudge_right = YES_PX(2);
   const int16_t right = (int16_t)(c->bounds.size.w - pad);
   const int16_t detail_right = (int16_t)(right + detail_nudge_right);
   const int16_t date_x = (int16_t)(right - date_w);
   const int16_t detail_x = (int16_t)(detail_right - detail_w);
-  const int16_t detail_y = (int16_t)(pad + h - scale_px(4, c->face_r) - detail_nudge_up);
+  const int16_t detail_y = (int16_t)(pad + h - YES_PX(4) - detail_nudge_up);
 
   graphics_context_set_fill_color(c->ctx, GColorBlack);
   graphics_fill_rect(c->ctx, GRect(date_x, pad, date_w, h), 0, GCornerNone);
@@ -809,22 +1558,21 @@ static void draw_top_right_date(const CornerCtx *c) {
                      GRect(date_x, pad, date_w, h),
                      GTextOverflowModeTrailingEllipsis, GTextAlignmentRight, NULL);
   if (detail && detail[0]) {
-    graphics_draw_text(c->ctx, detail, f_detail,
-                       GRect(detail_x, detail_y, detail_w, detail_h),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentRight, NULL);
+    draw_num_text(c->ctx, detail, f_detail, GRect(detail_x, detail_y, detail_w, detail_h),
+                  GTextAlignmentRight, c->color_txt);
   }
 }
 
 // --- Bottom-right complication implementations (tide absent) ---
-static bool br_avail_alt(const CornerCtx *c) { return c->alt_valid; }
-static bool br_avail_sun(const CornerCtx *c) { return c->sun_times && c->sun_times->valid; }
-static bool br_avail_moon(const CornerCtx *c) { return c->moon_times && c->moon_times->valid; }
-static bool br_avail_age(const CornerCtx *c) { return c->have_phase; }
+static bool br_avail_alt(const CornerCtx *c) { return c->st->alt.valid; }
+static bool br_avail_sun(const CornerCtx *c) { return c->st->sun && c->st->sun->valid; }
+static bool br_avail_moon(const CornerCtx *c) { return c->st->moon && c->st->moon->valid; }
+static bool br_avail_age(const CornerCtx *c) { return c->st->have_phase; }
 
 static int br_compute_now_min(const CornerCtx *c) {
   int now_min = -1;
   struct tm tm_loc;
-  if (yes_local_tm_now(c->loc, &tm_loc, &now_min)) return now_min;
+  if (yes_local_tm_now(c->st->loc, &tm_loc, &now_min)) return now_min;
   return -1;
 }
 
@@ -843,14 +1591,18 @@ static int minutes_until_circular(int from_minute, int to_minute) {
   return (to_minute - from_minute + 1440) % 1440;
 }
 
+static uint32_t br_sig_alt(const CornerCtx *c) {
+  return sig_mix(sig_mix(SIG_SEED, c->st->alt.m), c->st->alt.is_ft ? 1 : 0);
+}
+
 static void br_draw_alt(const CornerCtx *c) {
-  const int16_t pad = c->corner_pad;
+  const int16_t pad = YES_CORNER_PAD;
   const int16_t right = (int16_t)(c->bounds.origin.x + c->bounds.size.w - pad);
   const int16_t bottom = (int16_t)(c->bounds.origin.y + c->bounds.size.h - pad);
-  const int16_t icon_w = scale_px(12, c->face_r);
-  const int16_t icon_h = scale_px(10, c->face_r);
-  const int16_t gap = scale_px(3, c->face_r);
-  const int16_t icon_x0 = (int16_t)(right - icon_w - gap - scale_px(36, c->face_r));
+  const int16_t icon_w = YES_PX(12);
+  const int16_t icon_h = YES_PX(10);
+  const int16_t gap = YES_PX(3);
+  const int16_t icon_x0 = (int16_t)(right - icon_w - gap - YES_PX(36));
   const int16_t icon_y0 = (int16_t)(bottom - icon_h);
   graphics_context_set_stroke_color(c->ctx, c->color_txt);
   graphics_context_set_stroke_width(c->ctx, 1);
@@ -865,14 +1617,13 @@ static void br_draw_alt(const CornerCtx *c) {
   graphics_draw_line(c->ctx, a2, b2);
   graphics_draw_line(c->ctx, b2, c3);
 
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-  int32_t v = c->alt_m;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
+  int32_t v = c->st->alt.m;
   const bool neg = (v < 0);
   if (v < 0) v = -v;
   int32_t disp = v;
   const char *unit = "m";
-  if (c->alt_is_ft) {
+  if (c->st->alt.is_ft) {
     disp = (int32_t)((v * 3281 + 500) / 1000);
     unit = "ft";
   }
@@ -882,7 +1633,7 @@ static void br_draw_alt(const CornerCtx *c) {
   const int16_t text_x = (int16_t)(icon_x0 + icon_w + gap);
   const int16_t text_w = (int16_t)(right - text_x);
   const GSize tsz = graphics_text_layout_get_content_size(
-    abuf, f, GRect(0, 0, text_w, scale_px(24, c->face_r)),
+    abuf, f, GRect(0, 0, text_w, YES_PX(24)),
     GTextOverflowModeTrailingEllipsis, GTextAlignmentRight
   );
   const int16_t th = (int16_t)tsz.h;
@@ -894,15 +1645,14 @@ static void br_draw_alt(const CornerCtx *c) {
 }
 
 static void br_draw_corner_single_line(const CornerCtx *c, const char *text) {
-  const int16_t pad = c->corner_pad;
+  const int16_t pad = YES_CORNER_PAD;
   const int16_t right = (int16_t)(c->bounds.origin.x + c->bounds.size.w - pad);
   const int16_t bottom = (int16_t)(c->bounds.origin.y + c->bounds.size.h - pad);
   const int16_t w = (int16_t)(c->bounds.size.w / 2);
   const int16_t x0 = (int16_t)(right - w);
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
   const GSize tsz = graphics_text_layout_get_content_size(
-    text, f, GRect(0, 0, w, scale_px(24, c->face_r)),
+    text, f, GRect(0, 0, w, YES_PX(24)),
     GTextOverflowModeTrailingEllipsis, GTextAlignmentRight
   );
   const int16_t th = (int16_t)tsz.h;
@@ -914,17 +1664,16 @@ static void br_draw_corner_single_line(const CornerCtx *c, const char *text) {
 }
 
 static void br_draw_corner_countdown(const CornerCtx *c, const char *label, const char *time_line) {
-  const int16_t pad = c->corner_pad;
+  const int16_t pad = YES_CORNER_PAD;
   const int16_t right = (int16_t)(c->bounds.origin.x + c->bounds.size.w - pad);
   const int16_t bottom = (int16_t)(c->bounds.origin.y + c->bounds.size.h - pad);
   const int16_t w = (int16_t)(c->bounds.size.w / 2);
   const int16_t x0 = (int16_t)(right - w);
-  const GFont f_lbl = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                          : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+  const GFont f_lbl = fonts_get_system_font(YES_FONT_KEY_LABEL);
   const GFont f_time = f_lbl;
-  const int16_t lbl_h = scale_px(12, c->face_r);
-  const int16_t time_h = scale_px(14, c->face_r);
-  const int16_t label_lift = scale_px(2, c->face_r);
+  const int16_t lbl_h = YES_PX(12);
+  const int16_t time_h = YES_PX(14);
+  const int16_t label_lift = YES_PX(2);
   const int16_t top_y = (int16_t)(bottom - (lbl_h + time_h));
   const int16_t label_y = (int16_t)(top_y - label_lift);
 
@@ -933,25 +1682,35 @@ static void br_draw_corner_countdown(const CornerCtx *c, const char *label, cons
                      GRect(x0, label_y, w, lbl_h),
                      GTextOverflowModeTrailingEllipsis, GTextAlignmentRight, NULL);
   graphics_draw_text(c->ctx, time_line, f_time,
-                     GRect(x0, (int16_t)(top_y + lbl_h - scale_px(1, c->face_r)), w, time_h),
+                     GRect(x0, (int16_t)(top_y + lbl_h - YES_PX(1)), w, time_h),
                      GTextOverflowModeTrailingEllipsis, GTextAlignmentRight, NULL);
 }
 
+static uint32_t br_sig_sun_cd(const CornerCtx *c) {
+  return sig_mix(hash_sun(SIG_SEED, c->st->sun), br_compute_now_min(c));
+}
+
+// Countdowns and step counts move in whole minutes.
+static time_t next_minute_cb(const CornerCtx *c, time_t now) {
+  (void)c;
+  return next_minute(now);
+}
+
 static void br_draw_sun_cd(const CornerCtx *c) {
   const int now_min = br_compute_now_min(c);
 
-  if (c->sun_times->always_day) {
+  if (c->st->sun->always_day) {
     br_draw_corner_single_line(c, yes_i18n_text(YES_TEXT_SUN_DAY));
     return;
   }
-  if (c->sun_times->always_night) {
+  if (c->st->sun->always_night) {
     br_draw_corner_single_line(c, yes_i18n_text(YES_TEXT_SUN_NIGHT));
     return;
   }
   if (now_min < 0) return;
 
-  const int sr = c->sun_times->sunrise_min;
-  const int ss = c->sun_times->sunset_min;
+  const int sr = c->st->sun->sunrise_min;
+  const int ss = c->st->sun->sunset_min;
   const bool is_day = minute_in_circular_interval(now_min, sr, ss);
   const char *lab = is_day ? "SS" : "SR";
   const int dmin = minutes_until_circular(now_min, is_day ? ss : sr);
@@ -962,21 +1721,25 @@ static void br_draw_sun_cd(const CornerCtx *c) {
   br_draw_corner_countdown(c, lab, time_buf);
 }
 
+static uint32_t br_sig_moon_cd(const CornerCtx *c) {
+  return sig_mix(hash_moon(SIG_SEED, c->st->moon), br_compute_now_min(c));
+}
+
 static void br_draw_moon_cd(const CornerCtx *c) {
   const int now_min = br_compute_now_min(c);
 
-  if (c->moon_times->always_up) {
+  if (c->st->moon->always_up) {
     br_draw_corner_single_line(c, yes_i18n_text(YES_TEXT_MOON_UP));
     return;
   }
-  if (c->moon_times->always_down) {
+  if (c->st->moon->always_down) {
     br_draw_corner_single_line(c, yes_i18n_text(YES_TEXT_MOON_DOWN));
     return;
   }
   if (now_min < 0) return;
 
-  const int mr = c->moon_times->moonrise_min;
-  const int ms = c->moon_times->moonset_min;
+  const int mr = c->st->moon->moonrise_min;
+  const int ms = c->st->moon->moonset_min;
   int d_mr = (mr >= now_min) ? (mr - now_min) : ((1440 - now_min) + mr);
   int d_ms = (ms >= now_min) ? (ms - now_min) : ((1440 - now_min) + ms);
   const bool next_is_mr = (d_mr <= d_ms);
@@ -988,25 +1751,31 @@ static void br_draw_moon_cd(const CornerCtx *c) {
   br_draw_corner_countdown(c, next_is_mr ? "MR" : "MS", time_buf);
 }
 
+static int32_t moon_age_days_x10(int32_t moon_phase_e6) {
+  const int32_t days_x10000 = (int32_t)(((int64_t)moon_phase_e6 * 295306LL + 500000LL) / 1000000LL);
+  return (days_x10000 + 500) / 1000;
+}
+
+static uint32_t br_sig_moon_age(const CornerCtx *c) {
+  return sig_mix(SIG_SEED, moon_age_days_x10(c->st->moon_phase_e6));
+}
+
 static void br_draw_moon_age(const CornerCtx *c) {
-  const int16_t pad = c->corner_pad;
+  const int16_t pad = YES_CORNER_PAD;
   const int16_t right = (int16_t)(c->bounds.origin.x + c->bounds.size.w - pad);
   const int16_t bottom = (int16_t)(c->bounds.origin.y + c->bounds.size.h - pad);
   const int16_t w = (int16_t)(c->bounds.size.w / 2);
   const int16_t x0 = (int16_t)(right - w);
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-  const GFont f_small = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD)
-                                            : fonts_get_system_font(FONT_KEY_GOTHIC_09);
-  const int32_t days_x10000 = (int32_t)(((int64_t)c->moon_phase_e6 * 295306LL + 500000LL) / 1000000LL);
-  const int32_t days_x10 = (days_x10000 + 500) / 1000;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
+  const GFont f_small = fonts_get_system_font(YES_FONT_KEY_SMALL);
+  const int32_t days_x10 = moon_age_days_x10(c->st->moon_phase_e6);
   const int d = (int)(days_x10 / 10);
   const int frac = (int)(days_x10 % 10);
   char buf[24];
   snprintf(buf, sizeof(buf), "%s %d.%dd", yes_i18n_text(YES_TEXT_AGE), d, frac);
 
   const GSize tsz = graphics_text_layout_get_content_size(
-    buf, f, GRect(0, 0, w, scale_px(24, c->face_r)),
+    buf, f, GRect(0, 0, w, YES_PX(24)),
     GTextOverflowModeTrailingEllipsis, GTextAlignmentRight
   );
   const int16_t th = (int16_t)tsz.h;
@@ -1019,11 +1788,11 @@ static void br_draw_moon_age(const CornerCtx *c) {
   // Clarify what "Age" refers to (moon phase age).
   const char *title = yes_i18n_text(YES_TEXT_MOON);
   const GSize tsz2 = graphics_text_layout_get_content_size(
-    title, f_small, GRect(0, 0, w, scale_px(16, c->face_r)),
+    title, f_small, GRect(0, 0, w, YES_PX(16)),
     GTextOverflowModeTrailingEllipsis, GTextAlignmentRight
   );
   const int16_t th2 = (int16_t)tsz2.h;
-  const int16_t gap = scale_px(1, c->face_r);
+  const int16_t gap = YES_PX(1);
   int16_t ty2 = (int16_t)(ty - gap - th2);
   if (ty2 < 0) ty2 = 0;
   graphics_draw_text(c->ctx, title, f_small,
@@ -1031,41 +1800,71 @@ static void br_draw_moon_age(const CornerCtx *c) {
                      GTextOverflowModeTrailingEllipsis, GTextAlignmentRight, NULL);
 }
 
-static bool br_avail_tide(const CornerCtx *c) { return c->have_tide; }
+static bool br_avail_tide(const CornerCtx *c) { return c->st->tide.valid; }
+static uint32_t br_sig_tide(const CornerCtx *c) {
+  const time_t now = time(NULL);
+  const int mode = tide_view_mode(c->st, now);
+  uint32_t h = sig_mix(SIG_SEED, mode);
+  h = sig_mix(h, c->st->tide.next_is_high ? 1 : 0);
+  h = sig_mix(h, c->st->tide.last_unix);
+  h = sig_mix(h, c->st->tide.next_unix);
+  if (mode == 2) {
+    h = sig_mix(h, c->st->tide.level_x10);
+    return sig_mix(h, c->st->tide.level_is_ft ? 1 : 0);
+  }
+  // Ring progress and countdown both move in whole minutes at most.
+  return sig_mix(h, (int32_t)(now / 60));
+}
+static time_t br_next_tide(const CornerCtx *c, time_t now) {
+  // Views rotate on the cadence; ring and countdown views also tick each minute.
+  const time_t t_view = corner_cycle_next(now, c->st->ui_update_interval_sec);
+  if (tide_view_mode(c->st, now) == 2) return t_view;
+  const time_t t_min = next_minute(now);
+  return (t_min < t_view) ? t_min : t_view;
+}
 static void br_draw_tide(const CornerCtx *c) {
-  draw_tide_clock(c->ctx, c->bounds, c->face_r, c->corner_pad,
-                  c->have_tide, c->tide_last_unix, c->tide_next_unix, c->tide_next_is_high,
-                  c->tide_level_x10, c->tide_level_is_ft, c->ui_update_interval_sec,
+  draw_tide_clock(c->ctx, c->bounds,
+                  c->st->tide.valid, c->st->tide.last_unix, c->st->tide.next_unix, c->st->tide.next_is_high,
+                  c->st->tide.level_x10, c->st->tide.level_is_ft,
+                  tide_view_mode(c->st, time(NULL)),
                   c->color_base, c->color_prog, c->color_txt);
 }
 
 static bool tl_avail_bt(const CornerCtx *c) { (void)c; return !bluetooth_connection_service_peek(); }
+static uint32_t tl_sig_bt(const CornerCtx *c) { (void)c; return SIG_SEED; }
 static void tl_draw_bt(const CornerCtx *c) {
-  const int16_t pad = c->corner_pad;
-  const int16_t h = (c->min_dim >= 200) ? scale_px(24, c->face_r) : scale_px(20, c->face_r);
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+  const int16_t pad = YES_CORNER_PAD;
+  const int16_t h = YES_CORNER_LINE_H;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
   graphics_context_set_text_color(c->ctx, c->color_txt);
   graphics_draw_text(c->ctx, "BT", f,
                      GRect(pad, pad, c->bounds.size.w / 2, h),
                      GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
 }
 
-static int tl_steps_count_cached(void) {
-  // Health calls can be surprisingly expensive on some platforms; cache at most once per minute.
-  static int s_steps_cached = -1;
-  static time_t s_steps_cached_at = 0;
+#endif
+
+// Health calls can be surprisingly expensive on some platforms; cache at most once per minute.
+// STEPS_PENDING until the app's first yes_draw_refresh_steps().
+#define STEPS_PENDING (-2)
+static int s_steps_cached = STEPS_PENDING;
+static time_t s_steps_cached_at;
+
+void yes_draw_refresh_steps(void) {
   const time_t now = time(NULL);
-  if (s_steps_cached_at == 0 || (now - s_steps_cached_at) >= 60) {
-    int steps = -1;
-    const time_t t0 = time_start_of_today();
-    const HealthServiceAccessibilityMask m = health_service_metric_accessible(HealthMetricStepCount, t0, now);
-    if ((m & HealthServiceAccessibilityMaskAvailable) != 0) {
-      steps = (int)health_service_sum_today(HealthMetricStepCount);
-    }
-    s_steps_cached = steps;
-    s_steps_cached_at = now;
+  int steps = -1;
+  const time_t t0 = time_start_of_today();
+  const HealthServiceAccessibilityMask m = health_service_metric_accessible(HealthMetricStepCount, t0, now);
+  if ((m & HealthServiceAccessibilityMaskAvailable) != 0) {
+    steps = (int)health_service_sum_today(HealthMetricStepCount);
   }
+  s_steps_cached = steps;
+  s_steps_cached_at = now;
+}
+
+#ifndef PBL_ROUND
+static int tl_steps_count_cached(void) {
+  if (s_steps_cached != STEPS_PENDING && (time(NULL) - s_steps_cached_at) >= 60) yes_draw_refresh_steps();
   return s_steps_cached;
 }
 
@@ -1075,35 +1874,43 @@ static bool tl_have_steps(void) {
 
 static bool tl_avail_batt(const CornerCtx *c) {
   if (!bluetooth_connection_service_peek()) return false;
-  if (c->battery_alert) return true;
-  return !tl_have_steps();
+  if (c->st->battery_alert) return true;
+  // Battery only fills in for missing steps, so wait until steps are known.
+  return tl_steps_count_cached() != STEPS_PENDING && !tl_have_steps();
 }
 
 static bool tl_avail_steps(const CornerCtx *c) {
   return bluetooth_connection_service_peek() && tl_have_steps();
 }
 
+static uint32_t tl_sig_batt(const CornerCtx *c) {
+  return sig_mix(SIG_SEED, c->st->battery_percent);
+}
+
+static uint32_t tl_sig_steps(const CornerCtx *c) {
+  (void)c;
+  return sig_mix(SIG_SEED, tl_steps_count_cached());
+}
+
 static void tl_draw_batt(const CornerCtx *c) {
-  const int16_t pad = c->corner_pad;
-  const int16_t h = (c->min_dim >= 200) ? scale_px(24, c->face_r) : scale_px(20, c->face_r);
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+  const int16_t pad = YES_CORNER_PAD;
+  const int16_t h = YES_CORNER_LINE_H;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
   char buf[16];
-  snprintf(buf, sizeof(buf), "%d%%", (int)c->battery_percent);
+  snprintf(buf, sizeof(buf), "%d%%", (int)c->st->battery_percent);
   graphics_context_set_text_color(c->ctx, c->color_txt);
-  const int16_t icon_s = scale_px(14, c->face_r);
+  const int16_t icon_s = YES_PX(14);
   draw_battery_icon(c->ctx, GPoint((int16_t)(pad + icon_s / 2), (int16_t)(pad + h / 2)),
-                    icon_s, c->battery_percent, c->color_txt);
-  graphics_draw_text(c->ctx, buf, f,
-                     GRect((int16_t)(pad + scale_px(15, c->face_r)), pad, c->bounds.size.w / 2, h),
-                     GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+                    icon_s, c->st->battery_percent, c->color_txt);
+  draw_num_text(c->ctx, buf, f,
+                GRect((int16_t)(pad + YES_PX(15)), pad, c->bounds.size.w / 2, h),
+                GTextAlignmentLeft, c->color_txt);
 }
 
 static void tl_draw_steps(const CornerCtx *c) {
-  const int16_t pad = c->corner_pad;
-  const int16_t h = (c->min_dim >= 200) ? scale_px(24, c->face_r) : scale_px(20, c->face_r);
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
+  const int16_t pad = YES_CORNER_PAD;
+  const int16_t h = YES_CORNER_LINE_H;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
   const int steps = tl_steps_count_cached();
   char buf[16];
   if (steps >= 10000) {
@@ -1112,27 +1919,39 @@ static void tl_draw_steps(const CornerCtx *c) {
     snprintf(buf, sizeof(buf), "%d", steps);
   }
   graphics_context_set_text_color(c->ctx, c->color_txt);
-  const int16_t icon_s = scale_px(14, c->face_r);
+  const int16_t icon_s = YES_PX(14);
   draw_steps_icon(c->ctx, GPoint((int16_t)(pad + icon_s / 2), (int16_t)(pad + h / 2)), icon_s, c->color_txt);
-  graphics_draw_text(c->ctx, buf, f,
-                     GRect((int16_t)(pad + scale_px(15, c->face_r)), pad, c->bounds.size.w / 2, h),
-                     GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+  draw_num_text(c->ctx, buf, f,
+                GRect((int16_t)(pad + YES_PX(15)), pad, c->bounds.size.w / 2, h),
+                GTextAlignmentLeft, c->color_txt);
 }
 
 // --- Weather slot (bottom-left) ---
-static bool wx_avail_temp(const CornerCtx *c) { return c->have_weather; }
-static bool wx_avail_wind(const CornerCtx *c) { return c->have_weather && c->weather_wind_spd_x10 != 0; }
-static bool wx_avail_precip(const CornerCtx *c) { return c->have_weather && c->weather_precip_x10 != 0; }
-static bool wx_avail_uv(const CornerCtx *c) { return c->have_weather && c->weather_uv_x10 > 0; }
-static bool wx_avail_p(const CornerCtx *c) { return c->have_weather && c->weather_pressure_hpa_x10 != 0; }
+static bool wx_avail_temp(const CornerCtx *c) { return c->st->weather.valid; }
+static bool wx_avail_wind(const CornerCtx *c) { return c->st->weather.valid && c->st->weather.wind_spd_x10 != 0; }
+static bool wx_avail_precip(const CornerCtx *c) { return c->st->weather.valid && c->st->weather.precip_x10 != 0; }
+static bool wx_avail_uv(const CornerCtx *c) { return c->st->weather.valid && c->st->weather.uv_x10 > 0; }
+static bool wx_avail_p(const CornerCtx *c) { return c->st->weather.valid && c->st->weather.pressure_hpa_x10 != 0; }
+
+static uint32_t wx_sig_base(const CornerCtx *c) {
+  uint32_t h = sig_mix(SIG_SEED, c->st->weather.code);
+  return sig_mix(h, c->st->weather.is_f ? 1 : 0);
+}
+static uint32_t wx_sig_temp(const CornerCtx *c) { return sig_mix(wx_sig_base(c), c->st->weather.temp_c10); }
+static uint32_t wx_sig_wind(const CornerCtx *c) {
+  return sig_mix(sig_mix(wx_sig_base(c), c->st->weather.wind_spd_x10), c->st->weather.wind_dir_deg);
+}
+static uint32_t wx_sig_precip(const CornerCtx *c) { return sig_mix(wx_sig_base(c), c->st->weather.precip_x10); }
+static uint32_t wx_sig_uv(const CornerCtx *c) { return sig_mix(wx_sig_base(c), c->st->weather.uv_x10); }
+static uint32_t wx_sig_p(const CornerCtx *c) { return sig_mix(wx_sig_base(c), c->st->weather.pressure_hpa_x10); }
 
 static void wx_draw_common(const CornerCtx *c, const char *text, GFont f_use) {
-  const int16_t pad = c->corner_pad;
-  const int16_t icon_s = scale_px(16, c->face_r);
-  const int16_t corner_bottom = (int16_t)(c->bounds.size.h - c->corner_pad);
-  const int16_t extra = weather_icon_extra_bottom(c->weather_code, icon_s);
+  const int16_t pad = YES_CORNER_PAD;
+  const int16_t icon_s = YES_PX(16);
+  const int16_t corner_bottom = (int16_t)(c->bounds.size.h - YES_CORNER_PAD);
+  const int16_t extra = weather_icon_extra_bottom(c->st->weather.code, icon_s);
 
-  const int16_t h = (c->min_dim >= 200) ? scale_px(24, c->face_r) : scale_px(20, c->face_r);
+  const int16_t h = YES_CORNER_LINE_H;
   const int16_t text_w = (int16_t)(c->bounds.size.w / 2 - pad);
   const GSize text_sz = graphics_text_layout_get_content_size(
     text, f_use, GRect(0, 0, text_w, h),
@@ -1143,10 +1962,10 @@ static void wx_draw_common(const CornerCtx *c, const char *text, GFont f_use) {
   int16_t text_top = (int16_t)(corner_bottom - text_h);
   if (text_top < 0) text_top = 0;
 
-  const int16_t gap = scale_px(2, c->face_r);
+  const int16_t gap = YES_PX(2);
   const int16_t cy = (int16_t)(text_top - gap - extra - (icon_s / 2));
   const GPoint ic = GPoint((int16_t)(pad + icon_s / 2), cy);
-  draw_weather_icon(c->ctx, ic, icon_s, c->weather_code, c->weather_is_day, c->color_txt);
+  draw_weather_icon(c->ctx, ic, icon_s, c->st->weather.code, c->st->weather.is_day, c->color_txt);
 
   graphics_context_set_text_color(c->ctx, c->color_txt);
   graphics_draw_text(c->ctx, text, f_use,
@@ -1155,10 +1974,9 @@ static void wx_draw_common(const CornerCtx *c, const char *text, GFont f_use) {
 }
 
 static void wx_draw_temp(const CornerCtx *c) {
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-  int t_disp = (int)c->weather_temp_c10;
-  if (c->weather_is_f) {
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
+  int t_disp = (int)c->st->weather.temp_c10;
+  if (c->st->weather.is_f) {
     const int32_t num = (int32_t)t_disp * 9;
     const int32_t div = (num >= 0) ? ((num + 2) / 5) : ((num - 2) / 5);
     t_disp = (int)(div + 320);
@@ -1171,91 +1989,68 @@ static void wx_draw_temp(const CornerCtx *c) {
 }
 
 static void wx_draw_wind(const CornerCtx *c) {
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-  const int spd_x10 = (int)c->weather_wind_spd_x10;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
+  const int spd_x10 = (int)c->st->weather.wind_spd_x10;
   const int spd_abs = (spd_x10 < 0) ? -spd_x10 : spd_x10;
   const int spd_int = (spd_abs + 5) / 10;
-  const int dir = (int)c->weather_wind_dir_deg;
+  const int dir = (int)c->st->weather.wind_dir_deg;
   const int idx = (int)(((dir % 360) + 22) / 45) & 7;
   char buf[16];
-  snprintf(buf, sizeof(buf), "%s %d%s", yes_i18n_compass(idx), spd_int, c->weather_is_f ? "mph" : "km/h");
+  snprintf(buf, sizeof(buf), "%s %d%s", yes_i18n_compass(idx), spd_int, c->st->weather.is_f ? "mph" : "km/h");
   wx_draw_common(c, buf, f);
 }
 
 static void wx_draw_precip(const CornerCtx *c) {
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-  const int pr_x10 = (int)c->weather_precip_x10;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
+  const int pr_x10 = (int)c->st->weather.precip_x10;
   const int pr_abs = (pr_x10 < 0) ? -pr_x10 : pr_x10;
   const int pr_int = pr_abs / 10;
   const int pr_frac = pr_abs % 10;
   char buf[16];
-  snprintf(buf, sizeof(buf), "%s%d.%d%s", (pr_x10 < 0 ? "-" : ""), pr_int, pr_frac, c->weather_is_f ? "in" : "mm");
+  snprintf(buf, sizeof(buf), "%s%d.%d%s", (pr_x10 < 0 ? "-" : ""), pr_int, pr_frac, c->st->weather.is_f ? "in" : "mm");
   wx_draw_common(c, buf, f);
 }
 
 static void wx_draw_uv(const CornerCtx *c) {
-  const GFont f_small = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD)
-                                            : fonts_get_system_font(FONT_KEY_GOTHIC_09);
-  const int uv_i = ((int)c->weather_uv_x10 + 5) / 10;
+  const GFont f_small = fonts_get_system_font(YES_FONT_KEY_SMALL);
+  const int uv_i = ((int)c->st->weather.uv_x10 + 5) / 10;
   char buf[16];
   snprintf(buf, sizeof(buf), "UV %d", uv_i);
   wx_draw_common(c, buf, f_small);
 }
 
 static void wx_draw_pressure(const CornerCtx *c) {
-  const GFont f = (c->min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
-                                      : fonts_get_system_font(FONT_KEY_GOTHIC_14_BOLD);
-  const int p_i = ((int)c->weather_pressure_hpa_x10 + 5) / 10;
+  const GFont f = fonts_get_system_font(YES_FONT_KEY_LABEL);
+  const int p_i = ((int)c->st->weather.pressure_hpa_x10 + 5) / 10;
   char buf[16];
   snprintf(buf, sizeof(buf), "%dhPa", p_i);
   wx_draw_common(c, buf, f);
 }
 #endif
 
-void yes_draw_face(Layer *layer, GContext *ctx,
-                     bool debug,
-                     bool net_on,
-                     bool have_loc,
-                     bool have_sun,
-                     bool have_moon,
-                     bool have_tide,
-                     int32_t tide_last_unix,
-                     int32_t tide_next_unix,
-                     bool tide_next_is_high,
-                     int16_t tide_level_x10,
-                     bool tide_level_is_ft,
-                     bool alt_valid,
-                     int32_t alt_m,
-                     bool alt_is_ft,
-                     bool battery_alert,
-                     uint8_t battery_percent,
-                     bool have_weather,
-                     int16_t weather_temp_c10,
-                     uint8_t weather_code,
-                     bool weather_is_day,
-                     bool weather_is_f,
-                     int16_t weather_wind_spd_x10,
-                     int16_t weather_wind_dir_deg,
-                     int16_t weather_precip_x10,
-                     int16_t weather_uv_x10,
-                     int16_t weather_pressure_hpa_x10,
-                     bool have_phase,
-                     int32_t moon_phase_e6,
-                     const GeoLoc *loc,
-                     const SunTimes *sun_times,
-                     const MoonTimes *moon_times) {
+bool yes_draw_face_ready(const YesFaceState *st) {
+  return st->loc && st->loc->valid && st->sun && st->sun->valid && st->moon && st->moon->valid;
+}
+
+void yes_draw_face(Layer *layer, GContext *ctx, const YesFaceState *st) {
+  const GeoLoc *loc = st->loc;
+  const SunTimes *sun_times = st->sun;
+  const MoonTimes *moon_times = st->moon;
+  const bool have_loc = loc && loc->valid;
+  const bool have_sun = sun_times && sun_times->valid;
+  const bool have_moon = moon_times && moon_times->valid;
   const GRect bounds = layer_get_bounds(layer);
   const GPoint c = grect_center_point(&bounds);
-  const int min_dim = (int)MIN(bounds.size.w, bounds.size.h);
-  const int16_t face_r = (int16_t)(min_dim / 2);
+  const int min_dim = YES_MIN_DIM;
+  const int16_t face_r = YES_FACE_R;
 
   graphics_context_set_fill_color(ctx, GColorBlack);
   graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+  num_atlas_ensure(ctx, bounds, fonts_get_system_font(YES_FONT_KEY_LABEL));
+  num_atlas_ensure(ctx, bounds, fonts_get_system_font(YES_FONT_KEY_TIME));
 
 #if ENABLE_DEBUG_SCREEN
-  if (debug) {
+  if (st->debug) {
     char buf0[32], buf1[32], buf2[32], buf3[32], buf4[32], buf5[32];
 
     char time_buf[12];
@@ -1267,16 +2062,16 @@ void yes_draw_face(Layer *layer, GContext *ctx,
       const int aoff = off * sign;
       const int hh = aoff / 60;
       const int mm = aoff % 60;
-      snprintf(buf0, sizeof(buf0), "DEBUG  %s", time_buf);
+      snprintf(buf0, sizeof(buf0), "DEBUG  %s%s", time_buf, st->low_power ? " LP" : "");
       snprintf(buf1, sizeof(buf1), "TZ UTC%c%02d:%02d  NET:%s",
-               (sign < 0) ? '-' : '+', hh, mm, net_on ? "ON" : "OFF");
+               (sign < 0) ? '-' : '+', hh, mm, st->net_on ? "ON" : "OFF");
       char lat_s[16], lon_s[16];
       format_deg2_from_e6(lat_s, sizeof(lat_s), loc->lat_e6);
       format_deg2_from_e6(lon_s, sizeof(lon_s), loc->lon_e6);
       snprintf(buf4, sizeof(buf4), "LAT %s  LON %s", lat_s, lon_s);
     } else {
-      snprintf(buf0, sizeof(buf0), "DEBUG  %s", time_buf);
-      snprintf(buf1, sizeof(buf1), "TZ --  NET:%s", net_on ? "ON" : "OFF");
+      snprintf(buf0, sizeof(buf0), "DEBUG  %s%s", time_buf, st->low_power ? " LP" : "");
+      snprintf(buf1, sizeof(buf1), "TZ --  NET:%s", st->net_on ? "ON" : "OFF");
       snprintf(buf4, sizeof(buf4), "LAT/LON --");
     }
 
@@ -1304,26 +2099,56 @@ void yes_draw_face(Layer *layer, GContext *ctx,
       snprintf(buf3, sizeof(buf3), "MOON: --");
     }
 
-    if (have_tide && tide_last_unix > 0 && tide_next_unix > tide_last_unix) {
-      const int mins = (int)((tide_next_unix - (int32_t)time(NULL)) / 60);
-      snprintf(buf5, sizeof(buf5), "TIDE next %s in %dm", tide_next_is_high ? "H" : "L", mins);
+    if (st->tide.valid && st->tide.last_unix > 0 && st->tide.next_unix > st->tide.last_unix) {
+      const int mins = (int)((st->tide.next_unix - (int32_t)time(NULL)) / 60);
+      snprintf(buf5, sizeof(buf5), "TIDE next %s in %dm", st->tide.next_is_high ? "H" : "L", mins);
     } else {
       snprintf(buf5, sizeof(buf5), "TIDE: --");
     }
 
+    // Second debug page: profiler HUD reusing the same six-line layout.
+    if (st->debug_perf) {
+      snprintf(buf0, sizeof(buf0), "PERF  %s", time_buf);
+      yes_prof_format(0, buf1, sizeof(buf1));
+      yes_prof_format(1, buf4, sizeof(buf4));
+      yes_prof_format(2, buf2, sizeof(buf2));
+      yes_prof_format(3, buf3, sizeof(buf3));
+      yes_prof_format(4, buf5, sizeof(buf5));
+    }
+
+    // Third page: the worker's battery cost split, in mAh per day at the recent activity.
+    if (st->debug_batt) {
+      const YesBattFit *f = st->batt_fit;
+      snprintf(buf0, sizeof(buf0), "BATT  %s", time_buf);
+      if (f && f->samples) {
+        const int base = (int)yes_batt_mah_day_x10(f->base_uph, 1);
+        const int rd = (int)yes_batt_mah_day_x10(f->redraw_u, f->redraws_ph);
+        const int wk = (int)yes_batt_mah_day_x10(f->wake_u, f->wakes_ph);
+        const int msg = (int)yes_batt_mah_day_x10(f->msg_u, f->msgs_ph);
+        const int total = base + rd + wk + msg;
+        snprintf(buf1, sizeof(buf1), "%d.%d mAh/d  n=%u", total / 10, total % 10, (unsigned)f->samples);
+        snprintf(buf4, sizeof(buf4), "BASE %d.%d", base / 10, base % 10);
+        snprintf(buf2, sizeof(buf2), "DRAW %d.%d  %u/h", rd / 10, rd % 10, (unsigned)f->redraws_ph);
+        snprintf(buf3, sizeof(buf3), "WAKE %d.%d  %u/h", wk / 10, wk % 10, (unsigned)f->wakes_ph);
+        snprintf(buf5, sizeof(buf5), "MSG %d.%d  %u/h", msg / 10, msg % 10, (unsigned)f->msgs_ph);
+      } else {
+        snprintf(buf1, sizeof(buf1), "learning");
+        snprintf(buf4, sizeof(buf4), "needs %d drops", YES_BATT_FIT_MIN_SAMPLES);
+        snprintf(buf2, sizeof(buf2), "off the charger");
+        buf3[0] = buf5[0] = '\0';
+      }
+    }
+
     graphics_context_set_text_color(ctx, GColorWhite);
-    const GFont f_dbg0 = (min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD)
-                                          : fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD);
-    const GFont f_dbg = (min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_24)
-                                         : fonts_get_system_font(FONT_KEY_GOTHIC_18);
+    const GFont f_dbg0 = fonts_get_system_font(YES_LAYOUT_BIG ? FONT_KEY_GOTHIC_24_BOLD : FONT_KEY_GOTHIC_18_BOLD);
+    const GFont f_dbg = fonts_get_system_font(YES_LAYOUT_BIG ? FONT_KEY_GOTHIC_24 : FONT_KEY_GOTHIC_18);
 
-    const GFont f_hint = (min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_18)
-                                          : fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    const int16_t hint_h = (min_dim >= 200) ? scale_px(22, face_r) : scale_px(18, face_r);
+    const GFont f_hint = fonts_get_system_font(YES_LAYOUT_BIG ? FONT_KEY_GOTHIC_18 : FONT_KEY_GOTHIC_14);
+    const int16_t hint_h = YES_LAYOUT_BIG ? YES_PX(22) : YES_PX(18);
 
     // Layout: stack lines using actual font heights with minimal gaps so everything fits above the hint.
-    const int16_t gap = scale_px(1, face_r);
-    const int16_t top_y_default = scale_px(6, face_r);
+    const int16_t gap = YES_PX(1);
+    const int16_t top_y_default = YES_PX(6);
     const int16_t max_y = (int16_t)(bounds.size.h - hint_h);
 
     const int16_t h0 = (int16_t)graphics_text_layout_get_content_size(
@@ -1380,15 +2205,12 @@ void yes_draw_face(Layer *layer, GContext *ctx,
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
     return;
   }
-#else
-  (void)debug;
-  (void)net_on;
 #endif
 
   // Loading/progress screen: avoid flashing obviously wrong times while data is still arriving.
   if (!(have_loc && have_sun && have_moon)) {
     graphics_context_set_text_color(ctx, GColorWhite);
-    const bool big = (min_dim >= 200);
+    const bool big = YES_LAYOUT_BIG;
     const GFont f_title = big ? fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD)
                               : fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD);
     const GFont f_body = big ? fonts_get_system_font(FONT_KEY_GOTHIC_24)
@@ -1396,12 +2218,12 @@ void yes_draw_face(Layer *layer, GContext *ctx,
     const GFont f_prog = big ? fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD)
                              : fonts_get_system_font(FONT_KEY_GOTHIC_14);
 
-    const int16_t title_y = (int16_t)scale_px(18, face_r);
-    const int16_t msg_y   = (int16_t)(title_y + scale_px(28, face_r));
-    const int16_t prog_y  = (int16_t)(msg_y + scale_px(26, face_r));
+    const int16_t title_y = (int16_t)YES_PX(18);
+    const int16_t msg_y   = (int16_t)(title_y + YES_PX(28));
+    const int16_t prog_y  = (int16_t)(msg_y + YES_PX(26));
 
     graphics_draw_text(ctx, yes_i18n_text(YES_TEXT_LOADING), f_title,
-                       GRect(0, title_y, bounds.size.w, scale_px(28, face_r)),
+                       GRect(0, title_y, bounds.size.w, YES_PX(28)),
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
 
     const char *msg = yes_i18n_text(YES_TEXT_WAITING_DATA);
@@ -1410,28 +2232,28 @@ void yes_draw_face(Layer *layer, GContext *ctx,
     else if (!have_moon) msg = yes_i18n_text(YES_TEXT_WAITING_MOON);
 
     graphics_draw_text(ctx, msg, f_body,
-                       GRect(0, msg_y, bounds.size.w, scale_px(26, face_r)),
+                       GRect(0, msg_y, bounds.size.w, YES_PX(26)),
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
 
     // Progress: 3 steps (loc, sun, moon)
     int done = (have_loc ? 1 : 0) + (have_sun ? 1 : 0) + (have_moon ? 1 : 0);
     char prog[16];
     snprintf(prog, sizeof(prog), "%d/3", done);
-    const int16_t prog_h = scale_px(18, face_r);
+    const int16_t prog_h = YES_PX(18);
     graphics_draw_text(ctx, prog, f_prog,
                        GRect(0, prog_y, bounds.size.w, prog_h),
                        GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
 
     // Simple spinner hand
     const int32_t a = (int32_t)((time(NULL) % 60) * (TRIG_MAX_ANGLE / 60));
-    const int16_t r0 = scale_px(10, face_r);
-    const int16_t r1 = scale_px(22, face_r);
+    const int16_t r0 = YES_PX(10);
+    const int16_t r1 = YES_PX(22);
     // Place spinner slightly lower to avoid touching the status text on small screens.
-    const int16_t prog_pad = scale_px(6, face_r);
+    const int16_t prog_pad = YES_PX(6);
     const int16_t min_cy = (int16_t)(prog_y + prog_h + prog_pad + r1);
-    int16_t cy = (int16_t)(c.y + scale_px(18, face_r));
+    int16_t cy = (int16_t)(c.y + YES_PX(18));
     if (cy < min_cy) cy = min_cy;
-    cy = (int16_t)MIN((int)(bounds.size.h - (r1 + scale_px(6, face_r))), (int)cy);
+    cy = (int16_t)MIN((int)(bounds.size.h - (r1 + YES_PX(6))), (int)cy);
     const GPoint cc = GPoint(c.x, cy);
     const GPoint p0 = (GPoint){
       .x = (int16_t)(cc.x + (int32_t)sin_lookup(a) * r0 / TRIG_MAX_RATIO),
@@ -1462,78 +2284,99 @@ void yes_draw_face(Layer *layer, GContext *ctx,
   const GColor col_moon_up = GColorWhite;
 #endif
 
-  const uint16_t moon_inset = (uint16_t)scale_px(22, face_r);
-#ifdef PBL_COLOR
-  const uint16_t moon_base_thickness = (uint16_t)scale_px(5, face_r);
-  const uint16_t moon_up_thickness = (uint16_t)scale_px(5, face_r);
-#else
-  const uint16_t moon_base_thickness = (uint16_t)scale_px(2, face_r);
-  const uint16_t moon_up_thickness = (uint16_t)scale_px(5, face_r);
-#endif
-
-  // Solar disk inset: inner edge of ring is at (moon_inset + thickness/2)
-  const uint16_t solar_inset = (uint16_t)(moon_inset + (moon_up_thickness / 2));
-  // Night wedge should be slightly smaller than the day disk.
-  // Make it a bit bigger by reducing the extra inset.
-  const uint16_t night_inset = (uint16_t)(solar_inset + (uint16_t)scale_px(1, face_r));
+  const uint16_t moon_inset = YES_MOON_INSET;
+  const uint16_t moon_base_thickness = YES_MOON_BASE_THICKNESS;
+  const uint16_t moon_up_thickness = YES_MOON_UP_THICKNESS;
+  // Solar disk inset: inner edge of ring is at (moon_inset + thickness/2); the night wedge sits
+  // slightly inside the day disk.
+  const uint16_t solar_inset = YES_SOLAR_INSET;
+  const uint16_t night_inset = YES_NIGHT_INSET;
   bool top_is_night = false;
 
-  // Paint order as requested:
-  // 1) dark moon background as a disk (gets cut out by the solar day disk)
-  draw_ring_base_disk(ctx, bounds, moon_inset, moon_base_thickness, col_moon_base);
-
-  // 2) moon-up ring segment as an arc
-  if (moon_times && moon_times->valid) {
-    if (moon_times->always_up) {
-      draw_ring_arc(ctx, bounds, moon_inset, moon_up_thickness, 0, TRIG_MAX_ANGLE, col_moon_up);
-    } else if (!moon_times->always_down) {
-      const int32_t a_rise = angle_from_local_minutes_24h(moon_times->moonrise_min);
-      const int32_t a_set  = angle_from_local_minutes_24h(moon_times->moonset_min);
-      draw_ring_arc(ctx, bounds, moon_inset, moon_up_thickness, a_rise, a_set, col_moon_up);
-    }
+  int32_t phase_e6 = moon_phase_e6_now(time(NULL)); // fallback
+  if (st->have_phase) {
+    phase_e6 = st->moon_phase_e6;
+    if (phase_e6 < 0) phase_e6 = 0;
+    if (phase_e6 > 1000000) phase_e6 = 1000000;
   }
 
-  // 3) solar night disc as a circle
-  if (sun_times && sun_times->valid) {
-    graphics_context_set_fill_color(ctx, sun_times->always_day ? col_solar_day : col_solar_night);
-    graphics_fill_circle(ctx, c, (int16_t)(MIN(bounds.size.w, bounds.size.h) / 2 - solar_inset));
-
-    // 4) day wedge (radius reduced by a little)
-    if (sun_times->always_day) {
-      top_is_night = false;
-    } else if (sun_times->always_night) {
-      top_is_night = true;
-    } else {
-      const int32_t a_sunrise = angle_from_local_minutes_24h(sun_times->sunrise_min);
-      const int32_t a_sunset  = angle_from_local_minutes_24h(sun_times->sunset_min);
-      fill_radial_wedge(ctx, bounds, night_inset, a_sunrise, a_sunset, col_solar_day);
-      top_is_night = !angle_in_sweep(0, a_sunrise, a_sunset);
+  const DialKey dial_key = dial_key_make(bounds, st, phase_e6);
+  if (!dial_cache_restore(ctx, &dial_key, &top_is_night)) {
+    const int moon_r = YES_PX(9);
+    const GPoint moon_c = GPoint(c.x, (int16_t)(c.y + min_dim / 5));
+    bool composed = false;
+#if YES_DIAL_SPANS
+    YES_PROF_BEGIN(t_spans);
+    composed = dial_spans_compose(ctx, c, sun_times, moon_times, moon_c, (int16_t)moon_r, phase_e6,
+                                  col_moon_base, col_moon_up, col_solar_night, col_solar_day, &top_is_night);
+    YES_PROF_END(YES_PROF_BG, t_spans);
+#endif
+    if (!composed) {
+      YES_PROF_BEGIN(t_bg);
+      // Paint order as requested:
+      // 1) dark moon background as a disk (gets cut out by the solar day disk)
+      draw_ring_base_disk(ctx, bounds, moon_inset, moon_base_thickness, col_moon_base);
+
+      // 2) moon-up ring segment as an arc
+      if (moon_times && moon_times->valid) {
+        if (moon_times->always_up) {
+          draw_ring_arc(ctx, bounds, moon_inset, moon_up_thickness, 0, TRIG_MAX_ANGLE, col_moon_up);
+        } else if (!moon_times->always_down) {
+          const int32_t a_rise = angle_from_local_minutes_24h(moon_times->moonrise_min);
+          const int32_t a_set  = angle_from_local_minutes_24h(moon_times->moonset_min);
+          draw_ring_arc(ctx, bounds, moon_inset, moon_up_thickness, a_rise, a_set, col_moon_up);
+        }
+      }
+
+      // 3) solar night disc as a circle
+      if (sun_times && sun_times->valid) {
+        graphics_context_set_fill_color(ctx, sun_times->always_day ? col_solar_day : col_solar_night);
+        graphics_fill_circle(ctx, c, (int16_t)(face_r - solar_inset));
+
+        // 4) day wedge (radius reduced by a little)
+        if (sun_times->always_day) {
+          top_is_night = false;
+        } else if (sun_times->always_night) {
+          top_is_night = true;
+        } else {
+          const int32_t a_sunrise = angle_from_local_minutes_24h(sun_times->sunrise_min);
+          const int32_t a_sunset  = angle_from_local_minutes_24h(sun_times->sunset_min);
+          fill_radial_wedge(ctx, bounds, night_inset, a_sunrise, a_sunset, col_solar_day);
+          top_is_night = !angle_in_sweep(0, a_sunrise, a_sunset);
+        }
+      }
+
+      YES_PROF_END(YES_PROF_BG, t_bg);
     }
-  }
-
-  draw_outer_scale(ctx, bounds, moon_inset, moon_up_thickness);
 
-  // Moon phase disk
-  {
-    const int moon_r = scale_px(9, face_r);
-    const GPoint moon_c = GPoint(c.x, (int16_t)(c.y + min_dim / 5));
-    double phase = moon_phase_0_1(time(NULL)); // fallback
-    if (have_phase) {
-      int32_t p = moon_phase_e6;
-      if (p < 0) p = 0;
-      if (p > 1000000) p = 1000000;
-      phase = (double)p / 1000000.0;
+    YES_PROF_BEGIN(t_scale);
+    draw_outer_scale(ctx, bounds, moon_inset, moon_up_thickness);
+    YES_PROF_END(YES_PROF_SCALE, t_scale);
+
+    // Moon phase disk (the span pass already filled it; only the outline is left)
+    {
+      YES_PROF_BEGIN(t_moon);
+      if (composed) {
+        graphics_context_set_stroke_color(ctx, GColorWhite);
+        graphics_context_set_stroke_width(ctx, 1);
+        graphics_draw_circle(ctx, moon_c, moon_r);
+      } else {
+        draw_moon(ctx, moon_c, moon_r, phase_e6);
+      }
+      YES_PROF_END(YES_PROF_MOON, t_moon);
     }
-    draw_moon(ctx, moon_c, moon_r, phase);
+
+    dial_cache_store(ctx, &dial_key, top_is_night);
   }
 
+  YES_PROF_BEGIN(t_hand);
   struct tm tm_loc;
   int minutes = 0;
   if (!yes_local_tm_now(loc, &tm_loc, &minutes)) minutes = 0;
 
   const int32_t hand_angle = angle_from_local_minutes_24h(minutes);
-  const int16_t solar_r = (int16_t)(face_r - (int16_t)solar_inset - scale_px(2, face_r));
-  const int16_t hand_len = (int16_t)MIN(solar_r, (int16_t)(face_r - scale_px(18, face_r)));
+  const int16_t solar_r = (int16_t)(face_r - (int16_t)solar_inset - YES_PX(2));
+  const int16_t hand_len = (int16_t)MIN(solar_r, (int16_t)(face_r - YES_PX(18)));
 
   // Yes-watch-like tapered arrow hand (filled polygon + subtle outline)
   if (s_hand_path && hand_len > 16) {
@@ -1542,19 +2385,19 @@ void yes_draw_face(Layer *layer, GContext *ctx,
     const int32_t px = cos_lookup(hand_angle);
     const int32_t py = sin_lookup(hand_angle);
 
-    const int16_t base_r = scale_px(4, face_r);
-    const int16_t head_len = scale_px(10, face_r);
+    const int16_t base_r = YES_PX(4);
+    const int16_t head_len = YES_PX(10);
     int16_t neck_r = (int16_t)(hand_len - head_len);
-    if (neck_r < (int16_t)(base_r + scale_px(4, face_r))) neck_r = (int16_t)(base_r + scale_px(4, face_r));
+    if (neck_r < (int16_t)(base_r + YES_PX(4))) neck_r = (int16_t)(base_r + YES_PX(4));
     const int16_t tip_r  = hand_len;
 
 #ifdef PBL_COLOR
-    const int16_t base_w = scale_px(9, face_r);
-    const int16_t neck_w = scale_px(5, face_r);
+    const int16_t base_w = YES_PX(9);
+    const int16_t neck_w = YES_PX(5);
     const GColor outline = GColorDarkGray;
 #else
-    const int16_t base_w = scale_px(7, face_r);
-    const int16_t neck_w = scale_px(4, face_r);
+    const int16_t base_w = YES_PX(7);
+    const int16_t neck_w = YES_PX(4);
     const GColor outline = GColorBlack;
 #endif
 
@@ -1592,7 +2435,7 @@ void yes_draw_face(Layer *layer, GContext *ctx,
     graphics_context_set_stroke_width(ctx, 1);
     gpath_draw_outline(ctx, s_hand_path);
 
-    const int16_t hub_r = scale_px(6, face_r);
+    const int16_t hub_r = YES_PX(6);
     graphics_context_set_fill_color(ctx, GColorWhite);
     graphics_fill_circle(ctx, c, hub_r);
     graphics_context_set_stroke_color(ctx, outline);
@@ -1608,7 +2451,7 @@ void yes_draw_face(Layer *layer, GContext *ctx,
 #endif
     graphics_draw_line(ctx, c, GPoint(x, y));
     graphics_context_set_fill_color(ctx, GColorWhite);
-    graphics_fill_circle(ctx, c, scale_px(4, face_r));
+    graphics_fill_circle(ctx, c, YES_PX(4));
   }
 
   char time_buf[12];
@@ -1623,15 +2466,13 @@ void yes_draw_face(Layer *layer, GContext *ctx,
     // On both color and B/W: black on day, white on night.
     const GColor time_col = top_is_night ? GColorWhite : GColorBlack;
     graphics_context_set_text_color(ctx, time_col);
-    const GFont f_time = (min_dim >= 200) ? fonts_get_system_font(FONT_KEY_GOTHIC_28_BOLD)
-                                          : fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-    const int16_t time_h = (min_dim >= 200) ? scale_px(34, face_r) : scale_px(28, face_r);
+    const GFont f_time = fonts_get_system_font(YES_FONT_KEY_TIME);
+    const int16_t time_h = YES_LAYOUT_BIG ? YES_PX(34) : YES_PX(28);
 
     const GRect time_rect = GRect(0, (int16_t)(y_center - time_h / 2), bounds.size.w, time_h);
-    graphics_draw_text(ctx, time_buf, f_time,
-                       time_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+    draw_num_text(ctx, time_buf, f_time, time_rect, GTextAlignmentCenter, time_col);
   }
+  YES_PROF_END(YES_PROF_HAND, t_hand);
 
   // Corner: top-left is now drawn in the overlay layer (`yes_draw_corners`) so that
   // complication alternation doesn't force a full watchface redraw.
@@ -1649,168 +2490,120 @@ void yes_draw_face(Layer *layer, GContext *ctx,
 }
 
 #ifndef PBL_ROUND
-void yes_draw_corners(Layer *layer, GContext *ctx,
-                      bool debug,
-                      bool have_loc,
-                      bool have_sun,
-                      bool have_moon,
-                      bool have_tide,
-                      int32_t tide_last_unix,
-                      int32_t tide_next_unix,
-                      bool tide_next_is_high,
-                      int16_t tide_level_x10,
-                      bool tide_level_is_ft,
-                      bool alt_valid,
-                      int32_t alt_m,
-                      bool alt_is_ft,
-                      bool battery_alert,
-                      uint8_t battery_percent,
-                      bool have_weather,
-                      int16_t weather_temp_c10,
-                      uint8_t weather_code,
-                      bool weather_is_day,
-                      bool weather_is_f,
-                      int16_t weather_wind_spd_x10,
-                      int16_t weather_wind_dir_deg,
-                      int16_t weather_precip_x10,
-                      int16_t weather_uv_x10,
-                      int16_t weather_pressure_hpa_x10,
-                      bool have_phase,
-                      int32_t moon_phase_e6,
-                      int ui_update_interval_sec,
-                      const GeoLoc *loc,
-                      const SunTimes *sun_times,
-                      const MoonTimes *moon_times) {
-  (void)layer;
-  // Mirror the old behavior: no corners on debug or loading screen.
-  if (debug) return;
-  if (!(have_loc && have_sun && have_moon)) return;
-
-  const GRect bounds = layer_get_bounds(layer);
-  const int min_dim = (int)MIN(bounds.size.w, bounds.size.h);
-  const int16_t face_r = (int16_t)(min_dim / 2);
-  const int16_t corner_pad = scale_px(6, face_r);
+static const SlotComp s_tl_comps[] = {
+  { tl_avail_bt,    tl_draw_bt,    tl_sig_bt,    NULL,           true  },
+  { tl_avail_batt,  tl_draw_batt,  tl_sig_batt,  NULL,           false },
+  { tl_avail_steps, tl_draw_steps, tl_sig_steps, next_minute_cb, false },
+};
+
+static const SlotComp s_bl_comps[] = {
+  { wx_avail_temp,   wx_draw_temp,     wx_sig_temp,   NULL, false },
+  { wx_avail_wind,   wx_draw_wind,     wx_sig_wind,   NULL, false },
+  { wx_avail_precip, wx_draw_precip,   wx_sig_precip, NULL, false },
+  { wx_avail_uv,     wx_draw_uv,       wx_sig_uv,     NULL, false },
+  { wx_avail_p,      wx_draw_pressure, wx_sig_p,      NULL, false },
+};
+
+static const SlotComp s_br_comps[] = {
+  { br_avail_tide, br_draw_tide,     br_sig_tide,     br_next_tide,   true  },
+  { br_avail_alt,  br_draw_alt,      br_sig_alt,      NULL,           false },
+  { br_avail_sun,  br_draw_sun_cd,   br_sig_sun_cd,   next_minute_cb, false },
+  { br_avail_moon, br_draw_moon_cd,  br_sig_moon_cd,  next_minute_cb, false },
+  { br_avail_age,  br_draw_moon_age, br_sig_moon_age, NULL,           false },
+};
+
+#define SLOT_COUNT(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+// Mirror the old behavior: no corners on debug or loading screen.
+static bool corners_hidden(const YesFaceState *st) {
+  return st->debug ||
+         !(st->loc && st->loc->valid && st->sun && st->sun->valid && st->moon && st->moon->valid);
+}
 
-  // Construct a shared context for slot implementations.
-  CornerCtx cc = (CornerCtx){
+static CornerCtx corner_ctx_make(Layer *layer, GContext *ctx, const YesFaceState *st) {
+  return (CornerCtx){
     .ctx = ctx,
-    .bounds = bounds,
-    .face_r = face_r,
-    .corner_pad = corner_pad,
+    .bounds = layer_get_bounds(layer),
     .color_txt = GColorWhite,
     .color_base = GColorDarkGray,
     .color_prog = GColorWhite,
-    .have_tide = have_tide,
-    .tide_last_unix = tide_last_unix,
-    .tide_next_unix = tide_next_unix,
-    .tide_next_is_high = tide_next_is_high,
-    .tide_level_x10 = tide_level_x10,
-    .tide_level_is_ft = tide_level_is_ft,
-    .alt_valid = alt_valid,
-    .alt_m = alt_m,
-    .alt_is_ft = alt_is_ft,
-    .have_weather = have_weather,
-    .weather_temp_c10 = weather_temp_c10,
-    .weather_code = weather_code,
-    .weather_is_day = weather_is_day,
-    .weather_is_f = weather_is_f,
-    .weather_wind_spd_x10 = weather_wind_spd_x10,
-    .weather_wind_dir_deg = weather_wind_dir_deg,
-    .weather_precip_x10 = weather_precip_x10,
-    .weather_uv_x10 = weather_uv_x10,
-    .weather_pressure_hpa_x10 = weather_pressure_hpa_x10,
-    .battery_alert = battery_alert,
-    .battery_percent = battery_percent,
-    .have_phase = have_phase,
-    .moon_phase_e6 = moon_phase_e6,
-    .loc = loc,
-    .sun_times = sun_times,
-    .moon_times = moon_times,
-    .min_dim = min_dim,
-    .ui_update_interval_sec = ui_update_interval_sec,
+    .st = st,
   };
+}
 
-  // Top-left slot
-  {
-    const SlotComp comps[] = {
-      { tl_avail_bt,    tl_draw_bt,    true  },
-      { tl_avail_batt,  tl_draw_batt,  false },
-      { tl_avail_steps, tl_draw_steps, false },
-    };
-    const int which = slot_pick_index(comps, (int)(sizeof(comps) / sizeof(comps[0])), &cc, time(NULL));
-    if (which >= 0) comps[which].draw(&cc);
+static time_t earliest(time_t a, time_t b) {
+  if (!a) return b;
+  if (!b) return a;
+  return (a < b) ? a : b;
+}
+
+time_t yes_draw_corners_next_change(Layer *layer, const YesFaceState *st, time_t after) {
+  // Low power: nothing rotates, and countdowns ride on the minute tick's full redraw.
+  if (corners_hidden(st) || st->low_power) return 0;
+  const CornerCtx cc = corner_ctx_make(layer, NULL, st);
+  // Top-right alternates date/weekday on the cadence.
+  time_t t = corner_cycle_next(after, st->ui_update_interval_sec);
+  t = earliest(t, slot_next_change(s_tl_comps, SLOT_COUNT(s_tl_comps), &cc, after));
+  if (st->weather.valid) {
+    t = earliest(t, slot_next_change(s_bl_comps, SLOT_COUNT(s_bl_comps), &cc, after));
+  }
+  return earliest(t, slot_next_change(s_br_comps, SLOT_COUNT(s_br_comps), &cc, after));
+}
+
+bool yes_draw_corners(Layer *layer, GContext *ctx, const YesFaceState *st) {
+  uint32_t sig[CORNER_SLOT_COUNT] = { 0 };
+  if (corners_hidden(st)) {
+    const bool changed = !s_corner_sig_valid || memcmp(sig, s_corner_sig, sizeof(sig)) != 0;
+    if (ctx) {
+      memcpy(s_corner_sig, sig, sizeof(sig));
+      s_corner_sig_valid = true;
+    }
+    return changed;
   }
 
-  draw_top_right_date(&cc);
+  // Construct a shared context for slot implementations.
+  const CornerCtx cc = corner_ctx_make(layer, ctx, st);
+
+  // With ctx == NULL only the signatures are computed, so callers can skip no-op redraws.
+  const time_t now = time(NULL);
+  const int32_t lang = (int32_t)yes_i18n_get_language();
+  // Slot timings are only recorded for real draws, not signature-only probes.
+  YES_PROF_BEGIN(t_tl);
+  sig[CORNER_SLOT_TOP_LEFT] = sig_mix(slot_run(s_tl_comps, SLOT_COUNT(s_tl_comps), &cc, now), lang);
+  YES_PROF_END_IF(ctx, YES_PROF_CORNER_TL, t_tl);
+
+  YES_PROF_BEGIN(t_tr);
+  if (ctx) draw_top_right_date(&cc);
+  sig[CORNER_SLOT_TOP_RIGHT] = sig_mix(tr_sig_date(&cc), lang);
+  YES_PROF_END_IF(ctx, YES_PROF_CORNER_TR, t_tr);
 
   // Bottom-left weather slot
-  if (have_weather) {
-    const SlotComp comps[] = {
-      { wx_avail_temp,   wx_draw_temp,     false },
-      { wx_avail_wind,   wx_draw_wind,     false },
-      { wx_avail_precip, wx_draw_precip,   false },
-      { wx_avail_uv,     wx_draw_uv,       false },
-      { wx_avail_p,      wx_draw_pressure, false },
-    };
-    const int which = slot_pick_index(comps, (int)(sizeof(comps) / sizeof(comps[0])), &cc, time(NULL));
-    if (which >= 0) comps[which].draw(&cc);
+  if (st->weather.valid) {
+    YES_PROF_BEGIN(t_bl);
+    sig[CORNER_SLOT_BOTTOM_LEFT] = sig_mix(slot_run(s_bl_comps, SLOT_COUNT(s_bl_comps), &cc, now), lang);
+    YES_PROF_END_IF(ctx, YES_PROF_CORNER_BL, t_bl);
   }
 
-  // Bottom-right slot
-  {
-    const SlotComp comps[] = {
-      { br_avail_tide, br_draw_tide,     true  },
-      { br_avail_alt,  br_draw_alt,      false },
-      { br_avail_sun,  br_draw_sun_cd,   false },
-      { br_avail_moon, br_draw_moon_cd,  false },
-      { br_avail_age,  br_draw_moon_age, false },
-    };
-    const int which = slot_pick_index(comps, (int)(sizeof(comps) / sizeof(comps[0])), &cc, time(NULL));
-    if (which >= 0) comps[which].draw(&cc);
+  YES_PROF_BEGIN(t_br);
+  sig[CORNER_SLOT_BOTTOM_RIGHT] = sig_mix(slot_run(s_br_comps, SLOT_COUNT(s_br_comps), &cc, now), lang);
+  YES_PROF_END_IF(ctx, YES_PROF_CORNER_BR, t_br);
+
+  const bool changed = !s_corner_sig_valid || memcmp(sig, s_corner_sig, sizeof(sig)) != 0;
+  if (ctx) {
+    memcpy(s_corner_sig, sig, sizeof(sig));
+    s_corner_sig_valid = true;
   }
+  return changed;
 }
 #else
-void yes_draw_corners(Layer *layer, GContext *ctx,
-                      bool debug,
-                      bool have_loc,
-                      bool have_sun,
-                      bool have_moon,
-                      bool have_tide,
-                      int32_t tide_last_unix,
-                      int32_t tide_next_unix,
-                      bool tide_next_is_high,
-                      int16_t tide_level_x10,
-                      bool tide_level_is_ft,
-                      bool alt_valid,
-                      int32_t alt_m,
-                      bool alt_is_ft,
-                      bool battery_alert,
-                      uint8_t battery_percent,
-                      bool have_weather,
-                      int16_t weather_temp_c10,
-                      uint8_t weather_code,
-                      bool weather_is_day,
-                      bool weather_is_f,
-                      int16_t weather_wind_spd_x10,
-                      int16_t weather_wind_dir_deg,
-                      int16_t weather_precip_x10,
-                      int16_t weather_uv_x10,
-                      int16_t weather_pressure_hpa_x10,
-                      bool have_phase,
-                      int32_t moon_phase_e6,
-                      int ui_update_interval_sec,
-                      const GeoLoc *loc,
-                      const SunTimes *sun_times,
-                      const MoonTimes *moon_times) {
-  (void)layer; (void)ctx; (void)debug; (void)have_loc; (void)have_sun; (void)have_moon;
-  (void)have_tide; (void)tide_last_unix; (void)tide_next_unix; (void)tide_next_is_high; (void)tide_level_x10; (void)tide_level_is_ft;
-  (void)alt_valid; (void)alt_m; (void)alt_is_ft;
-  (void)battery_alert; (void)battery_percent;
-  (void)have_weather; (void)weather_temp_c10; (void)weather_code; (void)weather_is_day; (void)weather_is_f;
-  (void)weather_wind_spd_x10; (void)weather_wind_dir_deg; (void)weather_precip_x10; (void)weather_uv_x10; (void)weather_pressure_hpa_x10;
-  (void)have_phase; (void)moon_phase_e6;
-  (void)ui_update_interval_sec;
-  (void)loc; (void)sun_times; (void)moon_times;
+bool yes_draw_corners(Layer *layer, GContext *ctx, const YesFaceState *st) {
+  (void)layer; (void)ctx; (void)st;
+  return false;
+}
+
+time_t yes_draw_corners_next_change(Layer *layer, const YesFaceState *st, time_t after) {
+  (void)layer; (void)st; (void)after;
+  return 0;
 }
 #endif
 
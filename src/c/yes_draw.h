@@ -11,71 +11,29 @@ void yes_draw_init(void);
 void yes_draw_deinit(void);
 
 // Draw the full watchface (including the loading screen). Intended for the main layer.
-void yes_draw_face(Layer *layer, GContext *ctx,
-                     bool debug,
-                     bool net_on,
-                     bool have_loc,
-                     bool have_sun,
-                     bool have_moon,
-                     bool have_tide,
-                     int32_t tide_last_unix,
-                     int32_t tide_next_unix,
-                     bool tide_next_is_high,
-                     int16_t tide_level_x10,
-                     bool tide_level_is_ft,
-                     bool alt_valid,
-                     int32_t alt_m,
-                     bool alt_is_ft,
-                     bool battery_alert,
-                     uint8_t battery_percent,
-                     bool have_weather,
-                     int16_t weather_temp_c10,
-                     uint8_t weather_code,
-                     bool weather_is_day,
-                     bool weather_is_f,
-                     int16_t weather_wind_spd_x10,
-                     int16_t weather_wind_dir_deg,
-                     int16_t weather_precip_x10,
-                     int16_t weather_uv_x10,
-                     int16_t weather_pressure_hpa_x10,
-                     bool have_phase,
-                     int32_t moon_phase_e6,
-                     const GeoLoc *loc,
-                     const SunTimes *sun,
-                     const MoonTimes *moon);
+// The static dial (rings, wedge, scale, moon) is cached between calls and only re-rendered when
+// sun/moon times, moon phase, language or layer size change; otherwise only the hand and time are drawn.
+void yes_draw_face(Layer *layer, GContext *ctx, const YesFaceState *st);
+
+// True when yes_draw_face shows the dial rather than the loading screen.
+bool yes_draw_face_ready(const YesFaceState *st);
+
+// Query the health step count for the steps corner. Until the first call the corner (and the
+// battery item that stands in for it) stays empty, keeping the health query off the first frame;
+// later frames refresh it on their own once a minute.
+void yes_draw_refresh_steps(void);
 
 // Draw only corner complications (no background clearing). Intended for a lightweight overlay layer.
-void yes_draw_corners(Layer *layer, GContext *ctx,
-                      bool debug,
-                      bool have_loc,
-                      bool have_sun,
-                      bool have_moon,
-                      bool have_tide,
-                      int32_t tide_last_unix,
-                      int32_t tide_next_unix,
-                      bool tide_next_is_high,
-                      int16_t tide_level_x10,
-                      bool tide_level_is_ft,
-                      bool alt_valid,
-                      int32_t alt_m,
-                      bool alt_is_ft,
-                      bool battery_alert,
-                      uint8_t battery_percent,
-                      bool have_weather,
-                      int16_t weather_temp_c10,
-                      uint8_t weather_code,
-                      bool weather_is_day,
-                      bool weather_is_f,
-                      int16_t weather_wind_spd_x10,
-                      int16_t weather_wind_dir_deg,
-                      int16_t weather_precip_x10,
-                      int16_t weather_uv_x10,
-                      int16_t weather_pressure_hpa_x10,
-                      bool have_phase,
-                      int32_t moon_phase_e6,
-                      int ui_update_interval_sec,
-                      const GeoLoc *loc,
-                      const SunTimes *sun,
-                      const MoonTimes *moon);
+// Returns true if any corner slot differs from the last drawn frame. With ctx == NULL nothing is
+// drawn; use that to decide whether the overlay needs to be marked dirty at all.
+bool yes_draw_corners(Layer *layer, GContext *ctx, const YesFaceState *st);
+
+// Earliest time > after at which some corner would show different content without new data
+// (slot rotation, tide view, countdowns). 0 when nothing changes on its own.
+time_t yes_draw_corners_next_change(Layer *layer, const YesFaceState *st, time_t after);
+
+// Hash of the selected YES_STATE_* parts of st (plus the UI language). Equal hashes mean the
+// same inputs, so callers can skip redraws and caches can key on it.
+uint32_t yes_face_state_hash(const YesFaceState *st, uint32_t parts);
 
 
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <pebble.h>
+
+// Per-platform layout constants. Each target binary is built for one display size, so these fold
+// to literals at compile time and the unused small/big and rect/round branches drop out.
+#define YES_MIN_DIM (PBL_DISPLAY_WIDTH < PBL_DISPLAY_HEIGHT ? PBL_DISPLAY_WIDTH : PBL_DISPLAY_HEIGHT)
+#define YES_FACE_R (YES_MIN_DIM / 2)
+
+// Displays of at least 200 px (Emery, Gabbro) use the next font size up.
+#define YES_LAYOUT_BIG (YES_MIN_DIM >= 200)
+
+// A "baseline Basalt" pixel value (face_r 72) scaled to this display's face radius, rounded,
+// and never below 1 px.
+#define YES_PX_RAW(base) (((base) * YES_FACE_R + 36) / 72)
+#define YES_PX(base) ((int16_t)(YES_PX_RAW(base) < 1 ? 1 : YES_PX_RAW(base)))
+
+// Fonts
+#define YES_FONT_KEY_LABEL (YES_LAYOUT_BIG ? FONT_KEY_GOTHIC_18_BOLD : FONT_KEY_GOTHIC_14_BOLD)
+#define YES_FONT_KEY_SMALL (YES_LAYOUT_BIG ? FONT_KEY_GOTHIC_14_BOLD : FONT_KEY_GOTHIC_09)
+#define YES_FONT_KEY_TIME (YES_LAYOUT_BIG ? FONT_KEY_GOTHIC_28_BOLD : FONT_KEY_GOTHIC_24_BOLD)
+
+// Dial: the moon ring sits YES_MOON_INSET in from the edge, the solar disk starts at the ring's
+// inner edge and the night wedge 1 px inside that.
+#define YES_MOON_INSET ((uint16_t)YES_PX(22))
+#ifdef PBL_COLOR
+#define YES_MOON_BASE_THICKNESS ((uint16_t)YES_PX(5))
+#else
+#define YES_MOON_BASE_THICKNESS ((uint16_t)YES_PX(2))
+#endif
+#define YES_MOON_UP_THICKNESS ((uint16_t)YES_PX(5))
+#define YES_SOLAR_INSET ((uint16_t)(YES_MOON_INSET + YES_MOON_UP_THICKNESS / 2))
+#define YES_NIGHT_INSET ((uint16_t)(YES_SOLAR_INSET + YES_PX(1)))
+
+// Corners
+#define YES_CORNER_PAD YES_PX(6)
+#define YES_CORNER_LINE_H (YES_LAYOUT_BIG ? YES_PX(24) : YES_PX(20))
@@ -0,0 +1,148 @@
+#include "yes_prof.h"
+
+#if ENABLE_DEBUG_SCREEN
+
+#include "yes_sched.h"
+
+// Summary to the log every N minute ticks (APP_LOG itself is not free over the wire). The
+// emulator benchmark (scripts/emulator-bench.py) builds with 1.
+#ifndef PROF_LOG_EVERY_MIN
+#define PROF_LOG_EVERY_MIN 10
+#endif
+
+typedef struct {
+  uint16_t last_ms;
+  uint16_t max_ms;
+  uint32_t total_ms;
+  uint32_t count;
+} ProfStat;
+
+typedef struct {
+  uint32_t redraws;
+  uint32_t wakes;  // scheduler timers + minute ticks
+} ProfHour;
+
+static ProfStat s_stats[YES_PROF_COUNT];
+static ProfHour s_hour;       // current, partial hour
+static ProfHour s_last_hour;  // last complete hour
+static bool s_have_last_hour;
+static uint32_t s_hour_sched_base;
+static int s_hour_ticks;
+static int s_log_ticks;
+static size_t s_heap_high;
+static uint32_t s_startup_ms;
+static uint32_t s_first_frame_ms;
+static bool s_have_first_frame;
+static bool s_startup_done;
+
+uint32_t yes_prof_now_ms(void) {
+  time_t sec = 0;
+  uint16_t ms = 0;
+  time_ms(&sec, &ms);
+  return (uint32_t)sec * 1000u + ms;
+}
+
+void yes_prof_add(YesProfStage stage, uint32_t start_ms) {
+  if (stage >= YES_PROF_COUNT) return;
+  const uint32_t dt = yes_prof_now_ms() - start_ms;
+  ProfStat *s = &s_stats[stage];
+  s->last_ms = (uint16_t)(dt > 0xffff ? 0xffff : dt);
+  if (s->last_ms > s->max_ms) s->max_ms = s->last_ms;
+  s->total_ms += dt;
+  s->count++;
+}
+
+void yes_prof_count_redraw(void) {
+  s_hour.redraws++;
+}
+
+void yes_prof_sample_heap(void) {
+  const size_t used = heap_bytes_used();
+  if (used > s_heap_high) s_heap_high = used;
+}
+
+void yes_prof_startup_begin(void) {
+  s_startup_ms = yes_prof_now_ms();
+  s_have_first_frame = false;
+  s_startup_done = false;
+}
+
+void yes_prof_startup_frame(bool complete) {
+  if (s_startup_done) return;
+  const uint32_t dt = yes_prof_now_ms() - s_startup_ms;
+  if (!s_have_first_frame) {
+    s_first_frame_ms = dt;
+    s_have_first_frame = true;
+  }
+  if (!complete) return;
+  s_startup_done = true;
+  APP_LOG(APP_LOG_LEVEL_INFO, "prof startup frame0 %lums complete %lums",
+          (unsigned long)s_first_frame_ms, (unsigned long)dt);
+}
+
+static uint32_t hour_wakes_now(void) {
+  return s_hour.wakes + (yes_sched_wake_count() - s_hour_sched_base);
+}
+
+static uint32_t avg_ms_x10(const ProfStat *s) {
+  return s->count ? (s->total_ms * 10 + s->count / 2) / s->count : 0;
+}
+
+void yes_prof_tick(void) {
+  s_hour.wakes++;
+  yes_prof_sample_heap();
+  if (++s_hour_ticks >= 60) {
+    s_last_hour = (ProfHour){ .redraws = s_hour.redraws, .wakes = hour_wakes_now() };
+    s_have_last_hour = true;
+    s_hour = (ProfHour){ 0 };
+    s_hour_sched_base = yes_sched_wake_count();
+    s_hour_ticks = 0;
+  }
+  if (++s_log_ticks >= PROF_LOG_EVERY_MIN) {
+    s_log_ticks = 0;
+    const ProfStat *f = &s_stats[YES_PROF_FACE];
+    const ProfStat *c = &s_stats[YES_PROF_CORNERS];
+    APP_LOG(APP_LOG_LEVEL_INFO, "prof face %u/%ums n=%lu corners %u/%ums fb %ums inbox %ums rd=%lu wk=%lu m=%d heap=%u",
+            f->last_ms, f->max_ms, (unsigned long)f->count, c->last_ms, c->max_ms,
+            s_stats[YES_PROF_FALLBACK].max_ms, s_stats[YES_PROF_INBOX].max_ms,
+            (unsigned long)s_hour.redraws, (unsigned long)hour_wakes_now(), s_hour_ticks, (unsigned)s_heap_high);
+  }
+}
+
+void yes_prof_format(int line, char *out, size_t out_sz) {
+  const ProfStat *st = s_stats;
+  switch (line) {
+    case 0: {
+      const uint32_t a = avg_ms_x10(&st[YES_PROF_FACE]);
+      snprintf(out, out_sz, "FACE %u/%u avg %lu.%lu",
+               st[YES_PROF_FACE].last_ms, st[YES_PROF_FACE].max_ms,
+               (unsigned long)(a / 10), (unsigned long)(a % 10));
+      break;
+    }
+    case 1:
+      snprintf(out, out_sz, "BG %u SC %u MN %u HD %u",
+               st[YES_PROF_BG].max_ms, st[YES_PROF_SCALE].max_ms,
+               st[YES_PROF_MOON].max_ms, st[YES_PROF_HAND].max_ms);
+      break;
+    case 2:
+      snprintf(out, out_sz, "CRN %u %u %u %u /%u",
+               st[YES_PROF_CORNER_TL].max_ms, st[YES_PROF_CORNER_TR].max_ms,
+               st[YES_PROF_CORNER_BL].max_ms, st[YES_PROF_CORNER_BR].max_ms,
+               st[YES_PROF_CORNERS].max_ms);
+      break;
+    case 3:
+      snprintf(out, out_sz, "FB %u IN %u HEAP %u",
+               st[YES_PROF_FALLBACK].max_ms, st[YES_PROF_INBOX].max_ms, (unsigned)s_heap_high);
+      break;
+    default: {
+      // Last complete hour once we have one; until then the partial hour so far.
+      const uint32_t rd = s_have_last_hour ? s_last_hour.redraws : s_hour.redraws;
+      const uint32_t wk = s_have_last_hour ? s_last_hour.wakes : hour_wakes_now();
+      snprintf(out, out_sz, "%s RD %lu WK %lu", s_have_last_hour ? "1h" : "now",
+               (unsigned long)rd, (unsigned long)wk);
+      break;
+    }
+  }
+}
+
+#endif // ENABLE_DEBUG_SCREEN
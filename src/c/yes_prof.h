@@ -0,0 +1,58 @@
+#pragma once
+
+#include <pebble.h>
+
+#ifndef ENABLE_DEBUG_SCREEN
+#define ENABLE_DEBUG_SCREEN 0
+#endif
+
+// Render/compute profiler for the debug build. Stages are timed with time_ms(); counters roll
+// over every hour of minute ticks. Everything compiles away when ENABLE_DEBUG_SCREEN is 0.
+typedef enum {
+  YES_PROF_FACE = 0,  // canvas_update_proc total
+  YES_PROF_BG,        // dial rings, night disk and day wedge (cache miss only)
+  YES_PROF_SCALE,     // draw_outer_scale (cache miss only)
+  YES_PROF_MOON,      // draw_moon (cache miss only)
+  YES_PROF_HAND,      // hand, hub and digital time
+  YES_PROF_CORNER_TL,
+  YES_PROF_CORNER_TR,
+  YES_PROF_CORNER_BL,
+  YES_PROF_CORNER_BR,
+  YES_PROF_CORNERS,   // corner_update_proc total
+  YES_PROF_FALLBACK,  // one fallback_calc_cb slice
+  YES_PROF_INBOX,     // inbox_received
+  YES_PROF_COUNT,
+} YesProfStage;
+
+#if ENABLE_DEBUG_SCREEN
+
+uint32_t yes_prof_now_ms(void);
+void yes_prof_add(YesProfStage stage, uint32_t start_ms);
+void yes_prof_count_redraw(void);
+void yes_prof_sample_heap(void);
+// Call once per minute tick: rolls hourly counters and emits a sampled APP_LOG summary.
+void yes_prof_tick(void);
+// Startup: begin at the top of init, frame after every face draw. Logs once, at the first complete
+// (non-loading) frame, the time to frame 0 and to that frame.
+void yes_prof_startup_begin(void);
+void yes_prof_startup_frame(bool complete);
+// Perf debug page, one text line per call (line 0..YES_PROF_LINES-1).
+#define YES_PROF_LINES 5
+void yes_prof_format(int line, char *out, size_t out_sz);
+
+#define YES_PROF_BEGIN(var) const uint32_t var = yes_prof_now_ms()
+#define YES_PROF_END(stage, var) yes_prof_add((stage), (var))
+#define YES_PROF_END_IF(cond, stage, var) do { if (cond) yes_prof_add((stage), (var)); } while (0)
+
+#else
+
+#define YES_PROF_BEGIN(var)
+#define YES_PROF_END(stage, var)
+#define YES_PROF_END_IF(cond, stage, var)
+static inline void yes_prof_count_redraw(void) {}
+static inline void yes_prof_sample_heap(void) {}
+static inline void yes_prof_tick(void) {}
+static inline void yes_prof_startup_begin(void) {}
+static inline void yes_prof_startup_frame(bool complete) { (void)complete; }
+
+#endif
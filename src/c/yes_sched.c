@@ -0,0 +1,97 @@
+#include "yes_sched.h"
+
+typedef struct {
+  uint64_t due_ms;
+  uint32_t slack_ms;
+  YesJobFn fn;
+} YesJob;
+
+// Timers can fire a hair early relative to time_ms(); treat that as on time.
+#define SCHED_EPSILON_MS 10
+
+static YesJob s_jobs[YES_JOB_COUNT];
+static AppTimer *s_timer;
+static uint64_t s_timer_at_ms;
+static uint32_t s_wakes;
+static bool s_running;
+
+static uint64_t now_ms(void) {
+  time_t sec = 0;
+  uint16_t ms = 0;
+  time_ms(&sec, &ms);
+  return (uint64_t)sec * 1000u + ms;
+}
+
+static void timer_cb(void *context);
+
+// Arm the single timer for the latest moment that still honours every job's slack.
+static void rearm(void) {
+  if (s_running) return; // run_due re-arms once all jobs of this wake are done
+  uint64_t at = UINT64_MAX;
+  for (int i = 0; i < YES_JOB_COUNT; i++) {
+    if (!s_jobs[i].fn) continue;
+    const uint64_t latest = s_jobs[i].due_ms + s_jobs[i].slack_ms;
+    if (latest < at) at = latest;
+  }
+  if (at == UINT64_MAX) {
+    if (s_timer) app_timer_cancel(s_timer);
+    s_timer = NULL;
+    return;
+  }
+  if (s_timer && s_timer_at_ms == at) return;
+  const uint64_t now = now_ms();
+  const uint32_t delay = (at > now) ? (uint32_t)(at - now) : 0;
+  if (s_timer && app_timer_reschedule(s_timer, delay)) {
+    s_timer_at_ms = at;
+    return;
+  }
+  s_timer = app_timer_register(delay, timer_cb, NULL);
+  s_timer_at_ms = at;
+}
+
+void yes_sched_run_due(void) {
+  s_running = true;
+  // Jobs may re-arm themselves (or each other); a re-armed job is not due again in this pass.
+  const uint64_t now = now_ms();
+  for (int i = 0; i < YES_JOB_COUNT; i++) {
+    if (!s_jobs[i].fn || s_jobs[i].due_ms > now + SCHED_EPSILON_MS) continue;
+    const YesJobFn fn = s_jobs[i].fn;
+    s_jobs[i].fn = NULL;
+    fn();
+  }
+  s_running = false;
+  rearm();
+}
+
+static void timer_cb(void *context) {
+  (void)context;
+  s_timer = NULL;
+  s_wakes++;
+  yes_sched_run_due();
+}
+
+void yes_sched_at(YesJobId id, uint32_t delay_ms, uint32_t slack_ms, YesJobFn fn) {
+  if (id >= YES_JOB_COUNT || !fn) return;
+  s_jobs[id] = (YesJob){ .due_ms = now_ms() + delay_ms, .slack_ms = slack_ms, .fn = fn };
+  rearm();
+}
+
+void yes_sched_cancel(YesJobId id) {
+  if (id >= YES_JOB_COUNT || !s_jobs[id].fn) return;
+  s_jobs[id].fn = NULL;
+  rearm();
+}
+
+bool yes_sched_pending(YesJobId id) {
+  return id < YES_JOB_COUNT && s_jobs[id].fn != NULL;
+}
+
+void yes_sched_deinit(void) {
+  for (int i = 0; i < YES_JOB_COUNT; i++) s_jobs[i].fn = NULL;
+  if (s_timer) app_timer_cancel(s_timer);
+  s_timer = NULL;
+}
+
+uint32_t yes_sched_wake_count(void) {
+  return s_wakes;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <pebble.h>
+
+// One AppTimer for every deferred job in the app. Each job has a deadline and a slack: it may run
+// anywhere in [deadline, deadline + slack], so jobs that come due close together share one wake.
+// The minute tick also drains due jobs, letting minute-aligned work ride on a wake that already happens.
+typedef enum {
+  YES_JOB_STARTUP = 0,  // first location request after the event loop is up
+  YES_JOB_FALLBACK,     // sliced on-watch sun/moon solvers
+  YES_JOB_UI,           // corner alternation on the configured cadence (rect only)
+  YES_JOB_BATTERY,      // battery re-evaluation after a charge-state change (rect only)
+  YES_JOB_PERSIST,      // coalesced yes_store record writes
+  YES_JOB_LOW_POWER,    // resend of KEY_LOW_POWER_ACTIVE after a failed send
+  YES_JOB_COUNT,
+} YesJobId;
+
+typedef void (*YesJobFn)(void);
+
+// (Re)arm a job. Replaces any pending deadline for the same id.
+void yes_sched_at(YesJobId id, uint32_t delay_ms, uint32_t slack_ms, YesJobFn fn);
+void yes_sched_cancel(YesJobId id);
+bool yes_sched_pending(YesJobId id);
+
+// Run every job whose deadline has passed; call from wakes the app gets anyway (minute tick).
+void yes_sched_run_due(void);
+
+// Cancel everything.
+void yes_sched_deinit(void);
+
+// Wakes taken by the scheduler's own timer (for the debug screen).
+uint32_t yes_sched_wake_count(void);
@@ -0,0 +1,9 @@
+#pragma once
+
+// Modules shared with the background worker (worker_src/c) include the SDK through here: the
+// worker build defines YES_WORKER and only has pebble_worker.h.
+#ifdef YES_WORKER
+#include <pebble_worker.h>
+#else
+#include <pebble.h>
+#endif
@@ -0,0 +1,116 @@
+#include "yes_store.h"
+
+#include <string.h>
+
+#include "yes_sched.h"
+
+// Marks within this window share one write; the slack lets the write ride on the minute tick.
+#define STORE_DELAY_MS 10000
+#define STORE_SLACK_MS 30000
+
+typedef struct {
+  uint32_t key;
+  YesStorePackFn pack;
+  const uint8_t *blob; // blob domains: live buffer and its length, instead of pack
+  const int *blob_len;
+  uint32_t hash; // of the record last read or written, to skip rewriting identical bytes
+  uint16_t size; // blob domains: length last read or written
+  uint8_t version;
+  bool have_hash : 1;
+  bool dirty : 1;
+} StoreDomain;
+
+static StoreDomain s_domains[YES_STORE_COUNT];
+
+static uint32_t record_hash(const uint8_t *p, int len) {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < len; i++) h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+static bool registered(YesStoreId id) {
+  return id < YES_STORE_COUNT && (s_domains[id].pack || s_domains[id].blob);
+}
+
+void yes_store_register(YesStoreId id, uint32_t key, uint8_t version, uint16_t size, YesStorePackFn pack) {
+  if (id >= YES_STORE_COUNT || size > YES_STORE_MAX_SIZE || !pack) return;
+  s_domains[id] = (StoreDomain){ .key = key, .pack = pack, .size = size, .version = version };
+}
+
+void yes_store_register_blob(YesStoreId id, uint32_t key, const void *data, const int *len) {
+  if (id >= YES_STORE_COUNT || !data || !len) return;
+  s_domains[id] = (StoreDomain){ .key = key, .blob = data, .blob_len = len };
+}
+
+int yes_store_read_blob(YesStoreId id, void *buf, int size) {
+  if (!registered(id) || !s_domains[id].blob) return 0;
+  StoreDomain *d = &s_domains[id];
+  const int len = persist_read_data(d->key, buf, size);
+  if (len <= 0) return 0;
+  d->hash = record_hash(buf, len);
+  d->size = (uint16_t)len;
+  d->have_hash = true;
+  return len;
+}
+
+// Writes a flagged blob domain unless its bytes match the stored copy; true when it wrote.
+static bool flush_blob(StoreDomain *d) {
+  const int len = *d->blob_len;
+  if (len <= 0 || len > YES_STORE_BLOB_MAX_SIZE) return false;
+  const uint32_t h = record_hash(d->blob, len);
+  if (d->have_hash && h == d->hash && len == d->size) return false;
+  if (persist_write_data(d->key, d->blob, len) != len) return false;
+  d->hash = h;
+  d->size = (uint16_t)len;
+  d->have_hash = true;
+  return true;
+}
+
+bool yes_store_read(YesStoreId id, void *buf) {
+  if (!registered(id) || !s_domains[id].pack) return false;
+  StoreDomain *d = &s_domains[id];
+  uint8_t rec[1 + YES_STORE_MAX_SIZE];
+  const int len = persist_read_data(d->key, rec, sizeof(rec));
+  if (len != 1 + d->size || rec[0] != d->version) return false;
+  memcpy(buf, &rec[1], d->size);
+  d->hash = record_hash(rec, len);
+  d->have_hash = true;
+  return true;
+}
+
+void yes_store_flush(void) {
+  int writes = 0;
+  for (int i = 0; i < YES_STORE_COUNT; i++) {
+    StoreDomain *d = &s_domains[i];
+    if (!d->dirty) continue;
+    d->dirty = false;
+    if (d->blob) {
+      if (flush_blob(d)) writes++;
+      continue;
+    }
+    // Zeroed first so struct padding the pack function leaves alone hashes the same every time.
+    uint8_t rec[1 + YES_STORE_MAX_SIZE];
+    memset(rec, 0, sizeof(rec));
+    rec[0] = d->version;
+    d->pack(&rec[1]);
+    const int len = 1 + d->size;
+    const uint32_t h = record_hash(rec, len);
+    if (d->have_hash && h == d->hash) continue;
+    if (persist_write_data(d->key, rec, len) == len) {
+      d->hash = h;
+      d->have_hash = true;
+      writes++;
+    }
+  }
+  yes_sched_cancel(YES_JOB_PERSIST);
+  if (writes) APP_LOG(APP_LOG_LEVEL_DEBUG, "store: %d record(s) written", writes);
+}
+
+void yes_store_mark(YesStoreId id) {
+  if (!registered(id)) return;
+  s_domains[id].dirty = true;
+  // Not re-armed while pending: a steady stream of marks still flushes within the window.
+  if (!yes_sched_pending(YES_JOB_PERSIST)) {
+    yes_sched_at(YES_JOB_PERSIST, STORE_DELAY_MS, STORE_SLACK_MS, yes_store_flush);
+  }
+}
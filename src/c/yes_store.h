@@ -0,0 +1,43 @@
+#pragma once
+
+#include <pebble.h>
+
+// Versioned persist records: one persist_write_data key per domain, holding a version byte and the
+// domain's packed state. Marking a domain only flags it; one deferred job (YES_JOB_PERSIST) packs
+// and writes every flagged domain, so a burst of phone messages costs one flash write per domain,
+// and a record whose bytes did not change is not rewritten at all. Blob domains hold a
+// variable-length buffer that carries its own version, written verbatim on the same terms.
+typedef enum {
+  YES_STORE_SETTINGS = 0, // phone config
+  YES_STORE_HOME,         // phone location
+  YES_STORE_EVENTS,       // today's sun/moon events and moon phase
+  YES_STORE_ALT,          // altitude corner (tide and weather live in their forecast blobs)
+  YES_STORE_ASTRO_DAYS,   // blob: multi-day sun/moon forecast
+  YES_STORE_TIDE_EVENTS,  // blob: upcoming tide highs and lows
+  YES_STORE_WX_HOURS,     // blob: hourly weather forecast
+  YES_STORE_COUNT,
+} YesStoreId;
+
+// Fills buf (the registered size) from the domain's live state.
+typedef void (*YesStorePackFn)(void *buf);
+
+// Records are at most YES_STORE_MAX_SIZE bytes (persist values cap at 256 including the version).
+#define YES_STORE_MAX_SIZE 64
+
+void yes_store_register(YesStoreId id, uint32_t key, uint8_t version, uint16_t size, YesStorePackFn pack);
+
+// Reads the record into buf. False when it is missing or was written with another version or size.
+bool yes_store_read(YesStoreId id, void *buf);
+
+// A blob domain writes the live buffer data[0..*len) when flushed; nothing while *len is 0.
+#define YES_STORE_BLOB_MAX_SIZE 256
+void yes_store_register_blob(YesStoreId id, uint32_t key, const void *data, const int *len);
+
+// Reads a blob domain into buf (up to size bytes). Returns the length read, or 0 when missing.
+int yes_store_read_blob(YesStoreId id, void *buf, int size);
+
+// Flag a domain for the next coalesced write.
+void yes_store_mark(YesStoreId id);
+
+// Write every flagged domain now (deinit, migration).
+void yes_store_flush(void);
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <pebble.h>
+#include "yes_sdk.h"
+#include "yes_batt.h"
 
 typedef struct {
   int32_t lat_e6;
@@ -26,3 +27,64 @@ typedef struct {
 } MoonTimes;
 
 
+
+typedef struct {
+  int32_t last_unix;
+  int32_t next_unix;
+  int16_t level_x10;
+  bool valid : 1;
+  bool next_is_high : 1;
+  bool level_is_ft : 1;
+} YesTideState;
+
+typedef struct {
+  int32_t m;
+  bool valid : 1;
+  bool is_ft : 1;
+} YesAltState;
+
+typedef struct {
+  int16_t temp_c10;
+  int16_t wind_spd_x10;
+  int16_t wind_dir_deg;
+  int16_t precip_x10;
+  int16_t uv_x10;
+  int16_t pressure_hpa_x10;
+  uint8_t code;
+  bool valid : 1;
+  bool is_day : 1;
+  bool is_f : 1;
+} YesWeatherState;
+
+// Everything the face and corner layers render from. The app owns a single instance and
+// updates it in place; drawing code only ever sees it through a const pointer.
+typedef struct {
+  const GeoLoc *loc;
+  const SunTimes *sun;
+  const MoonTimes *moon;
+  const YesBattFit *batt_fit; // learned battery cost split (debug page)
+  YesTideState tide;
+  YesAltState alt;
+  YesWeatherState weather;
+  int32_t moon_phase_e6;
+  uint8_t battery_percent;
+  uint8_t ui_update_interval_sec;
+  bool have_phase : 1;
+  bool battery_alert : 1;
+  bool net_on : 1;
+  bool debug : 1;
+  bool debug_perf : 1; // debug screen shows the profiler page
+  bool debug_batt : 1; // debug screen shows the battery cost page
+  bool low_power : 1;  // corners stop rotating, moon phase redraws in coarser steps
+} YesFaceState;
+
+// Parts selectable for yes_face_state_hash().
+enum {
+  YES_STATE_EVENTS  = 1 << 0, // sun/moon events and moon phase
+  YES_STATE_LOC     = 1 << 1,
+  YES_STATE_TIDE    = 1 << 2,
+  YES_STATE_ALT     = 1 << 3,
+  YES_STATE_WEATHER = 1 << 4,
+  YES_STATE_MISC    = 1 << 5, // battery, debug/net flags, UI cadence
+  YES_STATE_ALL     = 0x3f,
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "yes_batt.h"
+#include "yes_types.h"
+
+// Contract between the face and its background worker (worker_src/c). The worker keeps the
+// battery model fed while the face is closed and keeps today's and tomorrow's sun/moon solved;
+// both land in persist keys only the worker writes, so the face starts warm and reads instead of
+// computing. An AppWorkerMessage tells a running face that a key changed.
+
+// Read by the worker: the face's home record (see yes_store.h), a version byte then a GeoLoc.
+#define YES_WORKER_HOME_KEY 201
+#define YES_WORKER_HOME_VERSION 1
+
+// Written by the worker, each a version byte then the struct.
+#define YES_WORKER_BATT_KEY 210
+#define YES_WORKER_BATT_VERSION 1
+#define YES_WORKER_EVENTS_KEY 211     // YesWorkerEventDays
+#define YES_WORKER_EVENTS_VERSION 2
+#define YES_WORKER_HISTORY_KEY 212 // YesBattHistory
+#define YES_WORKER_HISTORY_VERSION 1
+#define YES_WORKER_FIT_KEY 213     // YesBattFit
+#define YES_WORKER_FIT_VERSION 1
+
+// Persist values are capped at 256 bytes.
+#define YES_WORKER_RECORD_MAX 255
+
+typedef struct {
+  int32_t ymd; // local day the events belong to
+  int32_t lat_e6;
+  int32_t lon_e6;
+  int32_t tz_offset_min; // UTC offset they were computed for
+  SunTimes sun;
+  MoonTimes moon;
+} YesWorkerEvents;
+
+// Today and tomorrow (local days at the home location), so the face finds its day whichever side
+// of midnight it starts on. An unsolved entry has ymd 0.
+#define YES_WORKER_EVENT_DAYS 2
+typedef struct {
+  YesWorkerEvents day[YES_WORKER_EVENT_DAYS];
+} YesWorkerEventDays;
+
+static inline bool yes_worker_near(int32_t a, int32_t b, int32_t tol) {
+  return a - b <= tol && b - a <= tol;
+}
+
+// The entry for ymd solved at this place (within tol_e6) and UTC offset, or NULL.
+static inline const YesWorkerEvents *yes_worker_events_find(const YesWorkerEventDays *days, int32_t ymd,
+                                                            int32_t lat_e6, int32_t lon_e6,
+                                                            int32_t tz_offset_min, int32_t tol_e6) {
+  for (int i = 0; i < YES_WORKER_EVENT_DAYS; i++) {
+    const YesWorkerEvents *ev = &days->day[i];
+    if (ymd && ev->ymd == ymd && ev->tz_offset_min == tz_offset_min &&
+        yes_worker_near(ev->lat_e6, lat_e6, tol_e6) && yes_worker_near(ev->lon_e6, lon_e6, tol_e6)) {
+      return ev;
+    }
+  }
+  return NULL;
+}
+
+// AppWorkerMessage types. Worker to face, no payload: a key changed (BATT covers the fit too).
+// Face to worker: ACTIVITY carries redraws, wakes and phone messages since the last report.
+enum {
+  YES_WORKER_MSG_BATT = 1,
+  YES_WORKER_MSG_EVENTS = 2,
+  YES_WORKER_MSG_ACTIVITY = 3,
+};
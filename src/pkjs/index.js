@@ -24,32 +24,22 @@ const KEYS = {
   HOME_MOONSET_MIN: 'KEY_HOME_MOONSET_MIN',
 
   MOON_PHASE_E6: 'KEY_MOON_PHASE_E6',
+  HOME_ASTRO_DAYS: 'KEY_HOME_ASTRO_DAYS',
 
-  TIDE_HAVE: 'KEY_TIDE_HAVE',
-  TIDE_LAST_UNIX: 'KEY_TIDE_LAST_UNIX',
-  TIDE_NEXT_UNIX: 'KEY_TIDE_NEXT_UNIX',
-  TIDE_NEXT_IS_HIGH: 'KEY_TIDE_NEXT_IS_HIGH',
-  TIDE_LEVEL_X10: 'KEY_TIDE_LEVEL_X10',
-  TIDE_LEVEL_IS_FT: 'KEY_TIDE_LEVEL_IS_FT',
+  TIDE_EVENTS: 'KEY_TIDE_EVENTS',
 
   ALT_VALID: 'KEY_ALT_VALID',
   ALT_M: 'KEY_ALT_M',
   ALT_IS_FT: 'KEY_ALT_IS_FT',
 
-  WEATHER_TEMP_C10: 'KEY_WEATHER_TEMP_C10',
-  WEATHER_CODE: 'KEY_WEATHER_CODE',
-  WEATHER_IS_DAY: 'KEY_WEATHER_IS_DAY',
-  WEATHER_IS_F: 'KEY_WEATHER_IS_F',
-
-  WEATHER_WIND_SPD_X10: 'KEY_WEATHER_WIND_SPD_X10',
-  WEATHER_WIND_DIR_DEG: 'KEY_WEATHER_WIND_DIR_DEG',
-  WEATHER_PRECIP_X10: 'KEY_WEATHER_PRECIP_X10',
-  WEATHER_UV_X10: 'KEY_WEATHER_UV_X10',
-  WEATHER_PRESSURE_HPA_X10: 'KEY_WEATHER_PRESSURE_HPA_X10',
+  WEATHER_HOURS: 'KEY_WEATHER_HOURS',
 
   USE_INTERNET_FALLBACK: 'KEY_USE_INTERNET_FALLBACK',
   UI_UPDATE_INTERVAL_SEC: 'KEY_UI_UPDATE_INTERVAL_SEC',
-  LANGUAGE: 'KEY_LANGUAGE'
+  LANGUAGE: 'KEY_LANGUAGE',
+  LOW_POWER_MODE: 'KEY_LOW_POWER_MODE',
+  BATT_MODEL: 'KEY_BATT_MODEL',
+  LOW_POWER_ACTIVE: 'KEY_LOW_POWER_ACTIVE'
 };
 
 function log() {
@@ -63,33 +53,59 @@ function log() {
 const State = {
   lastSentAtMs: 0,
   lastLocRequestAtMs: 0,
+  locPollMs: 0,           // current GPS poll interval (see location policy)
+  locPollTimer: null,
+  locStationaryAnchor: null, // {latE6, lonE6} where the current stationary stretch began
+  locAnchors: {},         // consumer -> {latE6, lonE6} it last acted on
+  lastAltSent: null,      // {valid, altM, isFt}
   lastLoc: null,      // {latE6, lonE6, tzOffsetMin}
   lastLocSent: null,  // {latE6, lonE6, tzOffsetMin, ymd} persisted
   lastAstroYmd: 0,
+  astroDaysThroughYmd: 0, // last day covered by the forecast the watch holds
 
-  tideStations: null, // [{id, lat, lng}] cached in-memory
+  tideStations: null, // station index (see unpackTideStations), built on first lookup
+  tideStationsPacked: null, // packed index read at startup, not parsed yet
+  tideStationsPartial: false, // index came from a download that did not finish
   tideStationsFetchedAtMs: 0,
   lastTideSentAtMs: 0,
   lastTideSuccessAtMs: 0,
   lastTideAttemptAtMs: 0,
-  lastTideLoc: null, // {latE6, lonE6}
 
   lastWeatherSentAtMs: 0,
   lastWeatherSuccessAtMs: 0,
   lastWeatherAttemptAtMs: 0,
-  lastWeatherLoc: null, // {latE6, lonE6}
 
   isSending: false,
-  msgQueue: []
+  msgPending: {},     // key -> value waiting for the next batch (newest value wins)
+  msgPendingCbs: [],  // onSuccess callbacks, run once everything queued before them is delivered
+  msgAcked: {},       // key -> last value the watch acked; unchanged keys are not resent
+  msgFlushTimer: null,
+  msgRetryMs: 0,
+
+  httpCache: null,       // url key -> entry, loaded from localStorage on first use
+  httpCacheSaveTimer: null,
+  httpInFlight: {},      // url key -> promise of the request currently running
+
+  astroMemo: new Map(),  // see astroMemo()
+
+  watchLowPower: false   // KEY_LOW_POWER_ACTIVE from the watch
 };
 
 const TIDE_NEAR_COAST_THRESHOLD_M = 50000; // 50 km
 const TIDE_STATION_CACHE_MS = 7 * 24 * 60 * 60 * 1000; // refresh weekly
-const TIDE_REFRESH_MS = 60 * 60 * 1000; // refresh predictions hourly
+const TIDE_REFRESH_MS = 6 * 60 * 60 * 1000; // the watch holds the next TIDE_EVENTS_MAX highs/lows
+const TIDE_EVENTS_MAX = 8; // ~2 days; matches TIDE_EVENTS_MAX on the watch
 const TIDE_STATION_FETCH_TIMEOUT_MS = 60000; // large one-time download; cache afterwards
+const TIDE_STATION_PARTIAL_TTL_MS = 60 * 60 * 1000; // a cut-off download is used, then retried sooner
+const HTTP_RANGE_CHUNK_BYTES = 256 * 1024;
 const TIDE_RETRY_MS = 2 * 60 * 1000; // retry quickly on failure
 
-const WEATHER_REFRESH_MS = 30 * 60 * 1000; // weather doesn't need to be frequent
+const WEATHER_REFRESH_MS = 2 * 60 * 60 * 1000; // the watch steps through WX_HOURS_MAX forecast hours
+// While the watch reports low power, tide and weather refreshes are this many times further apart
+// (18 h and 6 h: still inside the 8 tide events and 24 forecast hours the watch holds).
+const LOW_POWER_REFRESH_FACTOR = 3;
+const WX_HOURS_MAX = 24; // matches WX_HOURS_MAX on the watch
+const WX_PRESSURE_BASE_HPA = 880;
 const WEATHER_RETRY_MS = 2 * 60 * 1000; // retry quickly on failure
 const UPDATE_INTERVAL_CHOICES_SEC = [5, 10, 30, 60];
 const LANGUAGE_IDS = { en: 0, de: 1, fr: 2, es: 3, pt: 4, it: 5 };
@@ -102,25 +118,123 @@ const LANGUAGE_LABELS = {
   it: 'Italiano'
 };
 
+// --- NOAA tide station index ---
+// Stations are bucketed into TIDE_CELL_DEG x TIDE_CELL_DEG cells so a lookup only scans the
+// cells within reach of the search radius. Stored packed, sorted by cell:
+//   'T1|<cellDeg>|id,latE4,lngE4;id,latE4,lngE4;...'  (E4 values in base 36)
+// Parsing is deferred to the first lookup, so startup only pays for the localStorage read.
+const TIDE_INDEX_VERSION = 'T1';
+const TIDE_CELL_DEG = 2;
+const TIDE_CELLS_X = 360 / TIDE_CELL_DEG;
+const METERS_PER_DEG = 111195;
+
+function tideCellOf(latDeg, lonDeg) {
+  const cy = Math.min(180 / TIDE_CELL_DEG - 1, Math.max(0, Math.floor((latDeg + 90) / TIDE_CELL_DEG)));
+  let cx = Math.floor((lonDeg + 180) / TIDE_CELL_DEG) % TIDE_CELLS_X;
+  if (cx < 0) cx += TIDE_CELLS_X;
+  return { cy: cy, cx: cx };
+}
+
+// stations: [{id, lat, lng}] -> packed string (sorted by cell, so each cell is one run).
+function packTideStations(stations) {
+  const recs = [];
+  for (let i = 0; i < stations.length; i++) {
+    const s = stations[i];
+    const c = tideCellOf(s.lat, s.lng);
+    recs.push({ key: c.cy * TIDE_CELLS_X + c.cx, s: s });
+  }
+  recs.sort((a, b) => a.key - b.key);
+  const parts = new Array(recs.length);
+  for (let i = 0; i < recs.length; i++) {
+    const s = recs[i].s;
+    parts[i] = s.id + ',' + Math.round(s.lat * 1e4).toString(36) + ',' + Math.round(s.lng * 1e4).toString(36);
+  }
+  return TIDE_INDEX_VERSION + '|' + TIDE_CELL_DEG + '|' + parts.join(';');
+}
+
+// Packed string -> {count, ids, lat, lng, cells: Map(cellKey -> [start, end))} or null.
+function unpackTideStations(packed) {
+  const head = String(packed || '').split('|', 2);
+  if (head.length < 2 || head[0] !== TIDE_INDEX_VERSION || parseInt(head[1], 10) !== TIDE_CELL_DEG) return null;
+  const body = packed.slice(head[0].length + head[1].length + 2);
+  if (!body) return null;
+  const recs = body.split(';');
+  const n = recs.length;
+  const idx = { count: 0, ids: new Array(n), lat: new Float64Array(n), lng: new Float64Array(n), cells: new Map() };
+  let prevKey = -1;
+  for (let i = 0; i < n; i++) {
+    const f = recs[i].split(',');
+    if (f.length !== 3) return null;
+    const lat = parseInt(f[1], 36) / 1e4;
+    const lng = parseInt(f[2], 36) / 1e4;
+    if (!isFinite(lat) || !isFinite(lng)) return null;
+    const c = tideCellOf(lat, lng);
+    const key = c.cy * TIDE_CELLS_X + c.cx;
+    if (key < prevKey) return null; // not sorted: corrupt
+    if (key !== prevKey) idx.cells.set(key, [i, i + 1]);
+    else idx.cells.get(key)[1] = i + 1;
+    prevKey = key;
+    idx.ids[i] = f[0];
+    idx.lat[i] = lat;
+    idx.lng[i] = lng;
+  }
+  idx.count = n;
+  return idx;
+}
+
+function tideStationIndex() {
+  if (!State.tideStations && State.tideStationsPacked) {
+    State.tideStations = unpackTideStations(State.tideStationsPacked);
+    State.tideStationsPacked = null;
+  }
+  return State.tideStations;
+}
+
+function setTideStations(stations, fetchedAtMs, partial) {
+  const packed = packTideStations(stations);
+  State.tideStations = unpackTideStations(packed);
+  State.tideStationsPacked = null;
+  State.tideStationsFetchedAtMs = fetchedAtMs;
+  State.tideStationsPartial = !!partial;
+  return packed;
+}
+
+function tideStationsFresh(nowMs) {
+  const ttl = State.tideStationsPartial ? TIDE_STATION_PARTIAL_TTL_MS : TIDE_STATION_CACHE_MS;
+  return (nowMs - State.tideStationsFetchedAtMs) < ttl;
+}
+
 function loadTideStationsFromStorage() {
   try {
-    const raw = localStorage.getItem('noaaTideStations');
     const at = parseInt(localStorage.getItem('noaaTideStationsAtMs') || '0', 10);
-    if (!raw || !isFinite(at) || at <= 0) return null;
+    if (!isFinite(at) || at <= 0) return false;
+    const packed = localStorage.getItem('noaaTideIndex');
+    if (packed) {
+      State.tideStations = null;
+      State.tideStationsPacked = packed;
+      State.tideStationsFetchedAtMs = at;
+      State.tideStationsPartial = localStorage.getItem('noaaTideIndexPartial') === '1';
+      return true;
+    }
+    // One-time migration from the old JSON array.
+    const raw = localStorage.getItem('noaaTideStations');
+    if (!raw) return false;
     const arr = JSON.parse(raw);
-    if (!arr || !arr.length) return null;
-    State.tideStations = arr;
-    State.tideStationsFetchedAtMs = at;
-    return arr;
+    localStorage.removeItem('noaaTideStations');
+    if (!arr || !arr.length) return false;
+    localStorage.setItem('noaaTideIndex', setTideStations(arr, at));
+    return true;
   } catch (e) {
-    return null;
+    return false;
   }
 }
 
-function saveTideStationsToStorage(stations) {
+function saveTideStationsToStorage(stations, partial) {
+  const packed = setTideStations(stations, Date.now(), partial);
   try {
-    localStorage.setItem('noaaTideStations', JSON.stringify(stations));
-    localStorage.setItem('noaaTideStationsAtMs', String(Date.now()));
+    localStorage.setItem('noaaTideIndex', packed);
+    localStorage.setItem('noaaTideStationsAtMs', String(State.tideStationsFetchedAtMs));
+    localStorage.setItem('noaaTideIndexPartial', partial ? '1' : '0');
   } catch (e) {}
 }
 
@@ -143,109 +257,154 @@ function ymdUtcIntFromUnix(unixSec) {
   return y * 10000 + m * 100 + dd;
 }
 
-function ymdhmUtcFromUnix(unixSec) {
-  const d = new Date(unixSec * 1000);
-  const y = d.getUTCFullYear();
-  const m = d.getUTCMonth() + 1;
-  const dd = d.getUTCDate();
-  const hh = d.getUTCHours();
-  const mm = d.getUTCMinutes();
-  return String(y) + pad2(m) + pad2(dd) + ' ' + pad2(hh) + ':' + pad2(mm);
-}
-
 function parseNoaaLevelMeters(v) {
   const f = parseFloat(String(v || '').replace(',', '.'));
   if (!isFinite(f)) return null;
   return f;
 }
 
-function fetchNoaaLevelX10ForStationGmt(stationId, nowUnix, useImperial) {
-  // Fetch ~±1 hour around now, pick the latest prediction <= now.
-  const now = typeof nowUnix === 'number' ? nowUnix : Math.floor(Date.now() / 1000);
-  const begin = ymdhmUtcFromUnix(now - 3600);
-  const end = ymdhmUtcFromUnix(now + 3600);
-  const url =
-    'https://api.tidesandcurrents.noaa.gov/api/prod/datagetter' +
-    '?product=predictions' +
-    '&application=pebble-yes-watch' +
-    '&begin_date=' + encodeURIComponent(begin) +
-    '&end_date=' + encodeURIComponent(end) +
-    '&datum=MLLW' +
-    '&station=' + encodeURIComponent(String(stationId)) +
-    '&time_zone=gmt' +
-    '&units=metric' +
-    '&interval=6' +
-    '&format=json';
-  return httpGetJson(url).then((json) => {
-    const preds = json && json.predictions ? json.predictions : null;
-    if (!preds || !preds.length) throw new Error('noaa level missing');
-    let best = null;
-    let bestTs = -1;
-    for (let i = 0; i < preds.length; i++) {
-      const p = preds[i];
-      const ts = safeParseUnixFromNoaaGmtTime(p && p.t);
-      if (typeof ts !== 'number') continue;
-      if (ts > now) continue;
-      if (ts >= bestTs) {
-        bestTs = ts;
-        best = p;
+function stationFromJson(s) {
+  const id = s && (s.id || s.stationId || s.station);
+  const lat = s && (typeof s.lat === 'number' ? s.lat : null);
+  const lng = s && (typeof s.lng === 'number' ? s.lng : (typeof s.lon === 'number' ? s.lon : null));
+  if (!id || typeof lat !== 'number' || typeof lng !== 'number') return null;
+  return { id: String(id), lat: lat, lng: lng };
+}
+
+// Incremental scanner for {"stations":[{...},{...}]}: push text as it arrives and each complete
+// station object is parsed on its own, so only the current object is ever held unparsed.
+function createStationStreamParser(onStation) {
+  const P = { buf: '', pos: 0, started: false, depth: 0, inStr: false, esc: false, objStart: -1, done: false };
+  P.push = function(text) {
+    if (P.done || !text) return;
+    P.buf += text;
+    if (!P.started) {
+      const k = P.buf.indexOf('"stations"');
+      const b = k >= 0 ? P.buf.indexOf('[', k) : -1;
+      if (b < 0) {
+        P.buf = P.buf.slice(-16); // key may straddle chunks
+        return;
       }
+      P.started = true;
+      P.buf = P.buf.slice(b + 1);
+      P.pos = 0;
     }
-    if (!best) best = preds[0];
-    const meters = parseNoaaLevelMeters(best && best.v);
-    if (meters === null) throw new Error('noaa level parse');
-    if (useImperial) {
-      const ft = meters * 3.28084;
-      return Math.round(ft * 10); // ft * 10
+    const buf = P.buf;
+    let i = P.pos;
+    for (; i < buf.length; i++) {
+      const ch = buf.charCodeAt(i);
+      if (P.inStr) {
+        if (P.esc) P.esc = false;
+        else if (ch === 92) P.esc = true; // backslash
+        else if (ch === 34) P.inStr = false;
+        continue;
+      }
+      if (ch === 34) {
+        P.inStr = true;
+      } else if (ch === 123) { // {
+        if (P.depth === 0) P.objStart = i;
+        P.depth++;
+      } else if (ch === 125) { // }
+        P.depth--;
+        if (P.depth === 0 && P.objStart >= 0) {
+          let st = null;
+          try { st = stationFromJson(JSON.parse(buf.slice(P.objStart, i + 1))); } catch (e) {}
+          if (st) onStation(st);
+          P.objStart = -1;
+        }
+      } else if (ch === 93 && P.depth === 0) { // ] closes the stations array
+        P.done = true;
+        break;
+      }
     }
-    return Math.round(meters * 10); // m * 10
-  });
+    // Keep only the unfinished object (if any) and resume scanning after what was seen.
+    if (P.objStart >= 0) {
+      P.buf = buf.slice(P.objStart);
+      P.pos = i - P.objStart;
+      P.objStart = 0;
+    } else {
+      P.buf = '';
+      P.pos = 0;
+    }
+  };
+  return P;
 }
 
 function fetchNoaaTideStations() {
   // NOTE: NOAA MDAPI doesn't support lat/lon filtering here, so we download once and pick nearest locally.
   const url = 'https://api.tidesandcurrents.noaa.gov/mdapi/prod/webapi/stations.json?type=tidepredictions';
-  return httpGetJsonTimeout(url, TIDE_STATION_FETCH_TIMEOUT_MS).then((json) => {
-    const arr = json && json.stations ? json.stations : null;
-    if (!arr || !arr.length) throw new Error('noaa stations missing');
-    const out = [];
-    for (let i = 0; i < arr.length; i++) {
-      const s = arr[i];
-      const id = s && (s.id || s.stationId || s.station);
-      const lat = s && (typeof s.lat === 'number' ? s.lat : null);
-      const lng = s && (typeof s.lng === 'number' ? s.lng : (typeof s.lon === 'number' ? s.lon : null));
-      if (!id || typeof lat !== 'number' || typeof lng !== 'number') continue;
-      out.push({ id: String(id), lat: lat, lng: lng });
-    }
+  const out = [];
+  const parser = createStationStreamParser((st) => out.push(st));
+  return httpGetTextStreamed(url, TIDE_STATION_FETCH_TIMEOUT_MS, (text) => {
+    parser.push(text);
+    return parser.done;
+  }).then(() => {
     if (!out.length) throw new Error('noaa stations empty after filter');
-    saveTideStationsToStorage(out);
-    return out;
+    saveTideStationsToStorage(out, false);
+    log('[pkjs] tide stations', out.length);
+    return State.tideStations;
+  }, (err) => {
+    // A cut-off download still covers the stations received so far; keep it unless we already
+    // hold a larger list, and retry sooner.
+    const have = State.tideStations ? State.tideStations.count : 0;
+    if (out.length && out.length > have) {
+      saveTideStationsToStorage(out, true);
+      log('[pkjs] tide stations partial', out.length, String(err && err.message));
+      return State.tideStations;
+    }
+    throw err;
   });
 }
 
-function getNearestTideStation(latDeg, lonDeg) {
-  const stations = State.tideStations;
-  if (!stations || !stations.length) return null;
-  let best = null;
-  let bestD = 1e30;
-  for (let i = 0; i < stations.length; i++) {
-    const s = stations[i];
-    const d = haversineMeters(latDeg, lonDeg, s.lat, s.lng);
-    if (d < bestD) {
-      bestD = d;
-      best = s;
+// Nearest station within maxDistM (default: the coast threshold), or null.
+function getNearestTideStation(latDeg, lonDeg, maxDistM) {
+  const idx = tideStationIndex();
+  if (!idx || !idx.count) return null;
+  const limitM = typeof maxDistM === 'number' ? maxDistM : TIDE_NEAR_COAST_THRESHOLD_M;
+  const limitDeg = limitM / METERS_PER_DEG;
+
+  const c = tideCellOf(latDeg, lonDeg);
+  const dy = Math.ceil(limitDeg / TIDE_CELL_DEG);
+  const edgeLat = Math.min(89.9, Math.abs(latDeg) + limitDeg);
+  const dx = Math.min(TIDE_CELLS_X / 2, Math.ceil(limitDeg / (TIDE_CELL_DEG * Math.cos(deg2rad(edgeLat)))));
+  // Equirectangular pre-filter (in degrees^2, 5% slack) before the exact haversine. It does not
+  // hold across a pole, so there only the latitude band is used.
+  const cosLat = edgeLat < 89 ? Math.cos(deg2rad(latDeg)) : 0;
+  const limEq2 = limitDeg * limitDeg * 1.1;
+
+  let bestI = -1;
+  let bestD = limitM;
+  for (let cy = Math.max(0, c.cy - dy); cy <= Math.min(180 / TIDE_CELL_DEG - 1, c.cy + dy); cy++) {
+    for (let k = -dx; k <= dx; k++) {
+      if (dx === TIDE_CELLS_X / 2 && k === dx) break; // full circle: do not visit a column twice
+      const cx = ((c.cx + k) % TIDE_CELLS_X + TIDE_CELLS_X) % TIDE_CELLS_X;
+      const run = idx.cells.get(cy * TIDE_CELLS_X + cx);
+      if (!run) continue;
+      for (let i = run[0]; i < run[1]; i++) {
+        let dLon = Math.abs(idx.lng[i] - lonDeg);
+        if (dLon > 180) dLon = 360 - dLon;
+        const dLat = idx.lat[i] - latDeg;
+        const x = dLon * cosLat;
+        if (dLat * dLat + x * x > limEq2) continue;
+        const d = haversineMeters(latDeg, lonDeg, idx.lat[i], idx.lng[i]);
+        if (d <= bestD) {
+          bestD = d;
+          bestI = i;
+        }
+      }
     }
   }
-  if (!best) return null;
-  return { id: best.id, distM: bestD };
+  if (bestI < 0) return null;
+  return { id: idx.ids[bestI], distM: bestD };
 }
 
-function fetchNoaaHiLoForStationGmt(stationId, nowUnix) {
-  // Fetch yesterday..tomorrow in GMT so parsing to unix is unambiguous.
+function fetchNoaaHiLoForStationGmt(stationId, nowUnix, useImperial) {
+  // Yesterday..the day after tomorrow in GMT: one past event plus about two days ahead, and
+  // parsing to unix is unambiguous.
   const now = typeof nowUnix === 'number' ? nowUnix : Math.floor(Date.now() / 1000);
   const day = 86400;
   const begin = ymdUtcIntFromUnix(now - day);
-  const end = ymdUtcIntFromUnix(now + day);
+  const end = ymdUtcIntFromUnix(now + 2 * day);
   const url =
     'https://api.tidesandcurrents.noaa.gov/api/prod/datagetter' +
     '?product=predictions' +
@@ -255,10 +414,10 @@ function fetchNoaaHiLoForStationGmt(stationId, nowUnix) {
     '&datum=MLLW' +
     '&station=' + encodeURIComponent(String(stationId)) +
     '&time_zone=gmt' +
-    '&units=metric' +
+    '&units=' + (useImperial ? 'english' : 'metric') +
     '&interval=hilo' +
     '&format=json';
-  return httpGetJson(url).then((json) => {
+  return httpGetJsonCached(url, { ttlMs: HTTP_TTL_MS.tideHiLo }).then((json) => {
     const preds = json && json.predictions ? json.predictions : null;
     if (!preds || !preds.length) throw new Error('noaa predictions missing');
     const events = [];
@@ -267,47 +426,62 @@ function fetchNoaaHiLoForStationGmt(stationId, nowUnix) {
       const ts = safeParseUnixFromNoaaGmtTime(p && p.t);
       const type = p && (p.type || p.T || p.event || p.hl);
       const isHigh = String(type || '').toUpperCase().indexOf('H') >= 0;
-      if (typeof ts !== 'number') continue;
-      events.push({ ts, isHigh });
+      const level = parseNoaaLevelMeters(p && p.v); // ft with units=english
+      if (typeof ts !== 'number' || level === null) continue;
+      events.push({ ts, isHigh, levelX10: Math.round(level * 10) });
     }
     events.sort((a, b) => a.ts - b.ts);
     return events;
   });
 }
 
-function computeTideWindow(events, nowUnix) {
-  if (!events || events.length < 2) return null;
-  const now = typeof nowUnix === 'number' ? nowUnix : Math.floor(Date.now() / 1000);
-  let last = null;
-  let next = null;
+// The last event at or before now, then the ones after it (the watch interpolates between them).
+function upcomingTideEvents(events, nowUnix) {
+  let first = 0;
   for (let i = 0; i < events.length; i++) {
-    const e = events[i];
-    if (e.ts <= now) last = e;
-    if (e.ts > now) { next = e; break; }
+    if (events[i].ts <= nowUnix) first = i;
   }
-  if (!last) last = events[0];
-  if (!next) next = events[events.length - 1];
-  if (!last || !next) return null;
-  if (next.ts <= last.ts) return null;
-  return { lastUnix: last.ts, nextUnix: next.ts, nextIsHigh: next.isHigh ? 1 : 0 };
+  const out = events.slice(first, first + TIDE_EVENTS_MAX);
+  return out.length >= 2 && out[0].ts <= nowUnix ? out : [];
+}
+
+// Layout must match TIDE_EVENTS_* in pebble-yes-watch.c (little-endian). No events: no station.
+function packTideEvents(events, levelIsFt) {
+  const out = [];
+  const u8 = (v) => out.push(v & 0xff);
+  const u16 = (v) => { u8(v); u8(v >> 8); };
+  const u32 = (v) => { u16(v); u16(v >>> 16); };
+  u8(1); // version
+  u8(events.length);
+  u8(levelIsFt ? 1 : 0);
+  u8(0);
+  events.forEach((e) => {
+    u32(e.ts);
+    u16(Math.max(-32768, Math.min(32767, e.levelX10)));
+    u8(e.isHigh ? 1 : 0);
+    u8(0);
+  });
+  return out;
+}
+
+function refreshMs(normalMs) {
+  return State.watchLowPower ? normalMs * LOW_POWER_REFRESH_FACTOR : normalMs;
 }
 
 function maybeSendTides(latE6, lonE6, force) {
   const nowMs = Date.now();
-  const locChanged = !State.lastTideLoc ||
-    (haversineMeters(State.lastTideLoc.latE6 / 1e6, State.lastTideLoc.lonE6 / 1e6, latE6 / 1e6, lonE6 / 1e6) > 2000);
+  const locChanged = locationMovedFor('tide', latE6, lonE6);
   if (locChanged) {
     // New station likely; allow immediate attempt.
     State.lastTideSuccessAtMs = 0;
     force = true;
   }
-  State.lastTideLoc = { latE6: latE6, lonE6: lonE6 };
 
   if (!force && nowMs - State.lastTideAttemptAtMs < 30 * 1000) return; // avoid bursts at startup
   const sinceSuccess = nowMs - (State.lastTideSuccessAtMs || 0);
   const sinceAttempt = nowMs - (State.lastTideAttemptAtMs || 0);
   if (!force) {
-    if (State.lastTideSuccessAtMs && sinceSuccess < TIDE_REFRESH_MS) return;
+    if (State.lastTideSuccessAtMs && sinceSuccess < refreshMs(TIDE_REFRESH_MS)) return;
     if (!State.lastTideSuccessAtMs && State.lastTideAttemptAtMs && sinceAttempt < TIDE_RETRY_MS) return;
   }
 
@@ -317,65 +491,65 @@ function maybeSendTides(latE6, lonE6, force) {
   State.lastTideAttemptAtMs = nowMs;
 
   const ensureStations = () => {
-    if (State.tideStations && State.tideStations.length && (nowMs - State.tideStationsFetchedAtMs) < TIDE_STATION_CACHE_MS) {
-      return Promise.resolve(State.tideStations);
-    }
-    return fetchNoaaTideStations().then((stations) => {
-      State.tideStations = stations;
-      State.tideStationsFetchedAtMs = Date.now();
-      return stations;
-    });
+    const idx = tideStationsFresh(nowMs) ? tideStationIndex() : null;
+    if (idx && idx.count) return Promise.resolve(idx);
+    return fetchNoaaTideStations();
+  };
+
+  const sendEvents = (events, levelIsFt) => {
+    const payload = {};
+    payload[KEYS.TIDE_EVENTS] = packTideEvents(events, levelIsFt);
+    sendQueued(payload);
+    State.lastTideSentAtMs = Date.now();
   };
 
   const nowUnix = Math.floor(nowMs / 1000);
   ensureStations().then(() => {
     const nearest = getNearestTideStation(latDeg, lonDeg);
     if (!nearest || nearest.distM > TIDE_NEAR_COAST_THRESHOLD_M) {
-      const payload = {};
-      payload[KEYS.TIDE_HAVE] = 0;
-      sendQueued(payload);
-      State.lastTideSentAtMs = Date.now();
+      sendEvents([], false);
       return;
     }
     log('[pkjs] tide nearest station', nearest.id, 'dist_km', Math.round(nearest.distM / 1000));
     const useImperial = useImperialUnits(latDeg, lonDeg);
 
-    return Promise.all([
-      fetchNoaaHiLoForStationGmt(nearest.id, nowUnix),
-      fetchNoaaLevelX10ForStationGmt(nearest.id, nowUnix, useImperial)
-    ]).then((arr) => {
-      const events = arr[0];
-      const levelX10 = arr[1];
-      const win = computeTideWindow(events, nowUnix);
-      const payload = {};
-      if (!win) {
-        payload[KEYS.TIDE_HAVE] = 0;
-      } else {
-        payload[KEYS.TIDE_HAVE] = 1;
-        payload[KEYS.TIDE_LAST_UNIX] = win.lastUnix;
-        payload[KEYS.TIDE_NEXT_UNIX] = win.nextUnix;
-        payload[KEYS.TIDE_NEXT_IS_HIGH] = win.nextIsHigh;
-        payload[KEYS.TIDE_LEVEL_X10] = levelX10 | 0;
-        payload[KEYS.TIDE_LEVEL_IS_FT] = useImperial ? 1 : 0;
-      }
-      sendQueued(payload);
-      State.lastTideSentAtMs = Date.now();
-      if (win) State.lastTideSuccessAtMs = Date.now();
+    return fetchNoaaHiLoForStationGmt(nearest.id, nowUnix, useImperial).then((all) => {
+      const events = upcomingTideEvents(all, nowUnix);
+      sendEvents(events, useImperial);
+      if (events.length) State.lastTideSuccessAtMs = Date.now();
     });
   }).catch((e) => {
     log('[pkjs] tide fetch failed', String(e && e.message ? e.message : e));
-    const payload = {};
-    payload[KEYS.TIDE_HAVE] = 0;
-    sendQueued(payload);
-    State.lastTideSentAtMs = Date.now();
+    sendEvents([], false);
+  });
+}
+
+// Layout must match WX_HOURS_* in pebble-yes-watch.c (little-endian).
+function packWeatherHours(baseUnix, isF, hours) {
+  const out = [];
+  const u8 = (v) => out.push(v & 0xff);
+  const q = (v, scale, lo, hi) => (v === null || !isFinite(v)) ? 0 : Math.max(lo, Math.min(hi, Math.round(v * scale)));
+  u8(1); // version
+  u8(hours.length);
+  u8(isF ? 1 : 0);
+  u8(0);
+  u8(baseUnix); u8(baseUnix >> 8); u8(baseUnix >> 16); u8(baseUnix >>> 24);
+  hours.forEach((h) => {
+    u8(q(h.temp, 2, -128, 127));
+    u8((Math.max(0, Math.min(127, Math.round(h.code)))) | (h.isDay ? 0x80 : 0));
+    u8(q(h.windSpd, 1, 0, 255));
+    u8(h.windDir === null || !isFinite(h.windDir) ? 0 : Math.round(h.windDir * 256 / 360) & 0xff);
+    u8(q(h.precip, 10, 0, 255));
+    u8(q(h.uv, 10, 0, 255));
+    // 0 is "missing", so the valid range starts one hPa above the base.
+    u8(h.pressure === null || !isFinite(h.pressure) ? 0 : Math.max(1, Math.min(255, Math.round(h.pressure) - WX_PRESSURE_BASE_HPA)));
   });
+  return out;
 }
 
 function maybeSendWeather(latE6, lonE6, force) {
   const nowMs = Date.now();
-  const locChanged = !State.lastWeatherLoc ||
-    (haversineMeters(State.lastWeatherLoc.latE6 / 1e6, State.lastWeatherLoc.lonE6 / 1e6, latE6 / 1e6, lonE6 / 1e6) > 2000);
-  State.lastWeatherLoc = { latE6: latE6, lonE6: lonE6 };
+  const locChanged = locationMovedFor('weather', latE6, lonE6);
   const effectiveForce = !!force || locChanged;
   // Throttle: avoid bursts.
   if (!effectiveForce && (nowMs - (State.lastWeatherAttemptAtMs || 0)) < 30 * 1000) return;
@@ -383,7 +557,7 @@ function maybeSendWeather(latE6, lonE6, force) {
   const sinceSuccess = nowMs - (State.lastWeatherSuccessAtMs || 0);
   const sinceAttempt = nowMs - (State.lastWeatherAttemptAtMs || 0);
   if (!effectiveForce) {
-    if (State.lastWeatherSuccessAtMs && sinceSuccess < WEATHER_REFRESH_MS) return;
+    if (State.lastWeatherSuccessAtMs && sinceSuccess < refreshMs(WEATHER_REFRESH_MS)) return;
     if (!State.lastWeatherSuccessAtMs && State.lastWeatherAttemptAtMs && sinceAttempt < WEATHER_RETRY_MS) return;
   }
   State.lastWeatherAttemptAtMs = nowMs;
@@ -391,39 +565,53 @@ function maybeSendWeather(latE6, lonE6, force) {
   const latDeg = latE6 / 1e6;
   const lonDeg = lonE6 / 1e6;
   const useImperial = useImperialUnits(latDeg, lonDeg);
+  const fields = 'temperature_2m,weather_code,is_day,wind_speed_10m,wind_direction_10m,precipitation,uv_index,pressure_msl';
   const url =
     'https://api.open-meteo.com/v1/forecast' +
     '?latitude=' + encodeURIComponent(String(latDeg)) +
     '&longitude=' + encodeURIComponent(String(lonDeg)) +
-    '&current=' + encodeURIComponent('temperature_2m,weather_code,is_day,wind_speed_10m,wind_direction_10m,precipitation,uv_index,pressure_msl') +
+    '&current=' + encodeURIComponent(fields) +
+    '&hourly=' + encodeURIComponent(fields) +
+    '&forecast_hours=' + (WX_HOURS_MAX + 1) +
     '&temperature_unit=celsius' +
     '&wind_speed_unit=' + encodeURIComponent(useImperial ? 'mph' : 'kmh') +
     '&precipitation_unit=' + encodeURIComponent(useImperial ? 'inch' : 'mm') +
+    '&timeformat=unixtime' +
     '&timezone=UTC';
 
-  httpGetJson(url).then((json) => {
-    const cur = json && json.current ? json.current : null;
-    const temp = cur && typeof cur.temperature_2m === 'number' ? cur.temperature_2m : null;
-    const code = cur && typeof cur.weather_code === 'number' ? cur.weather_code : null;
-    const isDay = cur && (cur.is_day === 1 || cur.is_day === true) ? 1 : 0;
-    const windSpd = cur && typeof cur.wind_speed_10m === 'number' ? cur.wind_speed_10m : null;
-    const windDir = cur && typeof cur.wind_direction_10m === 'number' ? cur.wind_direction_10m : null;
-    const precip = cur && typeof cur.precipitation === 'number' ? cur.precipitation : null;
-    const uv = cur && typeof cur.uv_index === 'number' ? cur.uv_index : null;
-    const p = cur && typeof cur.pressure_msl === 'number' ? cur.pressure_msl : null;
-    if (temp === null || code === null) throw new Error('open-meteo missing current');
-    const isF = useImperial;
+  httpGetJsonCached(url, { ttlMs: HTTP_TTL_MS.weather }).then((json) => {
+    const num = (v) => (typeof v === 'number' ? v : null);
+    const pick = (src, i) => {
+      const at = (k) => (i === undefined ? num(src[k]) : num(src[k] && src[k][i]));
+      return {
+        temp: at('temperature_2m'),
+        code: at('weather_code'),
+        isDay: at('is_day') === 1,
+        windSpd: at('wind_speed_10m'),
+        windDir: at('wind_direction_10m'),
+        precip: at('precipitation'),
+        uv: at('uv_index'),
+        pressure: at('pressure_msl')
+      };
+    };
+    const cur = json && json.current ? pick(json.current) : null;
+    if (!cur || cur.temp === null || cur.code === null) throw new Error('open-meteo missing current');
+
+    // Hour 0 is the current reading; the rest come from the hourly forecast.
+    const nowUnix = Math.floor(nowMs / 1000);
+    const baseUnix = nowUnix - (nowUnix % 3600);
+    const hours = [cur];
+    const hourly = json.hourly;
+    const times = hourly && hourly.time ? hourly.time : [];
+    for (let i = 0; i < times.length && hours.length < WX_HOURS_MAX; i++) {
+      if (times[i] !== baseUnix + hours.length * 3600) continue;
+      const h = pick(hourly, i);
+      if (h.temp === null || h.code === null) break;
+      hours.push(h);
+    }
 
     const payload = {};
-    payload[KEYS.WEATHER_TEMP_C10] = Math.round(temp * 10);
-    payload[KEYS.WEATHER_CODE] = Math.max(0, Math.min(255, Math.round(code)));
-    payload[KEYS.WEATHER_IS_DAY] = isDay;
-    payload[KEYS.WEATHER_IS_F] = isF ? 1 : 0;
-    if (windSpd !== null && isFinite(windSpd)) payload[KEYS.WEATHER_WIND_SPD_X10] = Math.round(windSpd * 10);
-    if (windDir !== null && isFinite(windDir)) payload[KEYS.WEATHER_WIND_DIR_DEG] = Math.max(0, Math.min(359, Math.round(windDir)));
-    if (precip !== null && isFinite(precip)) payload[KEYS.WEATHER_PRECIP_X10] = Math.round(precip * 10);
-    if (uv !== null && isFinite(uv)) payload[KEYS.WEATHER_UV_X10] = Math.round(uv * 10);
-    if (p !== null && isFinite(p)) payload[KEYS.WEATHER_PRESSURE_HPA_X10] = Math.round(p * 10);
+    payload[KEYS.WEATHER_HOURS] = packWeatherHours(baseUnix, useImperial, hours);
     sendQueued(payload);
     State.lastWeatherSuccessAtMs = Date.now();
     State.lastWeatherSentAtMs = Date.now();
@@ -432,7 +620,30 @@ function maybeSendWeather(latE6, lonE6, force) {
   });
 }
 
-// --- "Geo-fence" / update thresholding ---
+// --- Location policy ---
+// One place decides when to ask for a fix and which consumers a fix reaches.
+//
+// Polling: fixes are low-accuracy and may come from the OS cache (maximumAge). The poll
+// interval starts at LOC_POLL_MIN_MS and doubles up to LOC_POLL_MAX_MS while fixes stay within
+// LOC_STATIONARY_M (less their reported accuracy) of where the stationary stretch began; a real
+// move drops it back to the minimum. Forced requests (startup, watch restart) also accept a
+// fix up to LOC_FORCE_MAX_AGE_MS old.
+//
+// Fan-out: each consumer acts only once the position is past its own threshold from the one
+// it last acted on (LOC_FANOUT_M), so cheap consumers follow closely and expensive or
+// insensitive ones stay put. Astro uses the geo-fence below; the settings-page city label
+// reuses its cached name within LOCATION_CITY_CACHE_MAX_M.
+const LOC_POLL_MIN_MS = 5 * 60 * 1000; // short enough that emulator location changes are picked up
+const LOC_POLL_MAX_MS = 40 * 60 * 1000;
+const LOC_STATIONARY_M = 500;
+const LOC_FORCE_MAX_AGE_MS = 2 * 60 * 1000;
+const LOC_FANOUT_M = {
+  tide: 2000,    // nearest station and the coast-distance cutoff
+  weather: 5000  // forecast grid cells are several km wide
+};
+// Altitude is sent on any fix, but only when it moved by this much (GPS altitude is noisy).
+const ALT_MIN_CHANGE_M = 10;
+
 // Trigger recomputation+send only when location/timezone changed enough.
 // 25km often changes sunrise/sunset by ~1 minute or less; use a wider threshold so
 // that recomputations are more likely to yield different minute values.
@@ -440,7 +651,39 @@ const DIST_THRESHOLD_M = 60000; // 60 km
 const TZ_THRESHOLD_MIN = 30;    // 30 minutes
 // If the move is unlikely to change rise/set by at least this many minutes, skip.
 const EXPECTED_SHIFT_MIN = 2;
-const LOC_REFRESH_MS = 5 * 60 * 1000; // poll GPS periodically so emulator location changes are picked up
+
+// True (and re-anchors the consumer) when it has not acted yet or the fix is past its threshold.
+function locationMovedFor(consumer, latE6, lonE6) {
+  const a = State.locAnchors[consumer];
+  if (a && haversineMeters(a.latE6 / 1e6, a.lonE6 / 1e6, latE6 / 1e6, lonE6 / 1e6) < LOC_FANOUT_M[consumer]) {
+    return false;
+  }
+  State.locAnchors[consumer] = { latE6: latE6, lonE6: lonE6 };
+  return true;
+}
+
+// Adapts the poll interval to whether we are moving; called for every fix.
+function noteLocationFix(coords) {
+  const latE6 = Math.round(coords.latitude * 1e6);
+  const lonE6 = Math.round(coords.longitude * 1e6);
+  const a = State.locStationaryAnchor;
+  const slackM = (typeof coords.accuracy === 'number' && isFinite(coords.accuracy)) ? coords.accuracy : 0;
+  const movedM = a ? haversineMeters(a.latE6 / 1e6, a.lonE6 / 1e6, latE6 / 1e6, lonE6 / 1e6) - slackM : Infinity;
+  if (movedM < LOC_STATIONARY_M) {
+    State.locPollMs = Math.min(LOC_POLL_MAX_MS, Math.max(LOC_POLL_MIN_MS, State.locPollMs * 2));
+  } else {
+    State.locStationaryAnchor = { latE6: latE6, lonE6: lonE6 };
+    State.locPollMs = LOC_POLL_MIN_MS;
+  }
+}
+
+function scheduleLocationPoll() {
+  if (State.locPollTimer) clearTimeout(State.locPollTimer);
+  State.locPollTimer = setTimeout(() => {
+    State.locPollTimer = null;
+    requestLocation(false);
+  }, State.locPollMs || LOC_POLL_MIN_MS);
+}
 
 function haversineMeters(lat1, lon1, lat2, lon2) {
   const R = 6371000;
@@ -585,6 +828,67 @@ function sendUiUpdateInterval() {
   sendQueued(payload);
 }
 
+// Watch-side LowPowerMode values.
+const LOW_POWER_MODE_IDS = { auto: 0, on: 1, off: 2 };
+
+function normalizeLowPowerMode(v) {
+  return Object.prototype.hasOwnProperty.call(LOW_POWER_MODE_IDS, v) ? v : null;
+}
+
+function readLowPowerModeFromStorage() {
+  try {
+    return normalizeLowPowerMode(localStorage.getItem('lowPowerMode')) || 'auto';
+  } catch (e) {
+    return 'auto';
+  }
+}
+
+// KEY_BATT_MODEL from the watch (see pack_batt_model): the learned per-feature battery cost,
+// kept for the config page. Costs are millionths of a percent (per hour for base).
+const BATT_MODEL_VERSION = 1;
+const BATT_MODEL_LEN = 26;
+
+function unpackBattModel(bytes) {
+  if (!bytes || bytes.length < BATT_MODEL_LEN || (bytes[0] & 0xff) !== BATT_MODEL_VERSION) return null;
+  const u16 = (i) => (bytes[i] & 0xff) | ((bytes[i + 1] & 0xff) << 8);
+  const i32 = (i) => u16(i) | (u16(i + 2) << 16);
+  return {
+    samples: bytes[1] & 0xff,
+    capacityMah: u16(2),
+    baseUph: i32(4),
+    redrawU: i32(8),
+    wakeU: i32(12),
+    msgU: i32(16),
+    redrawsPh: u16(20),
+    wakesPh: u16(22),
+    msgsPh: u16(24)
+  };
+}
+
+function readBattModelFromStorage() {
+  try {
+    const m = JSON.parse(localStorage.getItem('battModel') || 'null');
+    return m && m.samples > 0 && m.capacityMah > 0 ? m : null;
+  } catch (e) {
+    return null;
+  }
+}
+
+// cost (1e-6 %) x events per hour -> mAh per day.
+function battMahPerDay(model, costU, perHour) {
+  return costU * perHour * 24 * model.capacityMah / 1e8;
+}
+
+function formatMah(v) {
+  return (v < 10 ? v.toFixed(1) : String(Math.round(v)));
+}
+
+function sendLowPowerMode() {
+  const payload = {};
+  payload[KEYS.LOW_POWER_MODE] = LOW_POWER_MODE_IDS[readLowPowerModeFromStorage()];
+  sendQueued(payload);
+}
+
 function sendAltitudeUnitForLocation(latE6, lonE6) {
   const payload = {};
   payload[KEYS.ALT_IS_FT] = useImperialUnits(latE6 / 1e6, lonE6 / 1e6) ? 1 : 0;
@@ -597,10 +901,18 @@ function maybeSendAltitude(position, latDeg, lonDeg) {
   const alt = coords && typeof coords.altitude === 'number' ? coords.altitude : null;
   const acc = coords && typeof coords.altitudeAccuracy === 'number' ? coords.altitudeAccuracy : null;
   const valid = (alt !== null && isFinite(alt) && (acc === null || !isFinite(acc) || acc <= 250));
+  const isFt = useImperialUnits(latDeg, lonDeg);
+
+  const last = State.lastAltSent;
+  if (last && last.valid === valid && last.isFt === isFt &&
+      (!valid || Math.abs(alt - last.altM) < ALT_MIN_CHANGE_M)) {
+    return;
+  }
+  State.lastAltSent = { valid: valid, altM: valid ? alt : 0, isFt: isFt };
 
   const payload = {};
   payload[KEYS.ALT_VALID] = valid ? 1 : 0;
-  payload[KEYS.ALT_IS_FT] = useImperialUnits(latDeg, lonDeg) ? 1 : 0;
+  payload[KEYS.ALT_IS_FT] = isFt ? 1 : 0;
   if (valid) payload[KEYS.ALT_M] = Math.round(alt);
   sendQueued(payload);
 }
@@ -630,28 +942,108 @@ function saveLastLocSent(loc) {
   try { localStorage.setItem('lastLocSent', JSON.stringify(loc)); } catch (e) {}
 }
 
+// --- Batched, delta-only AppMessage sends ---
+// Payloads queued within MSG_BATCH_WINDOW_MS are merged into one message, keys the watch already
+// acked with the same value are skipped, and failed sends are retried with backoff.
+const MSG_BATCH_WINDOW_MS = 150;
+const MSG_INBOX_BYTES = 256; // app_message_open() inbox size on the watch
+const MSG_RETRY_MIN_MS = 500;
+const MSG_RETRY_MAX_MS = 30000;
+// The watch only applies these when all members arrive in the same message.
+const MSG_KEY_GROUPS = [
+  [KEYS.LAT_E6, KEYS.LON_E6],
+  [KEYS.HOME_SUN_STATE, KEYS.HOME_SUNRISE_MIN, KEYS.HOME_SUNSET_MIN],
+  [KEYS.HOME_MOON_STATE, KEYS.HOME_MOONRISE_MIN, KEYS.HOME_MOONSET_MIN]
+];
+
 function sendQueued(payload, onSuccess) {
-  State.msgQueue.push({ payload, onSuccess });
-  pumpQueue();
+  Object.keys(payload).forEach((k) => { State.msgPending[k] = payload[k]; });
+  if (typeof onSuccess === 'function') State.msgPendingCbs.push(onSuccess);
+  scheduleFlush(MSG_BATCH_WINDOW_MS);
+}
+
+// Forget what the watch has; the next batch carries every queued key again.
+function resetAckedState() {
+  State.msgAcked = {};
+  State.lastAltSent = null;
+}
+
+function scheduleFlush(delayMs) {
+  if (State.msgFlushTimer) return;
+  State.msgFlushTimer = setTimeout(() => {
+    State.msgFlushTimer = null;
+    flushQueue();
+  }, delayMs);
+}
+
+function tupleBytes(value) {
+  // Dictionary tuple header (key, type, length) + data; numbers go out as int32.
+  if (Array.isArray(value)) return 7 + value.length;
+  if (typeof value === 'string') return 7 + unescape(encodeURIComponent(value)).length + 1;
+  return 7 + 4;
+}
+
+// Pull the next message's worth of changed keys out of msgPending; null when nothing to send.
+function takeBatch() {
+  const pending = State.msgPending;
+  const units = [];
+  const used = {};
+  Object.keys(pending).forEach((k) => {
+    if (used[k]) return;
+    const group = MSG_KEY_GROUPS.find((g) => g.indexOf(k) >= 0) || [k];
+    const keys = group.filter((gk) => gk in pending);
+    keys.forEach((gk) => { used[gk] = true; });
+    const changed = keys.some((gk) => JSON.stringify(pending[gk]) !== JSON.stringify(State.msgAcked[gk]));
+    if (changed) {
+      units.push(keys);
+    } else {
+      keys.forEach((gk) => { delete pending[gk]; });
+    }
+  });
+  if (!units.length) return null;
+
+  const batch = {};
+  let size = 1;
+  units.forEach((keys) => {
+    const bytes = keys.reduce((n, k) => n + tupleBytes(pending[k]), 0);
+    if (size + bytes > MSG_INBOX_BYTES && size > 1) return; // next message
+    keys.forEach((k) => {
+      batch[k] = pending[k];
+      delete pending[k];
+    });
+    size += bytes;
+  });
+  return batch;
 }
 
-function pumpQueue() {
+function flushQueue() {
   if (State.isSending) return;
-  const item = State.msgQueue.shift();
-  if (!item) return;
+  const batch = takeBatch();
+  if (!batch) {
+    const cbs = State.msgPendingCbs;
+    State.msgPendingCbs = [];
+    cbs.forEach((cb) => { try { cb(); } catch (e) {} });
+    return;
+  }
   State.isSending = true;
 
   Pebble.sendAppMessage(
-    item.payload,
+    batch,
     () => {
       State.isSending = false;
-      try { if (typeof item.onSuccess === 'function') item.onSuccess(); } catch (e) {}
-      setTimeout(pumpQueue, 0);
+      State.msgRetryMs = 0;
+      Object.keys(batch).forEach((k) => { State.msgAcked[k] = batch[k]; });
+      flushQueue();
     },
     () => {
-      // Drop on failure; don't spin.
       State.isSending = false;
-      setTimeout(pumpQueue, 200);
+      // Requeue, but never over a newer value queued while this one was in flight.
+      Object.keys(batch).forEach((k) => {
+        if (!(k in State.msgPending)) State.msgPending[k] = batch[k];
+      });
+      State.msgRetryMs = State.msgRetryMs ? Math.min(MSG_RETRY_MAX_MS, State.msgRetryMs * 2) : MSG_RETRY_MIN_MS;
+      log('[pkjs] AppMessage failed; retry in', State.msgRetryMs, 'ms');
+      scheduleFlush(State.msgRetryMs);
     }
   );
 }
@@ -717,9 +1109,33 @@ function calcSolarEventLocalHours(N, latDeg, lonDeg, tzHours, isSunrise) {
   return { hours: localT };
 }
 
-function calcSunriseSunsetMinutes(latDeg, lonDeg, tzOffsetMin) {
+// Rise/set results per (kind, local day, tz, location rounded to ASTRO_MEMO_DECIMALS): location
+// polls and tz triggers on the same day, and the days already in the forecast, are answered
+// without recomputing. compute(latDeg, lonDeg, tzOffsetMin, ymd) runs on the rounded location
+// so a key always maps to the same result. Oldest entries are dropped first.
+const ASTRO_MEMO_DECIMALS = 2; // ~1 km moves rise/set by seconds
+const ASTRO_MEMO_MAX = 96;
+
+function astroMemo(kind, latDeg, lonDeg, tzOffsetMin, ymd, compute) {
+  const lat = +latDeg.toFixed(ASTRO_MEMO_DECIMALS);
+  const lon = +lonDeg.toFixed(ASTRO_MEMO_DECIMALS);
+  const key = kind + '|' + ymd.y + '-' + ymd.m + '-' + ymd.d + '|' + (tzOffsetMin | 0) + '|' + lat + ',' + lon;
+  const memo = State.astroMemo;
+  let v = memo.get(key);
+  if (v) return v;
+  v = compute(lat, lon, tzOffsetMin | 0, ymd);
+  if (memo.size >= ASTRO_MEMO_MAX) memo.delete(memo.keys().next().value);
+  memo.set(key, v);
+  return v;
+}
+
+function calcSunriseSunsetMinutes(latDeg, lonDeg, tzOffsetMin, ymdOpt) {
+  const ymd = ymdOpt || ymdForOffsetMinutes(tzOffsetMin);
+  return astroMemo('sun', latDeg, lonDeg, tzOffsetMin, ymd, solveSunriseSunsetMinutes);
+}
+
+function solveSunriseSunsetMinutes(latDeg, lonDeg, tzOffsetMin, ymd) {
   const tzHours = tzOffsetMin / 60.0;
-  const ymd = ymdForOffsetMinutes(tzOffsetMin);
   const N = dayOfYearUTC(ymd.y, ymd.m, ymd.d);
 
   const rise = calcSolarEventLocalHours(N, latDeg, lonDeg, tzHours, true);
@@ -762,6 +1178,110 @@ function sunEclipticLonDeg(unixSec) {
   return lambda;
 }
 
+// Moon periodic terms (truncated but still strong improvement), shared by every moonRaDec call.
+// Format: [d, m, mp, f, lon(1e-6 deg), dist(1e-3 km)]
+// Coeffs derived from Meeus Table 45.A (largest terms).
+const MOON_TERMS_LR = [
+  [ 0,  0,  1,  0,  6288774, -20905355],
+  [ 2,  0, -1,  0,  1274027,  -3699111],
+  [ 2,  0,  0,  0,   658314,  -2955968],
+  [ 0,  0,  2,  0,   213618,   -569925],
+  [ 0,  1,  0,  0,  -185116,     48888],
+  [ 0,  0,  0,  2,  -114332,     -3149],
+  [ 2,  0, -2,  0,    58793,    246158],
+  [ 2, -1, -1,  0,    57066,   -152138],
+  [ 2,  0,  1,  0,    53322,   -170733],
+  [ 2, -1,  0,  0,    45758,   -204586],
+  [ 0,  1, -1,  0,   -40923,   -129620],
+  [ 1,  0,  0,  0,   -34720,    108743],
+  [ 0,  1,  1,  0,   -30383,    104755],
+  [ 2,  0,  0, -2,    15327,     10321],
+  [ 0,  0,  1,  2,   -12528,         0],
+  [ 0,  0,  1, -2,    10980,     79661],
+  [ 4,  0, -1,  0,    10675,    -34782],
+  [ 0,  0,  3,  0,    10034,    -23210],
+  [ 4,  0, -2,  0,     8548,    -21636],
+  [ 2,  1, -1,  0,    -7888,     24208],
+  [ 2,  1,  0,  0,    -6766,     30824],
+  [ 1,  0, -1,  0,    -5163,     -8379],
+  [ 1,  1,  0,  0,     4987,    -16675],
+  [ 2, -1,  1,  0,     4036,    -12831],
+  [ 2,  0,  2,  0,     3994,    -10445],
+  [ 4,  0,  0,  0,     3861,    -11650],
+  [ 2,  0, -3,  0,     3665,     14403],
+  [ 0,  1, -2,  0,    -2689,     -7003],
+  [ 2,  0, -1,  2,    -2602,         0],
+  [ 2, -1, -2,  0,     2390,     10056],
+  [ 1,  0,  1,  0,    -2348,      6322],
+  [ 2, -2,  0,  0,     2236,     -9884],
+  [ 0,  1,  2,  0,    -2120,      5751],
+  [ 0,  2,  0,  0,    -2069,         0],
+  [ 2, -2, -1,  0,     2048,     -4950],
+  [ 2,  0,  1, -2,    -1773,      4130],
+  [ 2,  0,  0,  2,    -1595,         0],
+  [ 4, -1, -1,  0,     1215,     -3958],
+  [ 0,  0,  2,  2,    -1110,         0],
+  [ 3,  0, -1,  0,     -892,      3258],
+  [ 2,  1,  1,  0,     -810,      2616],
+  [ 4, -1, -2,  0,      759,     -1897],
+  [ 0,  2, -1,  0,     -713,     -2117],
+  [ 2,  2, -1,  0,     -700,      2354],
+  [ 2,  1, -2,  0,      691,         0],
+  [ 2, -1,  0, -2,      596,         0],
+  [ 4,  0,  1,  0,      549,     -1423],
+  [ 0,  0,  4,  0,      537,     -1117]
+];
+
+// Format: [d, m, mp, f, lat(1e-6 deg)]
+// Coeffs derived from Meeus Table 45.B (largest terms).
+const MOON_TERMS_B = [
+  [ 0,  0,  0,  1,  5128122],
+  [ 0,  0,  1,  1,   280602],
+  [ 0,  0,  1, -1,   277693],
+  [ 2,  0,  0, -1,   173237],
+  [ 2,  0, -1,  1,    55413],
+  [ 2,  0, -1, -1,    46271],
+  [ 2,  0,  0,  1,    32573],
+  [ 0,  0,  2,  1,    17198],
+  [ 2,  0,  1, -1,     9266],
+  [ 0,  0,  2, -1,     8822],
+  [ 2, -1,  0, -1,     8216],
+  [ 2,  0, -2, -1,     4324],
+  [ 2,  0,  1,  1,     4200],
+  [ 2,  1,  0, -1,    -3359],
+  [ 2, -1, -1,  1,     2463],
+  [ 2, -1,  0,  1,     2211],
+  [ 2, -1, -1, -1,     2065],
+  [ 0,  1, -1, -1,    -1870],
+  [ 4,  0, -1, -1,     1828],
+  [ 0,  1,  0,  1,    -1794],
+  [ 0,  0,  0,  3,    -1749],
+  [ 0,  1, -1,  1,    -1565],
+  [ 1,  0,  0,  1,    -1491],
+  [ 0,  1,  1,  1,    -1475],
+  [ 0,  1,  1, -1,    -1410],
+  [ 0,  1,  0, -1,    -1344],
+  [ 1,  0,  0, -1,    -1335],
+  [ 0,  0,  3,  1,     1107],
+  [ 4,  0,  0, -1,     1021],
+  [ 4,  0, -1,  1,      833],
+  [ 0,  0,  1, -3,      777],
+  [ 4,  0, -2,  1,      671],
+  [ 2,  0,  0, -3,      607],
+  [ 2,  0,  2, -1,      596],
+  [ 2, -1,  1, -1,      491],
+  [ 2,  0, -2,  1,     -451],
+  [ 0,  0,  3, -1,      439],
+  [ 2,  0,  2,  1,      422],
+  [ 2,  0, -3, -1,      421],
+  [ 2,  1, -1,  1,     -366],
+  [ 2,  1,  0,  1,     -351],
+  [ 4,  0,  0,  1,      331],
+  [ 2, -1,  1,  1,      315],
+  [ 2, -2,  0, -1,      302],
+  [ 0,  0,  1,  3,     -283]
+];
+
 // More accurate Moon position: Meeus-style periodic terms (lon/lat/dist).
 // This dramatically improves moonrise/moonset timing vs the earlier low-precision model.
 function moonRaDec(unixSec) {
@@ -777,114 +1297,10 @@ function moonRaDec(unixSec) {
   // E factor for terms containing M (Sun mean anomaly)
   const E = 1.0 - 0.002516 * T - 0.0000074 * T * T;
 
-  // Periodic terms (truncated but still strong improvement).
-  // Format: [d, m, mp, f, lon(1e-6 deg), dist(1e-3 km)]
-  // Coeffs derived from Meeus Table 45.A (largest terms).
-  const TERMS_LR = [
-    [ 0,  0,  1,  0,  6288774, -20905355],
-    [ 2,  0, -1,  0,  1274027,  -3699111],
-    [ 2,  0,  0,  0,   658314,  -2955968],
-    [ 0,  0,  2,  0,   213618,   -569925],
-    [ 0,  1,  0,  0,  -185116,     48888],
-    [ 0,  0,  0,  2,  -114332,     -3149],
-    [ 2,  0, -2,  0,    58793,    246158],
-    [ 2, -1, -1,  0,    57066,   -152138],
-    [ 2,  0,  1,  0,    53322,   -170733],
-    [ 2, -1,  0,  0,    45758,   -204586],
-    [ 0,  1, -1,  0,   -40923,   -129620],
-    [ 1,  0,  0,  0,   -34720,    108743],
-    [ 0,  1,  1,  0,   -30383,    104755],
-    [ 2,  0,  0, -2,    15327,     10321],
-    [ 0,  0,  1,  2,   -12528,         0],
-    [ 0,  0,  1, -2,    10980,     79661],
-    [ 4,  0, -1,  0,    10675,    -34782],
-    [ 0,  0,  3,  0,    10034,    -23210],
-    [ 4,  0, -2,  0,     8548,    -21636],
-    [ 2,  1, -1,  0,    -7888,     24208],
-    [ 2,  1,  0,  0,    -6766,     30824],
-    [ 1,  0, -1,  0,    -5163,     -8379],
-    [ 1,  1,  0,  0,     4987,    -16675],
-    [ 2, -1,  1,  0,     4036,    -12831],
-    [ 2,  0,  2,  0,     3994,    -10445],
-    [ 4,  0,  0,  0,     3861,    -11650],
-    [ 2,  0, -3,  0,     3665,     14403],
-    [ 0,  1, -2,  0,    -2689,     -7003],
-    [ 2,  0, -1,  2,    -2602,         0],
-    [ 2, -1, -2,  0,     2390,     10056],
-    [ 1,  0,  1,  0,    -2348,      6322],
-    [ 2, -2,  0,  0,     2236,     -9884],
-    [ 0,  1,  2,  0,    -2120,      5751],
-    [ 0,  2,  0,  0,    -2069,         0],
-    [ 2, -2, -1,  0,     2048,     -4950],
-    [ 2,  0,  1, -2,    -1773,      4130],
-    [ 2,  0,  0,  2,    -1595,         0],
-    [ 4, -1, -1,  0,     1215,     -3958],
-    [ 0,  0,  2,  2,    -1110,         0],
-    [ 3,  0, -1,  0,     -892,      3258],
-    [ 2,  1,  1,  0,     -810,      2616],
-    [ 4, -1, -2,  0,      759,     -1897],
-    [ 0,  2, -1,  0,     -713,     -2117],
-    [ 2,  2, -1,  0,     -700,      2354],
-    [ 2,  1, -2,  0,      691,         0],
-    [ 2, -1,  0, -2,      596,         0],
-    [ 4,  0,  1,  0,      549,     -1423],
-    [ 0,  0,  4,  0,      537,     -1117]
-  ];
-
-  // Format: [d, m, mp, f, lat(1e-6 deg)]
-  // Coeffs derived from Meeus Table 45.B (largest terms).
-  const TERMS_B = [
-    [ 0,  0,  0,  1,  5128122],
-    [ 0,  0,  1,  1,   280602],
-    [ 0,  0,  1, -1,   277693],
-    [ 2,  0,  0, -1,   173237],
-    [ 2,  0, -1,  1,    55413],
-    [ 2,  0, -1, -1,    46271],
-    [ 2,  0,  0,  1,    32573],
-    [ 0,  0,  2,  1,    17198],
-    [ 2,  0,  1, -1,     9266],
-    [ 0,  0,  2, -1,     8822],
-    [ 2, -1,  0, -1,     8216],
-    [ 2,  0, -2, -1,     4324],
-    [ 2,  0,  1,  1,     4200],
-    [ 2,  1,  0, -1,    -3359],
-    [ 2, -1, -1,  1,     2463],
-    [ 2, -1,  0,  1,     2211],
-    [ 2, -1, -1, -1,     2065],
-    [ 0,  1, -1, -1,    -1870],
-    [ 4,  0, -1, -1,     1828],
-    [ 0,  1,  0,  1,    -1794],
-    [ 0,  0,  0,  3,    -1749],
-    [ 0,  1, -1,  1,    -1565],
-    [ 1,  0,  0,  1,    -1491],
-    [ 0,  1,  1,  1,    -1475],
-    [ 0,  1,  1, -1,    -1410],
-    [ 0,  1,  0, -1,    -1344],
-    [ 1,  0,  0, -1,    -1335],
-    [ 0,  0,  3,  1,     1107],
-    [ 4,  0,  0, -1,     1021],
-    [ 4,  0, -1,  1,      833],
-    [ 0,  0,  1, -3,      777],
-    [ 4,  0, -2,  1,      671],
-    [ 2,  0,  0, -3,      607],
-    [ 2,  0,  2, -1,      596],
-    [ 2, -1,  1, -1,      491],
-    [ 2,  0, -2,  1,     -451],
-    [ 0,  0,  3, -1,      439],
-    [ 2,  0,  2,  1,      422],
-    [ 2,  0, -3, -1,      421],
-    [ 2,  1, -1,  1,     -366],
-    [ 2,  1,  0,  1,     -351],
-    [ 4,  0,  0,  1,      331],
-    [ 2, -1,  1,  1,      315],
-    [ 2, -2,  0, -1,      302],
-    [ 0,  0,  1,  3,     -283]
-  ];
-
   let sumL = 0;
   let sumR = 0;
-  for (let i = 0; i < TERMS_LR.length; i++) {
-    const t = TERMS_LR[i];
+  for (let i = 0; i < MOON_TERMS_LR.length; i++) {
+    const t = MOON_TERMS_LR[i];
     const d = t[0], m = t[1], mp = t[2], f = t[3];
     const arg = deg2rad(d * D + m * M + mp * Mp + f * F);
     const eFac = (Math.abs(m) === 1) ? E : ((Math.abs(m) === 2) ? (E * E) : 1.0);
@@ -893,8 +1309,8 @@ function moonRaDec(unixSec) {
   }
 
   let sumB = 0;
-  for (let i = 0; i < TERMS_B.length; i++) {
-    const t = TERMS_B[i];
+  for (let i = 0; i < MOON_TERMS_B.length; i++) {
+    const t = MOON_TERMS_B[i];
     const d = t[0], m = t[1], mp = t[2], f = t[3];
     const arg = deg2rad(d * D + m * M + mp * Mp + f * F);
     const eFac = (Math.abs(m) === 1) ? E : ((Math.abs(m) === 2) ? (E * E) : 1.0);
@@ -924,6 +1340,58 @@ function moonRaDec(unixSec) {
   return { ra: ra, dec: dec, r: rEarth, lonDeg: lon, latDeg: lat, distKm: distKm };
 }
 
+// Chebyshev fit of the geocentric Moon over [t0Unix, t1Unix], as equatorial x/y/z in Earth
+// radii (smooth, unlike RA, which wraps). The position barely curves over a day, so
+// MOON_CHEB_NODES full moonRaDec evaluations stand in for the ~340 a rise/set scan makes; the
+// fit error is far below the minute the results are rounded to. Returns moonRaDec-style {ra, dec, r}.
+const MOON_CHEB_NODES = 9;
+
+function moonPositionFit(t0Unix, t1Unix) {
+  const n = MOON_CHEB_NODES;
+  const mid = (t0Unix + t1Unix) / 2;
+  const half = (t1Unix - t0Unix) / 2;
+  const fx = [], fy = [], fz = [];
+  for (let k = 0; k < n; k++) {
+    const m = moonRaDec(mid + half * Math.cos(Math.PI * (k + 0.5) / n));
+    const rc = m.r * Math.cos(m.dec);
+    fx.push(rc * Math.cos(m.ra));
+    fy.push(rc * Math.sin(m.ra));
+    fz.push(m.r * Math.sin(m.dec));
+  }
+  const cx = [], cy = [], cz = [];
+  for (let j = 0; j < n; j++) {
+    let sx = 0, sy = 0, sz = 0;
+    for (let k = 0; k < n; k++) {
+      const w = Math.cos(Math.PI * j * (k + 0.5) / n);
+      sx += fx[k] * w;
+      sy += fy[k] * w;
+      sz += fz[k] * w;
+    }
+    cx.push(2 * sx / n);
+    cy.push(2 * sy / n);
+    cz.push(2 * sz / n);
+  }
+  const clenshaw = (c, u) => {
+    let b1 = 0, b2 = 0;
+    for (let j = n - 1; j >= 1; j--) {
+      const b0 = 2 * u * b1 - b2 + c[j];
+      b2 = b1;
+      b1 = b0;
+    }
+    return u * b1 - b2 + c[0] / 2;
+  };
+  return function(unixSec) {
+    const u = Math.max(-1, Math.min(1, (unixSec - mid) / half));
+    const x = clenshaw(cx, u);
+    const y = clenshaw(cy, u);
+    const z = clenshaw(cz, u);
+    const rxy = Math.sqrt(x * x + y * y);
+    let ra = Math.atan2(y, x);
+    if (ra < 0) ra += 2 * Math.PI;
+    return { ra: ra, dec: Math.atan2(z, rxy), r: Math.sqrt(rxy * rxy + z * z) };
+  };
+}
+
 function moonPhase0to1(unixSec) {
   // 0=new, 0.5=full, 1=next new.
   // Use ecliptic longitude elongation (Moon - Sun).
@@ -934,10 +1402,11 @@ function moonPhase0to1(unixSec) {
   return elong / 360.0;
 }
 
-function moonAltitudeRad(unixSec, latDeg, lonDeg) {
+function moonAltitudeRad(unixSec, latDeg, lonDeg, moonPos) {
   // Topocentric altitude with parallax correction (major improvement for rise/set timing).
   // References: Meeus, Astronomical Algorithms (topocentric RA/Dec).
-  const m = moonRaDec(unixSec);
+  // moonPos(unixSec) -> {ra, dec, r}; defaults to the full series.
+  const m = (moonPos || moonRaDec)(unixSec);
   const ra = m.ra;
   const dec = m.dec;
   const r = m.r || 60.0; // Earth radii
@@ -973,9 +1442,14 @@ function moonAltitudeRad(unixSec, latDeg, lonDeg) {
   return alt;
 }
 
-function calcMoonriseMoonsetMinutes(latDeg, lonDeg, tzOffsetMin) {
-  const ymd = ymdForOffsetMinutes(tzOffsetMin);
+function calcMoonriseMoonsetMinutes(latDeg, lonDeg, tzOffsetMin, ymdOpt) {
+  const ymd = ymdOpt || ymdForOffsetMinutes(tzOffsetMin);
+  return astroMemo('moon', latDeg, lonDeg, tzOffsetMin, ymd, scanMoonriseMoonsetMinutes);
+}
+
+function scanMoonriseMoonsetMinutes(latDeg, lonDeg, tzOffsetMin, ymd) {
   const baseUtcMidnight = Date.UTC(ymd.y, ymd.m - 1, ymd.d) / 1000 - tzOffsetMin * 60;
+  const moonPos = moonPositionFit(baseUtcMidnight - 600, baseUtcMidnight + 1440 * 60 + 600);
   // Rise/set is convention-based (refraction + apparent radius). Using a small negative
   // altitude threshold makes offline results align much closer to MET Norway.
   const horizon = deg2rad(-0.3);
@@ -990,7 +1464,7 @@ function calcMoonriseMoonsetMinutes(latDeg, lonDeg, tzOffsetMin) {
   for (let m = 0; m <= 1440; m += stepMin) {
     const mm = (m === 1440) ? 1439 : m;
     const t = baseUtcMidnight + mm * 60;
-    const alt = moonAltitudeRad(t, latDeg, lonDeg);
+    const alt = moonAltitudeRad(t, latDeg, lonDeg, moonPos);
     const above = alt > horizon;
     if (above) aboveCount++;
     if (prevAbove === null) {
@@ -1004,7 +1478,7 @@ function calcMoonriseMoonsetMinutes(latDeg, lonDeg, tzOffsetMin) {
       for (let i = 0; i < 12; i++) {
         const mid = Math.floor((lo + hi) / 2);
         const tm = baseUtcMidnight + mid * 60;
-        const am = moonAltitudeRad(tm, latDeg, lonDeg);
+        const am = moonAltitudeRad(tm, latDeg, lonDeg, moonPos);
         const ab = am > horizon;
         if (ab === prevAbove) lo = mid; else hi = mid;
       }
@@ -1053,7 +1527,7 @@ function timeStringToMinutesLocal(timeStr) {
   return (hh * 60 + mm) % 1440;
 }
 
-function httpGetJson(url, headers) {
+function httpRequest(url, headers, timeoutMs) {
   return new Promise((resolve, reject) => {
     try {
       const req = new XMLHttpRequest();
@@ -1065,20 +1539,17 @@ function httpGetJson(url, headers) {
         });
       } catch (e) {}
       req.onload = function() {
-        try {
-          if (req.status < 200 || req.status >= 300) {
-            reject(new Error('http ' + req.status));
-            return;
+        resolve({
+          status: req.status,
+          text: req.responseText,
+          header: (name) => {
+            try { return req.getResponseHeader(name); } catch (e) { return null; }
           }
-          const json = JSON.parse(req.responseText);
-          resolve(json);
-        } catch (e) {
-          reject(e);
-        }
+        });
       };
       req.onerror = function() { reject(new Error('network error')); };
       req.ontimeout = function() { reject(new Error('timeout')); };
-      req.timeout = 15000;
+      req.timeout = Math.max(1000, (timeoutMs | 0));
       req.send(null);
     } catch (e) {
       reject(e);
@@ -1086,36 +1557,204 @@ function httpGetJson(url, headers) {
   });
 }
 
-function httpGetJsonTimeout(url, timeoutMs, headers) {
+// --- Shared HTTP cache ---
+// Every API GET goes through httpGetJsonCached. Entries are keyed by URL with coordinates
+// rounded to HTTP_COORD_DECIMALS (the rounded URL is also what gets requested, so GPS jitter
+// maps onto one entry), are fresh for the server's max-age/Expires or else the caller's ttl,
+// and are then revalidated with If-None-Match / If-Modified-Since. Identical requests issued
+// while one is in flight share its promise. Small bodies persist in localStorage as
+//   [[key, fetchedAtMs, expiresAtMs, etag, lastModified, body], ...]
+// so a restart or a location poll inside the TTL costs no network traffic.
+const HTTP_TIMEOUT_MS = 15000;
+const HTTP_COORD_DECIMALS = 2; // ~1 km; every provider used here is coarser than that
+const HTTP_CACHE_MAX_ENTRIES = 24;
+const HTTP_CACHE_MAX_BODY_CHARS = 16 * 1024; // larger bodies stay in memory only
+const HTTP_CACHE_KEEP_MS = 2 * 24 * 60 * 60 * 1000; // stale entries kept this long for revalidation
+const HTTP_CACHE_MAX_TTL_MS = 7 * 24 * 60 * 60 * 1000;
+const HTTP_CACHE_SAVE_DELAY_MS = 2000;
+const HTTP_TTL_MS = {
+  weather: 60 * 60 * 1000, // under WEATHER_REFRESH_MS so each refresh sees new data
+  metno: 6 * 60 * 60 * 1000, // URL is per day; the times barely move within it
+  tideHiLo: 3 * 60 * 60 * 1000,
+  nominatim: 7 * 24 * 60 * 60 * 1000
+};
+
+function httpCacheKey(url) {
+  return String(url).replace(/([?&](?:lat|lon|latitude|longitude)=)(-?[0-9.]+)/g, (m, k, v) => {
+    const f = parseFloat(v);
+    return isFinite(f) ? k + f.toFixed(HTTP_COORD_DECIMALS) : m;
+  });
+}
+
+function httpCache() {
+  if (State.httpCache) return State.httpCache;
+  const cache = new Map();
+  try {
+    const rows = JSON.parse(localStorage.getItem('httpCache') || '[]');
+    for (let i = 0; i < rows.length; i++) {
+      const r = rows[i];
+      if (!r || typeof r[0] !== 'string' || typeof r[5] !== 'string') continue;
+      cache.set(r[0], { fetchedAtMs: +r[1] || 0, expiresAtMs: +r[2] || 0, etag: r[3] || '', lastModified: r[4] || '', body: r[5] });
+    }
+  } catch (e) {}
+  State.httpCache = cache;
+  return cache;
+}
+
+function saveHttpCache() {
+  State.httpCacheSaveTimer = null;
+  const nowMs = Date.now();
+  const cache = httpCache();
+  const keys = Array.from(cache.keys());
+  keys.sort((a, b) => cache.get(b).fetchedAtMs - cache.get(a).fetchedAtMs);
+  const rows = [];
+  for (let i = 0; i < keys.length; i++) {
+    const e = cache.get(keys[i]);
+    if (i >= HTTP_CACHE_MAX_ENTRIES || nowMs - e.fetchedAtMs > HTTP_CACHE_KEEP_MS) {
+      cache.delete(keys[i]);
+      continue;
+    }
+    if (e.noStore || e.body.length > HTTP_CACHE_MAX_BODY_CHARS) continue;
+    rows.push([keys[i], e.fetchedAtMs, e.expiresAtMs, e.etag, e.lastModified, e.body]);
+  }
+  try { localStorage.setItem('httpCache', JSON.stringify(rows)); } catch (e) {}
+}
+
+function scheduleHttpCacheSave() {
+  if (State.httpCacheSaveTimer) return;
+  State.httpCacheSaveTimer = setTimeout(saveHttpCache, HTTP_CACHE_SAVE_DELAY_MS);
+}
+
+// Freshness lifetime from Cache-Control / Expires, or defaultMs when the server gives none.
+function httpFreshnessMs(res, defaultMs) {
+  const cc = String(res.header('Cache-Control') || '').toLowerCase();
+  if (/no-store|no-cache/.test(cc)) return 0;
+  const m = /max-age=(\d+)/.exec(cc);
+  if (m) return Math.min(HTTP_CACHE_MAX_TTL_MS, parseInt(m[1], 10) * 1000);
+  const expires = Date.parse(String(res.header('Expires') || ''));
+  if (isFinite(expires)) {
+    const date = Date.parse(String(res.header('Date') || ''));
+    return Math.max(0, Math.min(HTTP_CACHE_MAX_TTL_MS, expires - (isFinite(date) ? date : Date.now())));
+  }
+  return defaultMs;
+}
+
+function httpEntryJson(e) {
+  if (e.json === undefined) e.json = JSON.parse(e.body);
+  return e.json;
+}
+
+// opts: { ttlMs, timeoutMs, headers, staleOnErrorMs }. staleOnErrorMs lets an expired entry
+// answer when the network fails, for data that cannot have changed (e.g. a given day's sunrise).
+function httpGetJsonCached(url, opts) {
+  const o = opts || {};
+  const key = httpCacheKey(url);
+  const cache = httpCache();
+  const hit = cache.get(key);
+  if (hit && Date.now() < hit.expiresAtMs) {
+    try { return Promise.resolve(httpEntryJson(hit)); } catch (e) { cache.delete(key); }
+  }
+  const inFlight = State.httpInFlight[key];
+  if (inFlight) return inFlight;
+
+  const headers = {};
+  Object.keys(o.headers || {}).forEach((k) => { headers[k] = o.headers[k]; });
+  if (hit && hit.etag) headers['If-None-Match'] = hit.etag;
+  else if (hit && hit.lastModified) headers['If-Modified-Since'] = hit.lastModified;
+  const ttlMs = typeof o.ttlMs === 'number' ? o.ttlMs : 0;
+
+  const p = httpRequest(key, headers, o.timeoutMs || HTTP_TIMEOUT_MS).then((res) => {
+    const nowMs = Date.now();
+    if (res.status === 304 && hit && cache.get(key) === hit) {
+      hit.fetchedAtMs = nowMs;
+      hit.expiresAtMs = nowMs + httpFreshnessMs(res, ttlMs);
+      scheduleHttpCacheSave();
+      return httpEntryJson(hit);
+    }
+    if (res.status < 200 || res.status >= 300) throw new Error('http ' + res.status);
+    const json = JSON.parse(res.text);
+    cache.set(key, {
+      fetchedAtMs: nowMs,
+      expiresAtMs: nowMs + httpFreshnessMs(res, ttlMs),
+      etag: String(res.header('ETag') || ''),
+      lastModified: String(res.header('Last-Modified') || ''),
+      noStore: /no-store/i.test(String(res.header('Cache-Control') || '')),
+      body: res.text,
+      json: json
+    });
+    scheduleHttpCacheSave();
+    return json;
+  }).catch((err) => {
+    if (hit && o.staleOnErrorMs && Date.now() - hit.expiresAtMs < o.staleOnErrorMs) {
+      log('[pkjs] http stale', key, String(err && err.message ? err.message : err));
+      return httpEntryJson(hit);
+    }
+    throw err;
+  });
+  const done = () => { delete State.httpInFlight[key]; };
+  State.httpInFlight[key] = p;
+  p.then(done, done);
+  return p;
+}
+
+// GET url as text, handing each newly received piece to onText(text) as it arrives; onText
+// returns true to stop early. Asks for HTTP_RANGE_CHUNK_BYTES ranges so no single response
+// (and its responseText) grows past a chunk; a server that ignores Range sends one 200 that
+// is streamed through progress events instead. Resolves when the body is complete.
+function httpGetTextStreamed(url, timeoutMs, onText) {
+  const deadline = Date.now() + Math.max(1000, timeoutMs | 0);
   return new Promise((resolve, reject) => {
-    try {
-      const req = new XMLHttpRequest();
-      req.open('GET', url, true);
+    const fetchFrom = (start) => {
+      let fed = 0;
+      let stopped = false;
+      let req = null;
+      const feed = () => {
+        if (stopped) return;
+        const t = req.responseText || '';
+        if (t.length <= fed) return;
+        const piece = t.slice(fed);
+        fed = t.length;
+        if (onText(piece)) {
+          stopped = true;
+          try { req.abort(); } catch (e) {}
+          resolve();
+        }
+      };
       try {
-        const h = headers || {};
-        Object.keys(h).forEach((k) => {
-          try { req.setRequestHeader(k, h[k]); } catch (e) {}
-        });
-      } catch (e) {}
-      req.onload = function() {
-        try {
-          if (req.status < 200 || req.status >= 300) {
+        req = new XMLHttpRequest();
+        req.open('GET', url, true);
+        try { req.setRequestHeader('Range', 'bytes=' + start + '-' + (start + HTTP_RANGE_CHUNK_BYTES - 1)); } catch (e) {}
+        req.onprogress = function() {
+          if (req.status === 200 || req.status === 206) feed();
+        };
+        req.onload = function() {
+          if (stopped) return;
+          if (req.status === 416) { resolve(); return; } // range past the end
+          if (req.status !== 200 && req.status !== 206) {
             reject(new Error('http ' + req.status));
             return;
           }
-          const json = JSON.parse(req.responseText);
-          resolve(json);
-        } catch (e) {
-          reject(e);
-        }
-      };
-      req.onerror = function() { reject(new Error('network error')); };
-      req.ontimeout = function() { reject(new Error('timeout')); };
-      req.timeout = Math.max(1000, (timeoutMs | 0));
-      req.send(null);
-    } catch (e) {
-      reject(e);
-    }
+          feed();
+          if (stopped) return;
+          if (req.status === 200) { resolve(); return; }
+          // Content-Range: bytes <first>-<last>/<total>
+          const m = /bytes\s+(\d+)-(\d+)\/(\d+|\*)/.exec(String(req.getResponseHeader('Content-Range') || ''));
+          if (!m) { resolve(); return; }
+          const next = parseInt(m[2], 10) + 1;
+          const total = m[3] === '*' ? Infinity : parseInt(m[3], 10);
+          if (next >= total || next <= start) { resolve(); return; }
+          if (Date.now() >= deadline) { reject(new Error('timeout')); return; }
+          fetchFrom(next);
+        };
+        req.onerror = function() { if (!stopped) reject(new Error('network error')); };
+        req.ontimeout = function() { if (!stopped) reject(new Error('timeout')); };
+        req.timeout = Math.max(1000, deadline - Date.now());
+        req.send(null);
+      } catch (e) {
+        reject(e);
+      }
+    };
+    fetchFrom(0);
   });
 }
 
@@ -1129,9 +1768,11 @@ function fetchMetNoProperties(kind, latDeg, lonDeg, tzOffsetMin) {
     '&offset=' + encodeURIComponent(tzOffsetToIso(tzOffsetMin));
 
   log('[pkjs] met.no url', url);
-  return httpGetJson(url, {
+  return httpGetJsonCached(url, {
+    ttlMs: HTTP_TTL_MS.metno,
+    staleOnErrorMs: HTTP_CACHE_KEEP_MS,
     // MET Norway requests an identifying UA; some environments forbid setting it, so ignore failures.
-    'User-Agent': 'pebble-yes-watch/1.0 (pebble pkjs)'
+    headers: { 'User-Agent': 'pebble-yes-watch/1.0 (pebble pkjs)' }
   }).then((json) => {
     if (!json || !json.properties) throw new Error('met.no bad json');
     return json.properties;
@@ -1193,6 +1834,12 @@ function maybeSendAstroForDayRollover() {
   const ymdInt = ymdIntForOffsetMinutes(State.lastLoc.tzOffsetMin);
   if (ymdInt !== State.lastAstroYmd) {
     State.lastAstroYmd = ymdInt;
+    // Offline mode: the watch already holds local results for today. Internet mode still refreshes
+    // so day 0 comes from met.no.
+    if (!readUseInternetFromStorage() && ymdInt <= State.astroDaysThroughYmd) {
+      log('[pkjs] Daily rollover covered by forecast');
+      return;
+    }
     log('[pkjs] Daily rollover -> recompute astro');
     sendAstroForCurrentLocation(State.lastLoc.latE6, State.lastLoc.lonE6, State.lastLoc.tzOffsetMin);
   }
@@ -1253,7 +1900,7 @@ function maybeUpdateLocationLabel(latE6, lonE6) {
     '&lat=' + encodeURIComponent(String(latE6 / 1e6)) +
     '&lon=' + encodeURIComponent(String(lonE6 / 1e6));
 
-  httpGetJsonTimeout(url, 10000, NOMINATIM_HEADERS).then((json) => {
+  httpGetJsonCached(url, { ttlMs: HTTP_TTL_MS.nominatim, timeoutMs: 10000, headers: NOMINATIM_HEADERS }).then((json) => {
     const city = pickCityFromNominatim(json);
     if (city) saveCachedCity(latE6, lonE6, city);
   }).catch(() => {
@@ -1297,24 +1944,76 @@ function sendUseInternetFlag() {
   sendQueued(payload);
 }
 
+// Days of sun/moon sent per astro update. 14 entries keep the tuple (10 + 14*16 bytes) inside the
+// watch's 256-byte inbox and a single persist_write_data blob.
+const ASTRO_FORECAST_DAYS = 14;
+
+function addDaysYmd(ymd, n) {
+  const d = new Date(Date.UTC(ymd.y, ymd.m - 1, ymd.d + n));
+  return { y: d.getUTCFullYear(), m: d.getUTCMonth() + 1, d: d.getUTCDate() };
+}
+
+// UTC offset for a future local day. Follows the phone's DST schedule when we're using its tz;
+// a lon-based guess (see sendLocation) stays constant.
+function tzOffsetForDay(ymd, tzOffsetMin) {
+  if (tzOffsetMin !== -new Date().getTimezoneOffset()) return tzOffsetMin;
+  const noonUtcMs = Date.UTC(ymd.y, ymd.m - 1, ymd.d, 12) - tzOffsetMin * 60000;
+  return -new Date(noonUtcMs).getTimezoneOffset();
+}
+
+// Layout must match ASTRO_DAYS_* in pebble-yes-watch.c (little-endian).
+function packAstroDays(latE6, lonE6, days) {
+  const out = [];
+  const u8 = (v) => out.push(v & 0xff);
+  const u16 = (v) => { u8(v); u8(v >> 8); };
+  const u32 = (v) => { u16(v); u16(v >>> 16); };
+  u8(1); // version
+  u8(days.length);
+  u32(latE6);
+  u32(lonE6);
+  days.forEach((day) => {
+    u32(day.ymd.y * 10000 + day.ymd.m * 100 + day.ymd.d);
+    u8(Math.round(day.tzOffsetMin / 15));
+    u8((day.sun.state & 3) | ((day.moon.state & 3) << 2));
+    u16(day.sun.sunriseMin);
+    u16(day.sun.sunsetMin);
+    u16(day.moon.moonriseMin);
+    u16(day.moon.moonsetMin);
+    u16(Math.round(day.phase * 65535));
+  });
+  return out;
+}
+
 function sendAstroForCurrentLocation(latE6, lonE6, tzOffsetMin) {
   const latDeg = latE6 / 1e6;
   const lonDeg = lonE6 / 1e6;
   const useInternet = readUseInternetFromStorage();
 
+  // Day 0 may come from met.no; the rest are local calculations. The watch picks today's entry
+  // at each rollover, so it stays correct for two weeks without the phone.
   const sendPayload = (sun, moon) => {
+    const ymd0 = ymdForOffsetMinutes(tzOffsetMin);
+    const days = [];
+    for (let i = 0; i < ASTRO_FORECAST_DAYS; i++) {
+      const ymd = addDaysYmd(ymd0, i);
+      const tz = (i === 0) ? tzOffsetMin : tzOffsetForDay(ymd, tzOffsetMin);
+      const noonUnix = Date.UTC(ymd.y, ymd.m - 1, ymd.d, 12) / 1000 - tz * 60;
+      days.push({
+        ymd: ymd,
+        tzOffsetMin: tz,
+        sun: (i === 0) ? sun : calcSunriseSunsetMinutes(latDeg, lonDeg, tz, ymd),
+        moon: (i === 0) ? moon : calcMoonriseMoonsetMinutes(latDeg, lonDeg, tz, ymd),
+        // 0=new, 0.5=full, at local noon.
+        phase: Math.max(0, Math.min(1, moonPhase0to1(noonUnix)))
+      });
+    }
+    const last = days[days.length - 1].ymd;
     const payload = {};
-    payload[KEYS.HOME_SUN_STATE] = sun.state;
-    payload[KEYS.HOME_SUNRISE_MIN] = sun.sunriseMin;
-    payload[KEYS.HOME_SUNSET_MIN] = sun.sunsetMin;
-    payload[KEYS.HOME_MOON_STATE] = moon.state;
-    payload[KEYS.HOME_MOONRISE_MIN] = moon.moonriseMin;
-    payload[KEYS.HOME_MOONSET_MIN] = moon.moonsetMin;
-    // Moon phase "now" (UTC), scaled to 1e6: 0=new, 500000=full.
-    const phase = moonPhase0to1(Math.floor(Date.now() / 1000));
-    payload[KEYS.MOON_PHASE_E6] = Math.max(0, Math.min(1000000, Math.round(phase * 1e6)));
+    payload[KEYS.HOME_ASTRO_DAYS] = packAstroDays(latE6, lonE6, days);
     payload[KEYS.USE_INTERNET_FALLBACK] = useInternet ? 1 : 0;
-    sendQueued(payload);
+    sendQueued(payload, () => {
+      State.astroDaysThroughYmd = last.y * 10000 + last.m * 100 + last.d;
+    });
   };
 
   if (useInternet) {
@@ -1412,23 +2111,23 @@ function requestLocation(force) {
 
   State.lastLocRequestAtMs = Date.now();
   navigator.geolocation.getCurrentPosition(
-    (pos) => sendLocation(pos, !!force),
-    () => { /* ignore */ },
+    (pos) => {
+      if (pos && pos.coords && isFinite(pos.coords.latitude) && isFinite(pos.coords.longitude)) {
+        noteLocationFix(pos.coords);
+      }
+      scheduleLocationPoll();
+      sendLocation(pos, !!force);
+    },
+    () => { scheduleLocationPoll(); },
     {
       enableHighAccuracy: false,
       timeout: 15000,
-      // If this is a forced refresh (button press / explicit request), don't accept cached coords.
-      maximumAge: force ? 0 : 10 * 60 * 1000
+      // Polls take whatever the OS already has from within the current interval.
+      maximumAge: force ? LOC_FORCE_MAX_AGE_MS : Math.max(LOC_POLL_MIN_MS, State.locPollMs)
     }
   );
 }
 
-function maybeRefreshLocation() {
-  // Refresh periodically so emulator/location changes are picked up.
-  const now = Date.now();
-  if (now - (State.lastLocRequestAtMs || 0) > LOC_REFRESH_MS) requestLocation(false);
-}
-
 const CONFIG_I18N = {
   en: {
     title: 'YES Watchface Settings',
@@ -1440,11 +2139,24 @@ const CONFIG_I18N = {
     unitsHint: 'Defaults to the current location heuristic until you save a choice.',
     updateCycle: 'Corner update cycle',
     updateHint: 'Higher values reduce corner redraws and slow complication rotation.',
+    lowPower: 'Low power mode',
+    lowPowerAuto: 'Automatic (low battery)',
+    lowPowerOn: 'Always on',
+    lowPowerOff: 'Off',
+    lowPowerHint: 'Stops corner rotation so the face only wakes once a minute; the moon phase redraws less often.',
     language: 'Language',
     languageHint: 'Defaults to your phone or watch language until you save a choice.',
     location: 'Location',
     closestCity: 'Closest city',
     locationUnknown: 'Location not available yet',
+    battery: 'Battery use',
+    batteryHint: 'Estimated mAh per day, learned on the watch from its battery drops.',
+    batteryLearning: 'Still learning: needs a few days off the charger.',
+    batteryBase: 'Standby',
+    batteryRedraws: 'Redraws',
+    batteryWakes: 'Wakes',
+    batteryMessages: 'Phone updates',
+    batteryTotal: 'Total',
     seconds: 'seconds',
     save: 'Save'
   },
@@ -1458,11 +2170,24 @@ const CONFIG_I18N = {
     unitsHint: 'Standard wird aus der aktuellen Position abgeleitet, bis du speicherst.',
     updateCycle: 'Aktualisierung der Ecken',
     updateHint: 'Höhere Werte reduzieren Neuzeichnen und verlangsamen die Rotation.',
+    lowPower: 'Energiesparmodus',
+    lowPowerAuto: 'Automatisch (Akku schwach)',
+    lowPowerOn: 'Immer an',
+    lowPowerOff: 'Aus',
+    lowPowerHint: 'Stoppt die Rotation der Ecken, sodass nur einmal pro Minute gezeichnet wird; die Mondphase seltener.',
     language: 'Sprache',
     languageHint: 'Standard ist die erkannte Telefon- oder Uhrensprache, bis du speicherst.',
     location: 'Standort',
     closestCity: 'Nächste Stadt',
     locationUnknown: 'Standort noch nicht verfügbar',
+    battery: 'Akkuverbrauch',
+    batteryHint: 'Geschätzte mAh pro Tag, auf der Uhr aus den Akkustufen gelernt.',
+    batteryLearning: 'Lernt noch: braucht ein paar Tage ohne Ladegerät.',
+    batteryBase: 'Ruhezustand',
+    batteryRedraws: 'Neuzeichnen',
+    batteryWakes: 'Aufwachen',
+    batteryMessages: 'Telefon-Updates',
+    batteryTotal: 'Gesamt',
     seconds: 'Sekunden',
     save: 'Speichern'
   },
@@ -1476,11 +2201,24 @@ const CONFIG_I18N = {
     unitsHint: 'Par défaut selon la position actuelle jusqu\'à enregistrement.',
     updateCycle: 'Cycle des coins',
     updateHint: 'Des valeurs plus élevées réduisent les redraws et ralentissent la rotation.',
+    lowPower: 'Mode économie',
+    lowPowerAuto: 'Automatique (batterie faible)',
+    lowPowerOn: 'Toujours actif',
+    lowPowerOff: 'Désactivé',
+    lowPowerHint: 'Arrête la rotation des coins : un seul rafraîchissement par minute, phase de lune moins souvent.',
     language: 'Langue',
     languageHint: 'Par défaut selon la langue du téléphone ou de la montre jusqu\'à enregistrement.',
     location: 'Emplacement',
     closestCity: 'Ville la plus proche',
     locationUnknown: 'Emplacement pas encore disponible',
+    battery: 'Consommation batterie',
+    batteryHint: 'mAh estimés par jour, appris par la montre à partir des baisses de batterie.',
+    batteryLearning: 'Apprentissage en cours : quelques jours hors chargeur sont nécessaires.',
+    batteryBase: 'Veille',
+    batteryRedraws: 'Redessins',
+    batteryWakes: 'Réveils',
+    batteryMessages: 'Mises à jour téléphone',
+    batteryTotal: 'Total',
     seconds: 'secondes',
     save: 'Enregistrer'
   },
@@ -1494,11 +2232,24 @@ const CONFIG_I18N = {
     unitsHint: 'Por defecto según la ubicación actual hasta guardar.',
     updateCycle: 'Ciclo de esquinas',
     updateHint: 'Valores más altos reducen redibujos y ralentizan la rotación.',
+    lowPower: 'Modo de ahorro',
+    lowPowerAuto: 'Automático (batería baja)',
+    lowPowerOn: 'Siempre activo',
+    lowPowerOff: 'Desactivado',
+    lowPowerHint: 'Detiene la rotación de las esquinas: solo se redibuja una vez por minuto y la fase lunar con menos frecuencia.',
     language: 'Idioma',
     languageHint: 'Por defecto según el idioma del teléfono o reloj hasta guardar.',
     location: 'Ubicación',
     closestCity: 'Ciudad más cercana',
     locationUnknown: 'Ubicación aún no disponible',
+    battery: 'Consumo de batería',
+    batteryHint: 'mAh estimados por día, aprendidos en el reloj a partir de las caídas de batería.',
+    batteryLearning: 'Aún aprendiendo: necesita unos días sin cargador.',
+    batteryBase: 'Reposo',
+    batteryRedraws: 'Redibujos',
+    batteryWakes: 'Activaciones',
+    batteryMessages: 'Datos del teléfono',
+    batteryTotal: 'Total',
     seconds: 'segundos',
     save: 'Guardar'
   },
@@ -1512,11 +2263,24 @@ const CONFIG_I18N = {
     unitsHint: 'Padrão pela localização atual até guardar.',
     updateCycle: 'Ciclo dos cantos',
     updateHint: 'Valores maiores reduzem redesenhos e tornam a rotação mais lenta.',
+    lowPower: 'Modo de poupança',
+    lowPowerAuto: 'Automático (bateria fraca)',
+    lowPowerOn: 'Sempre ativo',
+    lowPowerOff: 'Desligado',
+    lowPowerHint: 'Para a rotação dos cantos: redesenha só uma vez por minuto e a fase da lua com menos frequência.',
     language: 'Idioma',
     languageHint: 'Padrão pelo idioma do telefone ou relógio até guardar.',
     location: 'Localização',
     closestCity: 'Cidade mais próxima',
     locationUnknown: 'Localização ainda indisponível',
+    battery: 'Consumo de bateria',
+    batteryHint: 'mAh estimados por dia, aprendidos no relógio a partir das descidas da bateria.',
+    batteryLearning: 'Ainda a aprender: precisa de alguns dias fora do carregador.',
+    batteryBase: 'Repouso',
+    batteryRedraws: 'Redesenhos',
+    batteryWakes: 'Ativações',
+    batteryMessages: 'Dados do telefone',
+    batteryTotal: 'Total',
     seconds: 'segundos',
     save: 'Guardar'
   },
@@ -1530,11 +2294,24 @@ const CONFIG_I18N = {
     unitsHint: 'Predefinito dalla posizione attuale finché non salvi.',
     updateCycle: 'Ciclo angoli',
     updateHint: 'Valori più alti riducono i redraw e rallentano la rotazione.',
+    lowPower: 'Risparmio energetico',
+    lowPowerAuto: 'Automatico (batteria scarica)',
+    lowPowerOn: 'Sempre attivo',
+    lowPowerOff: 'Disattivato',
+    lowPowerHint: 'Ferma la rotazione degli angoli: un solo ridisegno al minuto, fase lunare meno spesso.',
     language: 'Lingua',
     languageHint: 'Predefinito dalla lingua di telefono o orologio finché non salvi.',
     location: 'Posizione',
     closestCity: 'Città più vicina',
     locationUnknown: 'Posizione non ancora disponibile',
+    battery: 'Consumo batteria',
+    batteryHint: 'mAh stimati al giorno, appresi dall\'orologio dai cali della batteria.',
+    batteryLearning: 'Ancora in apprendimento: servono alcuni giorni senza caricatore.',
+    batteryBase: 'Riposo',
+    batteryRedraws: 'Ridisegni',
+    batteryWakes: 'Risvegli',
+    batteryMessages: 'Dati dal telefono',
+    batteryTotal: 'Totale',
     seconds: 'secondi',
     save: 'Salva'
   }
@@ -1550,9 +2327,11 @@ function getUiModelFromStorage() {
   const unitsMode = readUnitsModeFromStorage();
   const uiUpdateIntervalSec = readUpdateIntervalSecFromStorage();
   const language = readLanguageFromStorage();
+  const lowPowerMode = readLowPowerModeFromStorage();
   const locationDisplay = getLocationDisplayForConfig();
+  const battModel = readBattModelFromStorage();
 
-  return { useInternet, unitsMode, uiUpdateIntervalSec, language, locationDisplay };
+  return { useInternet, unitsMode, uiUpdateIntervalSec, language, lowPowerMode, locationDisplay, battModel };
 }
 
 function configLanguageOptionsHtml() {
@@ -1562,7 +2341,32 @@ function configLanguageOptionsHtml() {
   }).join('\n      ');
 }
 
-function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, locationDisplay) {
+// Corner cycle choices, each with what its extra wakes and redraws are learned to cost.
+function configUpdateCycleOptionsHtml(L, battModel) {
+  return [5, 10, 30, 60].map((sec) => {
+    let cost = '';
+    if (battModel) {
+      const mah = battMahPerDay(battModel, battModel.wakeU + battModel.redrawU, 3600 / sec);
+      cost = ` (~${formatMah(mah)} mAh/day)`;
+    }
+    return `<option value="${sec}">${sec} ${L.seconds}${cost}</option>`;
+  }).join('\n      ');
+}
+
+function configBatteryHtml(L, battModel) {
+  if (!battModel) return `<div class="hint">${L.batteryLearning}</div>`;
+  const rows = [
+    [L.batteryBase, battModel.baseUph * 24 * battModel.capacityMah / 1e8],
+    [L.batteryRedraws, battMahPerDay(battModel, battModel.redrawU, battModel.redrawsPh)],
+    [L.batteryWakes, battMahPerDay(battModel, battModel.wakeU, battModel.wakesPh)],
+    [L.batteryMessages, battMahPerDay(battModel, battModel.msgU, battModel.msgsPh)]
+  ];
+  const total = rows.reduce((sum, r) => sum + r[1], 0);
+  rows.push([L.batteryTotal, total]);
+  return rows.map((r) => `<div class="batt-row">${r[0]}: ${formatMah(r[1])} mAh/day</div>`).join('\n    ');
+}
+
+function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, lowPowerMode, locationDisplay, battModel) {
   // Inline config page.
   // IMPORTANT: localStorage is disabled for `data:` URLs in many browsers, so do NOT access it here.
   // We inject initial values from pkjs instead and return the user's changes via return_to/pebblejs://close.
@@ -1583,7 +2387,7 @@ function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, locat
     input[type="checkbox"] { width: auto; padding: 0; }
     button { width: 100%; padding: 12px; font-size: 16px; margin-top: 10px; }
     .hint { font-size: 12px; color: #555; }
-    .location-value { font-size: 15px; line-height: 1.35; }
+    .location-value, .batt-row { font-size: 15px; line-height: 1.35; }
   </style>
 </head>
 <body>
@@ -1607,13 +2411,19 @@ function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, locat
   <div class="row">
     <label>${L.updateCycle}</label>
     <select id="uiUpdateIntervalSec">
-      <option value="5">5 ${L.seconds}</option>
-      <option value="10">10 ${L.seconds}</option>
-      <option value="30">30 ${L.seconds}</option>
-      <option value="60">60 ${L.seconds}</option>
+      ${configUpdateCycleOptionsHtml(L, battModel)}
     </select>
     <div class="hint">${L.updateHint}</div>
   </div>
+  <div class="row">
+    <label>${L.lowPower}</label>
+    <select id="lowPowerMode">
+      <option value="auto">${L.lowPowerAuto}</option>
+      <option value="on">${L.lowPowerOn}</option>
+      <option value="off">${L.lowPowerOff}</option>
+    </select>
+    <div class="hint">${L.lowPowerHint}</div>
+  </div>
   <div class="row">
     <label>${L.language}</label>
     <select id="language">
@@ -1621,6 +2431,11 @@ function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, locat
     </select>
     <div class="hint">${L.languageHint}</div>
   </div>
+  <div class="row">
+    <label>${L.battery}</label>
+    ${configBatteryHtml(L, battModel)}
+    <div class="hint">${L.batteryHint}</div>
+  </div>
   <button id="save">${L.save}</button>
 
   <script>
@@ -1628,6 +2443,7 @@ function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, locat
     const INITIAL_UNITS_MODE = ${JSON.stringify(normalizeUnitsMode(unitsMode) || 'metric')};
     const INITIAL_UI_UPDATE_INTERVAL_SEC = ${JSON.stringify(normalizeUpdateIntervalSec(uiUpdateIntervalSec))};
     const INITIAL_LANGUAGE = ${JSON.stringify(languageCode)};
+    const INITIAL_LOW_POWER_MODE = ${JSON.stringify(normalizeLowPowerMode(lowPowerMode) || 'auto')};
 
     function closeWith(payload) {
       const encoded = encodeURIComponent(JSON.stringify(payload));
@@ -1651,6 +2467,7 @@ function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, locat
         document.getElementById('unitsMode').value = INITIAL_UNITS_MODE;
         document.getElementById('uiUpdateIntervalSec').value = String(INITIAL_UI_UPDATE_INTERVAL_SEC);
         document.getElementById('language').value = INITIAL_LANGUAGE;
+        document.getElementById('lowPowerMode').value = INITIAL_LOW_POWER_MODE;
       } catch (e) {}
     }
 
@@ -1659,11 +2476,13 @@ function configHtml(useInternet, unitsMode, uiUpdateIntervalSec, language, locat
       const unitsMode = document.getElementById('unitsMode').value === 'imperial' ? 'imperial' : 'metric';
       const uiUpdateIntervalSec = parseInt(document.getElementById('uiUpdateIntervalSec').value, 10);
       const language = document.getElementById('language').value;
+      const lowPowerMode = document.getElementById('lowPowerMode').value;
       closeWith({
         useInternet: !!useInternet,
         unitsMode: unitsMode,
         uiUpdateIntervalSec: uiUpdateIntervalSec,
-        language: language
+        language: language,
+        lowPowerMode: lowPowerMode
       });
     }
 
@@ -1684,11 +2503,11 @@ Pebble.addEventListener('ready', () => {
   sendLanguage();
   sendUseInternetFlag();
   sendUiUpdateInterval();
-  setInterval(maybeRefreshLocation, 10 * 60 * 1000);
+  sendLowPowerMode();
 
-  // Re-send astro data periodically (handles date rollovers even if GPS doesn't change)
+  // Re-send astro data periodically (handles date rollovers even if GPS doesn't change);
+  // GPS polling schedules itself (see location policy).
   setInterval(() => {
-    requestLocation(false);
     maybeSendAstroForDayRollover();
     if (State.lastLoc) {
       maybeSendTides(State.lastLoc.latE6, State.lastLoc.lonE6, false);
@@ -1699,7 +2518,18 @@ Pebble.addEventListener('ready', () => {
 
 Pebble.addEventListener('appmessage', (e) => {
   const dict = e && e.payload ? e.payload : {};
+  if (typeof dict[KEYS.LOW_POWER_ACTIVE] !== 'undefined') {
+    State.watchLowPower = !!dict[KEYS.LOW_POWER_ACTIVE];
+  }
+  const battModel = unpackBattModel(dict[KEYS.BATT_MODEL]);
+  if (battModel) {
+    try {
+      localStorage.setItem('battModel', JSON.stringify(battModel));
+    } catch (err) {}
+  }
   if (dict[KEYS.REQUEST_LOC]) {
+    // The watch asks after (re)starting; it may have lost what we think it has.
+    resetAckedState();
     requestLocation(true);
   }
 });
@@ -1711,7 +2541,7 @@ Pebble.addEventListener('showConfiguration', () => {
   const ui = getUiModelFromStorage();
   sendLanguage();
   const url = 'data:text/html;charset=utf-8,' + encodeURIComponent(
-    configHtml(ui.useInternet, ui.unitsMode, ui.uiUpdateIntervalSec, ui.language, ui.locationDisplay)
+    configHtml(ui.useInternet, ui.unitsMode, ui.uiUpdateIntervalSec, ui.language, ui.lowPowerMode, ui.locationDisplay, ui.battModel)
   );
   Pebble.openURL(url);
 });
@@ -1738,6 +2568,10 @@ Pebble.addEventListener('webviewclosed', (e) => {
       localStorage.setItem('uiUpdateIntervalSec', String(normalizeUpdateIntervalSec(payload.uiUpdateIntervalSec)));
       sendUiUpdateInterval();
     }
+    if (payload && normalizeLowPowerMode(payload.lowPowerMode)) {
+      localStorage.setItem('lowPowerMode', payload.lowPowerMode);
+      sendLowPowerMode();
+    }
     if (payload && normalizeLanguageCode(payload.language)) {
       const prevLanguage = readLanguageFromStorage();
       const nextLanguage = normalizeLanguageCode(payload.language);
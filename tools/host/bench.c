@@ -0,0 +1,328 @@
+// Host benchmark and golden-frame check for yes_draw.c / yes_astro.c.
+// Built once per platform by tools/host/run.sh with the SDK's PBL_* flags plus
+// HOST_PLATFORM / HOST_W / HOST_H. Prints timings and per-frame operation counts, writes the
+// deterministic frame as a PNG, and prints its hash for comparison with tools/host/golden.txt.
+
+#include <pebble.h>
+
+#include <math.h>
+
+#include "yes_astro.h"
+#include "yes_draw.h"
+#include "yes_i18n.h"
+
+#ifndef HOST_PLATFORM
+#define HOST_PLATFORM "basalt"
+#define HOST_W 144
+#define HOST_H 168
+#endif
+
+// Same seed as scripts/screenshot.sh (San Francisco), at a fixed summer instant.
+#define SCENE_LAT_E6 37774900
+#define SCENE_LON_E6 -122419400
+#define SCENE_TZ_MIN -420
+#define SCENE_UNIX 1750525740 // 2025-06-21 17:09 UTC = 10:09 local
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// ---- astro ----
+
+static void bench_astro(void) {
+  static const int lats[] = { -60, -45, -30, -15, 0, 15, 30, 45, 52, 60, 65 };
+  const int n_lat = (int)(sizeof(lats) / sizeof(lats[0]));
+  int n = 0, fast_ok = 0;
+  volatile int sink = 0;
+
+  // Fast path alone: what the watch runs inline on a day rollover.
+  double t0 = now_us();
+  for (int doy = 0; doy < 365; doy++) {
+    const time_t day = 1735689600 + (time_t)doy * 86400; // from 2025-01-01
+    struct tm tm_day;
+    gmtime_r(&day, &tm_day);
+    for (int i = 0; i < n_lat; i++) {
+      SunTimes st;
+      if (calc_sunrise_sunset_fast(tm_day.tm_year + 1900, tm_day.tm_mon + 1, tm_day.tm_mday,
+                                   lats[i] * 1000000, 13400000, 60, &st)) {
+        fast_ok++;
+        sink += st.sunrise_min;
+      }
+      n++;
+    }
+  }
+  const double fast_us = (now_us() - t0) / n;
+
+  t0 = now_us();
+  for (int doy = 0; doy < 365; doy++) {
+    const time_t day = 1735689600 + (time_t)doy * 86400;
+    struct tm tm_day;
+    gmtime_r(&day, &tm_day);
+    for (int i = 0; i < n_lat; i++) {
+      const SunTimes st = calc_sunrise_sunset_local(tm_day.tm_year + 1900, tm_day.tm_mon + 1, tm_day.tm_mday,
+                                                    lats[i], 13.4, 60);
+      sink += st.sunset_min;
+    }
+  }
+  const double sun_us = (now_us() - t0) / n;
+
+  // Moon: a month is enough to cover every phase.
+  int n_moon = 0;
+  t0 = now_us();
+  for (int doy = 0; doy < 30; doy++) {
+    const time_t day = 1735689600 + (time_t)doy * 86400;
+    struct tm tm_day;
+    gmtime_r(&day, &tm_day);
+    for (int i = 0; i < n_lat; i++) {
+      const MoonTimes mt = calc_moonrise_moonset_local(tm_day.tm_year + 1900, tm_day.tm_mon + 1, tm_day.tm_mday,
+                                                       lats[i] * 1000000, 13400000, 60);
+      sink += mt.moonrise_min;
+      n_moon++;
+    }
+  }
+  const double moon_us = (now_us() - t0) / n_moon;
+
+  printf("astro  sun_fast %.2f us/day (%d/%d analytic)  sun_full %.2f us/day  moon %.1f us/day\n",
+         fast_us, fast_ok, n, sun_us, moon_us);
+  (void)sink;
+}
+
+// ---- draw ----
+
+typedef struct {
+  GeoLoc loc;
+  SunTimes sun;
+  MoonTimes moon;
+  YesFaceState st;
+} Scene;
+
+static void scene_init(Scene *s) {
+  memset(s, 0, sizeof(*s));
+  host_set_time(SCENE_UNIX, SCENE_TZ_MIN);
+  s->loc = (GeoLoc){ .lat_e6 = SCENE_LAT_E6, .lon_e6 = SCENE_LON_E6, .tz_offset_min = SCENE_TZ_MIN, .valid = true };
+  s->sun = calc_sunrise_sunset_local(2025, 6, 21, SCENE_LAT_E6 / 1e6, SCENE_LON_E6 / 1e6, SCENE_TZ_MIN);
+  s->moon = calc_moonrise_moonset_local(2025, 6, 21, SCENE_LAT_E6, SCENE_LON_E6, SCENE_TZ_MIN);
+  YesFaceState *st = &s->st;
+  st->loc = &s->loc;
+  st->sun = &s->sun;
+  st->moon = &s->moon;
+  st->tide = (YesTideState){ .last_unix = SCENE_UNIX - 2 * 3600, .next_unix = SCENE_UNIX + 3 * 3600 + 50 * 60,
+                             .level_x10 = 45, .valid = true, .next_is_high = true, .level_is_ft = true };
+  st->weather = (YesWeatherState){ .temp_c10 = 182, .wind_spd_x10 = 123, .wind_dir_deg = 270, .precip_x10 = 0,
+                                   .uv_x10 = 52, .pressure_hpa_x10 = 10132, .code = 1, .valid = true, .is_day = true };
+  st->battery_percent = 80;
+  st->ui_update_interval_sec = 5;
+  st->net_on = true;
+  yes_draw_refresh_steps();
+}
+
+static void render(GContext *ctx, Layer *layer, const YesFaceState *st) {
+  yes_draw_face(layer, ctx, st);
+  yes_draw_corners(layer, ctx, st);
+}
+
+static void print_stats(const char *label, const HostGfxStats *g, double us) {
+  printf("draw   %-7s %8.1f us  rect %u circ %u/%u line %u radial %u arc %u path %u/%u text %u fb %u px %llu\n",
+         label, us, g->fill_rect + g->draw_rect, g->fill_circle, g->draw_circle, g->draw_line,
+         g->fill_radial, g->draw_arc, g->path_fill, g->path_outline, g->text, g->fb_capture,
+         (unsigned long long)g->pixels);
+}
+
+static uint32_t frame_hash(const GContext *ctx) {
+  uint32_t h = 2166136261u;
+  for (int16_t y = 0; y < HOST_H; y++) {
+    for (int16_t x = 0; x < HOST_W; x++) {
+      const uint32_t rgb = host_fb_rgb(ctx, x, y);
+      for (int k = 0; k < 3; k++) {
+        h ^= (rgb >> (8 * k)) & 0xff;
+        h *= 16777619u;
+      }
+    }
+  }
+  return h;
+}
+
+// ---- PNG (stored deflate, no zlib dependency) ----
+
+static uint32_t s_crc_table[256];
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t n) {
+  if (!s_crc_table[1]) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      s_crc_table[i] = c;
+    }
+  }
+  crc = ~crc;
+  while (n--) crc = s_crc_table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+  uint8_t hdr[8];
+  put_be32(hdr, len);
+  memcpy(hdr + 4, type, 4);
+  fwrite(hdr, 1, 8, f);
+  if (len) fwrite(data, 1, len, f);
+  uint32_t crc = crc32_update(0, (const uint8_t *)type, 4);
+  crc = crc32_update(crc, data, len);
+  uint8_t tail[4];
+  put_be32(tail, crc);
+  fwrite(tail, 1, 4, f);
+}
+
+static bool write_png(const GContext *ctx, const char *path) {
+  const size_t row = 1 + (size_t)HOST_W * 3;
+  const size_t raw_len = row * HOST_H;
+  uint8_t *raw = (uint8_t *)malloc(raw_len);
+  const size_t blocks = (raw_len + 65534) / 65535;
+  const size_t z_len = 2 + raw_len + blocks * 5 + 4;
+  uint8_t *z = (uint8_t *)malloc(z_len);
+  if (!raw || !z) { free(raw); free(z); return false; }
+
+  for (int16_t y = 0; y < HOST_H; y++) {
+    uint8_t *r = raw + (size_t)y * row;
+    r[0] = 0; // filter: none
+    for (int16_t x = 0; x < HOST_W; x++) {
+      const uint32_t rgb = host_fb_rgb(ctx, x, y);
+      r[1 + x * 3] = (uint8_t)(rgb >> 16);
+      r[2 + x * 3] = (uint8_t)(rgb >> 8);
+      r[3 + x * 3] = (uint8_t)rgb;
+    }
+  }
+
+  uint8_t *o = z;
+  *o++ = 0x78; *o++ = 0x01;
+  uint32_t a = 1, b = 0;
+  for (size_t off = 0; off < raw_len; off += 65535) {
+    const uint16_t n = (uint16_t)((raw_len - off) < 65535 ? (raw_len - off) : 65535);
+    *o++ = (off + n >= raw_len) ? 1 : 0;
+    *o++ = (uint8_t)n; *o++ = (uint8_t)(n >> 8);
+    *o++ = (uint8_t)~n; *o++ = (uint8_t)(~n >> 8);
+    memcpy(o, raw + off, n);
+    o += n;
+  }
+  for (size_t i = 0; i < raw_len; i++) { a = (a + raw[i]) % 65521; b = (b + a) % 65521; }
+  put_be32(o, (b << 16) | a);
+  o += 4;
+
+  FILE *f = fopen(path, "wb");
+  if (!f) { free(raw); free(z); return false; }
+  static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+  fwrite(sig, 1, 8, f);
+  uint8_t ihdr[13];
+  put_be32(ihdr, HOST_W);
+  put_be32(ihdr + 4, HOST_H);
+  ihdr[8] = 8; ihdr[9] = 2; ihdr[10] = 0; ihdr[11] = 0; ihdr[12] = 0; // 8-bit RGB
+  png_chunk(f, "IHDR", ihdr, 13);
+  png_chunk(f, "IDAT", z, (uint32_t)(o - z));
+  png_chunk(f, "IEND", NULL, 0);
+  fclose(f);
+  free(raw);
+  free(z);
+  return true;
+}
+
+// One simulated hour of wakes as the app schedules them: each minute tick plus, outside low power,
+// the corner cadence wakes in between (each repaints the whole face under the overlay layer).
+static void bench_hour(GContext *ctx, Layer *layer, Scene *scene, bool low_power) {
+  scene->st.low_power = low_power;
+  yes_draw_deinit();
+  yes_draw_init();
+  int frames = 0;
+  double us = 0;
+  for (time_t t = SCENE_UNIX; t < SCENE_UNIX + 3600;) {
+    host_set_time(t, SCENE_TZ_MIN);
+    const double t0 = now_us();
+    render(ctx, layer, &scene->st);
+    us += now_us() - t0;
+    frames++;
+    const time_t tick = (t / 60 + 1) * 60;
+    const time_t at = yes_draw_corners_next_change(layer, &scene->st, t);
+    t = (at && at < tick) ? at : tick;
+  }
+  printf("hour   %-7s %4d frames %9.0f us\n", low_power ? "lowpwr" : "normal", frames, us);
+  scene->st.low_power = false;
+  host_set_time(SCENE_UNIX, SCENE_TZ_MIN);
+}
+
+static void bench_draw(const char *png_path, int iters) {
+  Scene scene;
+  scene_init(&scene);
+  Layer layer = { .frame = GRect(0, 0, HOST_W, HOST_H) };
+#if defined(PBL_ROUND)
+  const HostFbKind kind = HOST_FB_ROUND_8BIT;
+#elif defined(PBL_COLOR)
+  const HostFbKind kind = HOST_FB_RECT_8BIT;
+#else
+  const HostFbKind kind = HOST_FB_RECT_1BIT;
+#endif
+  GContext ctx;
+  host_ctx_init(&ctx, HOST_W, HOST_H, kind);
+  yes_draw_init();
+
+  // Cold: dial cache empty (first frame, or after sun/moon/phase change).
+  double cold_us = 0;
+  HostGfxStats cold = { 0 };
+  for (int i = 0; i < iters; i++) {
+    yes_draw_deinit();
+    yes_draw_init();
+    memset(&ctx.stats, 0, sizeof(ctx.stats));
+    const double t0 = now_us();
+    render(&ctx, &layer, &scene.st);
+    cold_us += now_us() - t0;
+    cold = ctx.stats;
+  }
+  // Warm: the per-minute case, dial restored from the cache.
+  double warm_us = 0;
+  HostGfxStats warm = { 0 };
+  for (int i = 0; i < iters; i++) {
+    memset(&ctx.stats, 0, sizeof(ctx.stats));
+    const double t0 = now_us();
+    render(&ctx, &layer, &scene.st);
+    warm_us += now_us() - t0;
+    warm = ctx.stats;
+  }
+  print_stats("cold", &cold, cold_us / iters);
+  print_stats("warm", &warm, warm_us / iters);
+
+  const uint32_t hash = frame_hash(&ctx);
+  printf("frame  %s %dx%d hash %08x\n", HOST_PLATFORM, HOST_W, HOST_H, hash);
+  if (png_path && !write_png(&ctx, png_path)) {
+    fprintf(stderr, "could not write %s\n", png_path);
+  }
+
+  bench_hour(&ctx, &layer, &scene, false);
+  bench_hour(&ctx, &layer, &scene, true);
+
+  yes_draw_deinit();
+  host_ctx_deinit(&ctx);
+}
+
+int main(int argc, char **argv) {
+  const char *png_path = NULL;
+  int iters = 50;
+  bool astro = true;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--png") && i + 1 < argc) png_path = argv[++i];
+    else if (!strcmp(argv[i], "--iters") && i + 1 < argc) iters = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--no-astro")) astro = false;
+    else {
+      fprintf(stderr, "usage: %s [--png out.png] [--iters N] [--no-astro]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (iters < 1) iters = 1;
+  yes_i18n_set_language(YES_LANG_EN);
+  printf("== %s\n", HOST_PLATFORM);
+  if (astro) bench_astro();
+  bench_draw(png_path, iters);
+  return 0;
+}
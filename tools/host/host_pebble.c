@@ -0,0 +1,542 @@
+// Host implementation of tools/host/pebble.h: a small software rasterizer plus service stubs.
+// Shapes follow the SDK's geometry closely enough to catch layout and paint-order regressions;
+// antialiasing and the real fonts are not emulated (text renders as one block per glyph).
+
+#include <pebble.h>
+
+#include <math.h>
+#include <stdarg.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// ---- trig: same fixed-point contract as the firmware tables ----
+
+uint32_t host_trig_calls;
+
+int32_t sin_lookup(int32_t angle) {
+  host_trig_calls++;
+  return (int32_t)lround(sin((double)angle * 2.0 * M_PI / TRIG_MAX_ANGLE) * TRIG_MAX_RATIO);
+}
+
+int32_t cos_lookup(int32_t angle) {
+  host_trig_calls++;
+  return (int32_t)lround(cos((double)angle * 2.0 * M_PI / TRIG_MAX_ANGLE) * TRIG_MAX_RATIO);
+}
+
+int32_t atan2_lookup(int16_t y, int16_t x) {
+  host_trig_calls++;
+  double r = atan2((double)y, (double)x);
+  if (r < 0) r += 2.0 * M_PI;
+  return (int32_t)lround(r * TRIG_MAX_ANGLE / (2.0 * M_PI)) % TRIG_MAX_ANGLE;
+}
+
+// ---- framebuffer ----
+
+static int16_t s_round_min_x[512];
+static int16_t s_round_max_x[512];
+
+void host_ctx_init(GContext *ctx, int16_t w, int16_t h, HostFbKind kind) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->fb.bounds = GRect(0, 0, w, h);
+  ctx->fill = GColorBlack;
+  ctx->stroke = GColorWhite;
+  ctx->text = GColorWhite;
+  ctx->stroke_width = 1;
+  ctx->antialiased = true;
+  if (kind == HOST_FB_RECT_1BIT) {
+    ctx->fb.format = GBitmapFormat1Bit;
+    ctx->fb.row_size_bytes = (uint16_t)(((w + 31) / 32) * 4);
+  } else {
+    ctx->fb.format = (kind == HOST_FB_ROUND_8BIT) ? GBitmapFormat8BitCircular : GBitmapFormat8Bit;
+    ctx->fb.row_size_bytes = (uint16_t)w;
+  }
+  if (kind == HOST_FB_ROUND_8BIT) {
+    // Visible span per row of a circular display whose diameter is the width.
+    const double r = w / 2.0;
+    const double cy = (h - 1) / 2.0;
+    const double cx = (w - 1) / 2.0;
+    for (int16_t y = 0; y < h && y < 512; y++) {
+      const double dy = y - cy;
+      const double half = (r * r > dy * dy) ? sqrt(r * r - dy * dy) : 0.0;
+      s_round_min_x[y] = (int16_t)ceil(cx - half);
+      s_round_max_x[y] = (int16_t)floor(cx + half);
+      if (s_round_max_x[y] < s_round_min_x[y]) s_round_max_x[y] = s_round_min_x[y];
+    }
+    ctx->fb.row_min_x = s_round_min_x;
+    ctx->fb.row_max_x = s_round_max_x;
+  }
+  ctx->fb.data = (uint8_t *)calloc((size_t)ctx->fb.row_size_bytes * (size_t)h, 1);
+  ctx->fb.owns_data = true;
+}
+
+void host_ctx_deinit(GContext *ctx) {
+  if (ctx->fb.owns_data) free(ctx->fb.data);
+  ctx->fb.data = NULL;
+}
+
+// B/W panels: gray levels become a 50% checkerboard, like the firmware's dithered grays.
+static bool bw_pixel_on(GColor c, int16_t x, int16_t y) {
+  const int sum = c.r + c.g + c.b; // 0..9
+  if (sum <= 2) return false;
+  if (sum >= 7) return true;
+  return ((x + y) & 1) == 0;
+}
+
+static bool pixel_visible(const GBitmap *fb, int16_t x, int16_t y) {
+  if (x < 0 || y < 0 || x >= fb->bounds.size.w || y >= fb->bounds.size.h) return false;
+  if (fb->format == GBitmapFormat8BitCircular) {
+    return x >= fb->row_min_x[y] && x <= fb->row_max_x[y];
+  }
+  return true;
+}
+
+static void put_pixel(GContext *ctx, int16_t x, int16_t y, GColor c) {
+  GBitmap *fb = &ctx->fb;
+  if (!pixel_visible(fb, x, y)) return;
+  if (c.a == 0) return;
+  ctx->stats.pixels++;
+  uint8_t *row = fb->data + (size_t)y * fb->row_size_bytes;
+  if (fb->format == GBitmapFormat1Bit) {
+    const uint8_t bit = (uint8_t)(1u << (x & 7));
+    if (bw_pixel_on(c, x, y)) row[x >> 3] |= bit;
+    else row[x >> 3] &= (uint8_t)~bit;
+  } else {
+    row[x] = c.argb;
+  }
+}
+
+uint32_t host_fb_rgb(const GContext *ctx, int16_t x, int16_t y) {
+  const GBitmap *fb = &ctx->fb;
+  if (!pixel_visible(fb, x, y)) return 0;
+  const uint8_t *row = fb->data + (size_t)y * fb->row_size_bytes;
+  if (fb->format == GBitmapFormat1Bit) {
+    return (row[x >> 3] & (1u << (x & 7))) ? 0xFFFFFF : 0;
+  }
+  const GColor c = { .argb = row[x] };
+  return ((uint32_t)(c.r * 85) << 16) | ((uint32_t)(c.g * 85) << 8) | (uint32_t)(c.b * 85);
+}
+
+// ---- primitives ----
+
+static void span(GContext *ctx, int16_t y, int16_t x0, int16_t x1, GColor c) {
+  for (int16_t x = x0; x <= x1; x++) put_pixel(ctx, x, y, c);
+}
+
+static void disc(GContext *ctx, double cx, double cy, double r, GColor c) {
+  const int16_t y0 = (int16_t)floor(cy - r), y1 = (int16_t)ceil(cy + r);
+  for (int16_t y = y0; y <= y1; y++) {
+    const double dy = y - cy;
+    if (dy * dy > r * r) continue;
+    const double half = sqrt(r * r - dy * dy);
+    span(ctx, y, (int16_t)ceil(cx - half), (int16_t)floor(cx + half), c);
+  }
+}
+
+static void stroke_point(GContext *ctx, int16_t x, int16_t y) {
+  if (ctx->stroke_width <= 1) {
+    put_pixel(ctx, x, y, ctx->stroke);
+  } else {
+    disc(ctx, x, y, ctx->stroke_width / 2.0, ctx->stroke);
+  }
+}
+
+static void line_raw(GContext *ctx, GPoint p0, GPoint p1) {
+  int dx = abs(p1.x - p0.x), sx = p0.x < p1.x ? 1 : -1;
+  int dy = -abs(p1.y - p0.y), sy = p0.y < p1.y ? 1 : -1;
+  int err = dx + dy;
+  int x = p0.x, y = p0.y;
+  for (;;) {
+    stroke_point(ctx, (int16_t)x, (int16_t)y);
+    if (x == p1.x && y == p1.y) break;
+    const int e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x += sx; }
+    if (e2 <= dx) { err += dx; y += sy; }
+  }
+}
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color) { ctx->fill = color; }
+void graphics_context_set_stroke_color(GContext *ctx, GColor color) { ctx->stroke = color; }
+void graphics_context_set_text_color(GContext *ctx, GColor color) { ctx->text = color; }
+void graphics_context_set_stroke_width(GContext *ctx, uint8_t width) { ctx->stroke_width = width ? width : 1; }
+void graphics_context_set_antialiased(GContext *ctx, bool enable) { ctx->antialiased = enable; }
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode) { (void)ctx; (void)mode; }
+
+static bool in_round_corner(GRect r, int16_t x, int16_t y, int16_t rad, GCornerMask mask) {
+  if (rad <= 0) return false;
+  const int16_t l = r.origin.x, t = r.origin.y;
+  const int16_t rr = (int16_t)(l + r.size.w - 1), b = (int16_t)(t + r.size.h - 1);
+  double cx, cy;
+  if (x < l + rad && y < t + rad && (mask & GCornerTopLeft)) { cx = l + rad - 0.5; cy = t + rad - 0.5; }
+  else if (x > rr - rad && y < t + rad && (mask & GCornerTopRight)) { cx = rr - rad + 0.5; cy = t + rad - 0.5; }
+  else if (x < l + rad && y > b - rad && (mask & GCornerBottomLeft)) { cx = l + rad - 0.5; cy = b - rad + 0.5; }
+  else if (x > rr - rad && y > b - rad && (mask & GCornerBottomRight)) { cx = rr - rad + 0.5; cy = b - rad + 0.5; }
+  else return false;
+  const double dx = x - cx, dy = y - cy;
+  return dx * dx + dy * dy > (double)rad * rad;
+}
+
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask) {
+  ctx->stats.fill_rect++;
+  const int16_t rad = (int16_t)MIN(corner_radius, MIN(rect.size.w, rect.size.h) / 2);
+  for (int16_t y = rect.origin.y; y < rect.origin.y + rect.size.h; y++) {
+    for (int16_t x = rect.origin.x; x < rect.origin.x + rect.size.w; x++) {
+      if (in_round_corner(rect, x, y, rad, corner_mask)) continue;
+      put_pixel(ctx, x, y, ctx->fill);
+    }
+  }
+}
+
+void graphics_draw_rect(GContext *ctx, GRect rect) {
+  ctx->stats.draw_rect++;
+  const int16_t x1 = (int16_t)(rect.origin.x + rect.size.w - 1);
+  const int16_t y1 = (int16_t)(rect.origin.y + rect.size.h - 1);
+  line_raw(ctx, rect.origin, GPoint(x1, rect.origin.y));
+  line_raw(ctx, GPoint(x1, rect.origin.y), GPoint(x1, y1));
+  line_raw(ctx, GPoint(x1, y1), GPoint(rect.origin.x, y1));
+  line_raw(ctx, GPoint(rect.origin.x, y1), rect.origin);
+}
+
+void graphics_draw_round_rect(GContext *ctx, GRect rect, uint16_t radius) {
+  ctx->stats.draw_rect++;
+  const int16_t rad = (int16_t)MIN(radius, MIN(rect.size.w, rect.size.h) / 2);
+  // Outline = rounded-rect pixels that have a neighbour outside it.
+  for (int16_t y = rect.origin.y; y < rect.origin.y + rect.size.h; y++) {
+    for (int16_t x = rect.origin.x; x < rect.origin.x + rect.size.w; x++) {
+      if (in_round_corner(rect, x, y, rad, GCornersAll)) continue;
+      const bool edge = x == rect.origin.x || y == rect.origin.y ||
+                        x == rect.origin.x + rect.size.w - 1 || y == rect.origin.y + rect.size.h - 1 ||
+                        in_round_corner(rect, (int16_t)(x - 1), y, rad, GCornersAll) ||
+                        in_round_corner(rect, (int16_t)(x + 1), y, rad, GCornersAll) ||
+                        in_round_corner(rect, x, (int16_t)(y - 1), rad, GCornersAll) ||
+                        in_round_corner(rect, x, (int16_t)(y + 1), rad, GCornersAll);
+      if (edge) put_pixel(ctx, x, y, ctx->stroke);
+    }
+  }
+}
+
+void graphics_fill_circle(GContext *ctx, GPoint p, uint16_t radius) {
+  ctx->stats.fill_circle++;
+  disc(ctx, p.x, p.y, radius + 0.5, ctx->fill);
+}
+
+static void ring(GContext *ctx, double cx, double cy, double r_out, double r_in,
+                 int32_t a0, int32_t span_angle, GColor c) {
+  const int16_t y0 = (int16_t)floor(cy - r_out), y1 = (int16_t)ceil(cy + r_out);
+  const int16_t x0 = (int16_t)floor(cx - r_out), x1 = (int16_t)ceil(cx + r_out);
+  for (int16_t y = y0; y <= y1; y++) {
+    for (int16_t x = x0; x <= x1; x++) {
+      const double dx = x - cx, dy = y - cy;
+      const double d2 = dx * dx + dy * dy;
+      if (d2 > r_out * r_out || d2 < r_in * r_in) continue;
+      if (span_angle < TRIG_MAX_ANGLE) {
+        // Pebble angles run clockwise from 12 o'clock.
+        double a = atan2(dx, -dy);
+        if (a < 0) a += 2.0 * M_PI;
+        const int32_t ang = (int32_t)(a * TRIG_MAX_ANGLE / (2.0 * M_PI));
+        const int32_t rel = ((ang - a0) % TRIG_MAX_ANGLE + TRIG_MAX_ANGLE) % TRIG_MAX_ANGLE;
+        if (rel > span_angle) continue;
+      }
+      put_pixel(ctx, x, y, c);
+    }
+  }
+}
+
+void graphics_draw_circle(GContext *ctx, GPoint p, uint16_t radius) {
+  ctx->stats.draw_circle++;
+  const double hw = ctx->stroke_width / 2.0;
+  ring(ctx, p.x, p.y, radius + hw, radius - hw, 0, TRIG_MAX_ANGLE, ctx->stroke);
+}
+
+void graphics_draw_line(GContext *ctx, GPoint p0, GPoint p1) {
+  ctx->stats.draw_line++;
+  line_raw(ctx, p0, p1);
+}
+
+void graphics_draw_pixel(GContext *ctx, GPoint point) {
+  ctx->stats.draw_pixel++;
+  put_pixel(ctx, point.x, point.y, ctx->stroke);
+}
+
+static void sweep(int32_t start, int32_t end, int32_t *out_a0, int32_t *out_span) {
+  int32_t span_angle = end - start;
+  if (span_angle >= TRIG_MAX_ANGLE || span_angle <= -TRIG_MAX_ANGLE) span_angle = TRIG_MAX_ANGLE;
+  else if (span_angle < 0) span_angle += TRIG_MAX_ANGLE;
+  *out_a0 = ((start % TRIG_MAX_ANGLE) + TRIG_MAX_ANGLE) % TRIG_MAX_ANGLE;
+  *out_span = span_angle;
+}
+
+void graphics_fill_radial(GContext *ctx, GRect rect, GOvalScaleMode scale_mode, uint16_t inset_thickness,
+                          int32_t angle_start, int32_t angle_end) {
+  (void)scale_mode;
+  ctx->stats.fill_radial++;
+  int32_t a0, sp;
+  sweep(angle_start, angle_end, &a0, &sp);
+  const double r = MIN(rect.size.w, rect.size.h) / 2.0;
+  const double cx = rect.origin.x + (rect.size.w - 1) / 2.0;
+  const double cy = rect.origin.y + (rect.size.h - 1) / 2.0;
+  ring(ctx, cx, cy, r, r - inset_thickness, a0, sp, ctx->fill);
+}
+
+void graphics_draw_arc(GContext *ctx, GRect rect, GOvalScaleMode scale_mode, int32_t angle_start, int32_t angle_end) {
+  (void)scale_mode;
+  ctx->stats.draw_arc++;
+  int32_t a0, sp;
+  sweep(angle_start, angle_end, &a0, &sp);
+  const double r = MIN(rect.size.w, rect.size.h) / 2.0;
+  const double hw = ctx->stroke_width / 2.0;
+  const double cx = rect.origin.x + (rect.size.w - 1) / 2.0;
+  const double cy = rect.origin.y + (rect.size.h - 1) / 2.0;
+  ring(ctx, cx, cy, r + hw - 0.5, r - hw - 0.5, a0, sp, ctx->stroke);
+}
+
+// ---- paths ----
+
+GPath *gpath_create(const GPathInfo *init) {
+  GPath *p = (GPath *)calloc(1, sizeof(GPath));
+  if (!p) return NULL;
+  p->num_points = init->num_points;
+  p->points = init->points;
+  return p;
+}
+
+void gpath_destroy(GPath *path) { free(path); }
+void gpath_rotate_to(GPath *path, int32_t angle) { path->rotation = angle; }
+void gpath_move_to(GPath *path, GPoint point) { path->offset = point; }
+
+static GPoint path_point(const GPath *path, uint32_t i) {
+  const GPoint p = path->points[i];
+  const int32_t s = sin_lookup(path->rotation), c = cos_lookup(path->rotation);
+  const int32_t x = (p.x * c - p.y * s) / TRIG_MAX_RATIO;
+  const int32_t y = (p.x * s + p.y * c) / TRIG_MAX_RATIO;
+  return GPoint(x + path->offset.x, y + path->offset.y);
+}
+
+void gpath_draw_filled(GContext *ctx, GPath *path) {
+  ctx->stats.path_fill++;
+  if (!path || path->num_points < 3) return;
+  int16_t y0 = INT16_MAX, y1 = INT16_MIN;
+  for (uint32_t i = 0; i < path->num_points; i++) {
+    const GPoint p = path_point(path, i);
+    if (p.y < y0) y0 = p.y;
+    if (p.y > y1) y1 = p.y;
+  }
+  // Even-odd scanline fill at pixel centres.
+  for (int16_t y = y0; y <= y1; y++) {
+    double xs[32];
+    int n = 0;
+    const double sy = y + 0.5;
+    for (uint32_t i = 0; i < path->num_points && n < 32; i++) {
+      const GPoint a = path_point(path, i);
+      const GPoint b = path_point(path, (i + 1) % path->num_points);
+      if ((a.y <= sy && b.y > sy) || (b.y <= sy && a.y > sy)) {
+        xs[n++] = a.x + (sy - a.y) * (b.x - a.x) / (double)(b.y - a.y);
+      }
+    }
+    for (int i = 1; i < n; i++) {
+      for (int j = i; j > 0 && xs[j - 1] > xs[j]; j--) {
+        const double t = xs[j]; xs[j] = xs[j - 1]; xs[j - 1] = t;
+      }
+    }
+    for (int i = 0; i + 1 < n; i += 2) {
+      span(ctx, y, (int16_t)ceil(xs[i] - 0.5), (int16_t)floor(xs[i + 1] - 0.5), ctx->fill);
+    }
+  }
+}
+
+void gpath_draw_outline(GContext *ctx, GPath *path) {
+  ctx->stats.path_outline++;
+  if (!path || path->num_points < 2) return;
+  for (uint32_t i = 0; i < path->num_points; i++) {
+    line_raw(ctx, path_point(path, i), path_point(path, (i + 1) % path->num_points));
+  }
+}
+
+// ---- text: block glyphs sized from the font key ----
+
+static struct GFontInfo s_fonts[16];
+static int s_font_count;
+
+GFont fonts_get_system_font(const char *font_key) {
+  int16_t size = 14;
+  const char *p = font_key;
+  while (*p && (*p < '0' || *p > '9')) p++;
+  if (*p) size = (int16_t)atoi(p);
+  const bool bold = strstr(font_key, "BOLD") != NULL;
+  for (int i = 0; i < s_font_count; i++) {
+    if (s_fonts[i].size == size && s_fonts[i].bold == bold) return &s_fonts[i];
+  }
+  if (s_font_count >= (int)(sizeof(s_fonts) / sizeof(s_fonts[0]))) return &s_fonts[0];
+  s_fonts[s_font_count] = (struct GFontInfo){ .size = size, .bold = bold };
+  return &s_fonts[s_font_count++];
+}
+
+static int16_t glyph_w(GFont f) { return (int16_t)((f->size * (f->bold ? 11 : 10) + 10) / 20); }
+
+static int visible_chars(const char *text, GFont f, int16_t box_w) {
+  int n = 0;
+  for (const unsigned char *p = (const unsigned char *)text; *p && *p != '\n'; p++) {
+    if ((*p & 0xC0) != 0x80) n++; // count UTF-8 code points
+  }
+  const int fit = glyph_w(f) > 0 ? box_w / glyph_w(f) : n;
+  return n < fit ? n : fit;
+}
+
+static GSize text_size(const char *text, GFont font, GRect box) {
+  if (!text || !font) return GSize(0, 0);
+  const int n = visible_chars(text, font, box.size.w);
+  const int16_t line_h = (int16_t)(font->size + font->size / 5);
+  return GSize(n * glyph_w(font), MIN(line_h, box.size.h));
+}
+
+GSize graphics_text_layout_get_content_size(const char *text, GFont font, GRect box,
+                                            GTextOverflowMode overflow_mode, GTextAlignment alignment) {
+  (void)overflow_mode; (void)alignment;
+  return text_size(text, font, box);
+}
+
+void graphics_draw_text(GContext *ctx, const char *text, GFont font, GRect box, GTextOverflowMode overflow_mode,
+                        GTextAlignment alignment, GTextAttributes *text_attributes) {
+  (void)overflow_mode; (void)text_attributes;
+  ctx->stats.text++;
+  if (!text || !font) return;
+  const GSize sz = text_size(text, font, box);
+  const int16_t gw = glyph_w(font);
+  int16_t x = box.origin.x;
+  if (alignment == GTextAlignmentCenter) x = (int16_t)(box.origin.x + (box.size.w - sz.w) / 2);
+  else if (alignment == GTextAlignmentRight) x = (int16_t)(box.origin.x + box.size.w - sz.w);
+  // Cap height sits roughly between 30% and 90% of the nominal size for Gothic.
+  const int16_t gy = (int16_t)(box.origin.y + font->size * 3 / 10);
+  const int16_t gh = (int16_t)(font->size * 6 / 10);
+  int i = 0;
+  const int n = sz.w / (gw ? gw : 1);
+  for (const unsigned char *p = (const unsigned char *)text; *p && i < n; p++) {
+    if ((*p & 0xC0) == 0x80) continue;
+    if (*p != ' ') {
+      for (int16_t yy = gy; yy < gy + gh && yy < box.origin.y + box.size.h; yy++) {
+        span(ctx, yy, (int16_t)(x + i * gw + 1), (int16_t)(x + (i + 1) * gw - 2), ctx->text);
+      }
+    }
+    i++;
+  }
+}
+
+// ---- frame buffer access ----
+
+GBitmap *graphics_capture_frame_buffer(GContext *ctx) {
+  if (ctx->fb_captured) return NULL;
+  ctx->stats.fb_capture++;
+  ctx->fb_captured = true;
+  return &ctx->fb;
+}
+
+GBitmap *graphics_capture_frame_buffer_format(GContext *ctx, GBitmapFormat format) {
+  if (format != ctx->fb.format) return NULL;
+  return graphics_capture_frame_buffer(ctx);
+}
+
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer) {
+  if (buffer != &ctx->fb || !ctx->fb_captured) return false;
+  ctx->fb_captured = false;
+  return true;
+}
+
+uint8_t *gbitmap_get_data(const GBitmap *bitmap) { return bitmap->data; }
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap) { return bitmap->row_size_bytes; }
+GRect gbitmap_get_bounds(const GBitmap *bitmap) { return bitmap->bounds; }
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap) { return bitmap->format; }
+
+GBitmapDataRowInfo gbitmap_get_data_row_info(const GBitmap *bitmap, uint16_t y) {
+  GBitmapDataRowInfo info = {
+    .data = bitmap->data + (size_t)y * bitmap->row_size_bytes,
+    .min_x = 0,
+    .max_x = (int16_t)(bitmap->bounds.size.w - 1),
+  };
+  if (bitmap->format == GBitmapFormat8BitCircular) {
+    info.min_x = bitmap->row_min_x[y];
+    info.max_x = bitmap->row_max_x[y];
+  }
+  return info;
+}
+
+// ---- geometry / layers ----
+
+GPoint grect_center_point(const GRect *rect) {
+  return GPoint(rect->origin.x + rect->size.w / 2, rect->origin.y + rect->size.h / 2);
+}
+
+GRect grect_inset(GRect rect, int16_t inset) {
+  return GRect(rect.origin.x + inset, rect.origin.y + inset, rect.size.w - 2 * inset, rect.size.h - 2 * inset);
+}
+
+GRect layer_get_bounds(const Layer *layer) { return GRect(0, 0, layer->frame.size.w, layer->frame.size.h); }
+GRect layer_get_frame(const Layer *layer) { return layer->frame; }
+
+// ---- services ----
+
+static time_t s_now = 1750500000;
+static int32_t s_tz_min;
+static int32_t s_steps = 4321;
+
+void host_set_time(time_t now_utc, int32_t tz_offset_min) {
+  s_now = now_utc;
+  s_tz_min = tz_offset_min;
+}
+
+void host_set_steps(int32_t steps) { s_steps = steps; }
+
+#undef time
+time_t host_time(time_t *out) {
+  if (out) *out = s_now;
+  return s_now;
+}
+
+bool clock_is_timezone_set(void) { return false; }
+bool clock_is_24h_style(void) { return true; }
+
+time_t time_start_of_today(void) {
+  const time_t local = s_now + (time_t)s_tz_min * 60;
+  return local - (local % 86400) - (time_t)s_tz_min * 60;
+}
+
+void clock_copy_time_string(char *buffer, uint8_t size) {
+  const time_t local = s_now + (time_t)s_tz_min * 60;
+  struct tm tm_local;
+  gmtime_r(&local, &tm_local);
+  strftime(buffer, size, "%H:%M", &tm_local);
+}
+
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const uint16_t ms = (uint16_t)(ts.tv_nsec / 1000000);
+  if (tloc) *tloc = ts.tv_sec;
+  if (out_ms) *out_ms = ms;
+  return ms;
+}
+
+size_t heap_bytes_used(void) { return 0; }
+size_t heap_bytes_free(void) { return 0; }
+
+bool bluetooth_connection_service_peek(void) { return true; }
+
+HealthServiceAccessibilityMask health_service_metric_accessible(HealthMetric metric, time_t start, time_t end) {
+  (void)metric; (void)start; (void)end;
+  return HealthServiceAccessibilityMaskAvailable;
+}
+
+HealthValue health_service_sum_today(HealthMetric metric) {
+  (void)metric;
+  return s_steps;
+}
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...) {
+  if (getenv("HOST_QUIET")) return;
+  va_list ap;
+  va_start(ap, fmt);
+  fprintf(stderr, "[%u] %s:%d ", log_level, src_filename, src_line_number);
+  vfprintf(stderr, fmt, ap);
+  fputc('\n', stderr);
+  va_end(ap);
+}
@@ -0,0 +1,152 @@
+// Host implementation of tools/host/pebble_worker.h.
+
+#include <pebble_worker.h>
+
+// ---- persist ----
+
+#define HOST_PERSIST_KEYS 32
+#define HOST_PERSIST_MAX 256
+
+typedef struct {
+  uint32_t key;
+  uint16_t size;
+  bool used;
+  uint8_t data[HOST_PERSIST_MAX];
+} HostPersist;
+
+static HostPersist s_persist[HOST_PERSIST_KEYS];
+
+static HostPersist *persist_find(uint32_t key) {
+  for (int i = 0; i < HOST_PERSIST_KEYS; i++) {
+    if (s_persist[i].used && s_persist[i].key == key) return &s_persist[i];
+  }
+  return NULL;
+}
+
+void host_persist_clear(void) {
+  memset(s_persist, 0, sizeof(s_persist));
+}
+
+bool persist_exists(uint32_t key) {
+  return persist_find(key) != NULL;
+}
+
+int persist_read_data(uint32_t key, void *buffer, size_t buffer_size) {
+  const HostPersist *p = persist_find(key);
+  if (!p) return -1;
+  const size_t n = p->size < buffer_size ? p->size : buffer_size;
+  memcpy(buffer, p->data, n);
+  return (int)n;
+}
+
+status_t persist_write_data(uint32_t key, const void *data, size_t size) {
+  if (size > HOST_PERSIST_MAX) return -1;
+  HostPersist *p = persist_find(key);
+  for (int i = 0; !p && i < HOST_PERSIST_KEYS; i++) {
+    if (!s_persist[i].used) p = &s_persist[i];
+  }
+  if (!p) return -1;
+  *p = (HostPersist){ .key = key, .size = (uint16_t)size, .used = true };
+  memcpy(p->data, data, size);
+  return (status_t)size;
+}
+
+// ---- timers ----
+
+#define HOST_TIMERS 8
+
+struct AppTimer {
+  uint64_t due_ms;
+  AppTimerCallback cb;
+  void *data;
+  bool used;
+};
+
+static AppTimer s_timers[HOST_TIMERS];
+static uint64_t s_mono_ms;
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data) {
+  for (int i = 0; i < HOST_TIMERS; i++) {
+    if (!s_timers[i].used) {
+      s_timers[i] = (AppTimer){ .due_ms = s_mono_ms + timeout_ms, .cb = callback, .data = callback_data, .used = true };
+      return &s_timers[i];
+    }
+  }
+  return NULL;
+}
+
+void app_timer_cancel(AppTimer *timer_handle) {
+  if (timer_handle) timer_handle->used = false;
+}
+
+int host_worker_run_timers(int max_fires) {
+  int fired = 0;
+  while (fired < max_fires) {
+    AppTimer *next = NULL;
+    for (int i = 0; i < HOST_TIMERS; i++) {
+      if (s_timers[i].used && (!next || s_timers[i].due_ms < next->due_ms)) next = &s_timers[i];
+    }
+    if (!next) break;
+    s_mono_ms = next->due_ms;
+    const AppTimer t = *next;
+    next->used = false;
+    t.cb(t.data);
+    fired++;
+  }
+  return fired;
+}
+
+// ---- services ----
+
+static TickHandler s_tick_handler;
+static BatteryStateHandler s_battery_handler;
+static BatteryChargeState s_battery = { .charge_percent = 100 };
+static AppWorkerMessageHandler s_message_handler;
+static int s_sent[256];
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler) {
+  (void)tick_units;
+  s_tick_handler = handler;
+}
+
+void tick_timer_service_unsubscribe(void) { s_tick_handler = NULL; }
+
+void host_worker_tick(TimeUnits units_changed) {
+  if (!s_tick_handler) return;
+  const time_t now = time(NULL);
+  struct tm tm_now;
+  gmtime_r(&now, &tm_now); // the worker reads the clock itself; only the call matters
+  s_tick_handler(&tm_now, units_changed);
+}
+
+BatteryChargeState battery_state_service_peek(void) { return s_battery; }
+void battery_state_service_subscribe(BatteryStateHandler handler) { s_battery_handler = handler; }
+void battery_state_service_unsubscribe(void) { s_battery_handler = NULL; }
+
+void host_worker_set_battery(BatteryChargeState charge) {
+  s_battery = charge;
+  if (s_battery_handler) s_battery_handler(charge);
+}
+
+bool app_worker_message_subscribe(AppWorkerMessageHandler handler) {
+  s_message_handler = handler;
+  return true;
+}
+
+bool app_worker_message_unsubscribe(void) {
+  s_message_handler = NULL;
+  return true;
+}
+
+void app_worker_send_message(uint8_t type, AppWorkerMessage *data) {
+  (void)data;
+  s_sent[type]++;
+}
+
+void host_worker_face_message(uint16_t type, AppWorkerMessage *data) {
+  if (s_message_handler) s_message_handler(type, data);
+}
+
+int host_worker_sent(uint8_t type) { return s_sent[type]; }
+
+void worker_event_loop(void) {}
@@ -0,0 +1,267 @@
+#pragma once
+
+// Host stand-in for the subset of the Pebble SDK used by yes_draw.c, yes_astro.c and yes_i18n.c.
+// Graphics calls rasterize into a software framebuffer in the platform's native format and count
+// operations; time() is replaced by a settable clock so frames are reproducible.
+// Implementation: host_pebble.c. Not a general SDK emulation.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+// ---- basic types ----
+
+typedef struct { int16_t x, y; } GPoint;
+typedef struct { int16_t w, h; } GSize;
+typedef struct { GPoint origin; GSize size; } GRect;
+typedef union {
+  uint8_t argb;
+  struct { uint8_t b : 2, g : 2, r : 2, a : 2; };
+} GColor8;
+typedef GColor8 GColor;
+
+#define GPoint(x, y) ((GPoint){ (int16_t)(x), (int16_t)(y) })
+#define GSize(w, h) ((GSize){ (int16_t)(w), (int16_t)(h) })
+#define GRect(x, y, w, h) ((GRect){ { (int16_t)(x), (int16_t)(y) }, { (int16_t)(w), (int16_t)(h) } })
+#define GPointZero GPoint(0, 0)
+
+#define GColorFromHEX(v) ((GColor){ .argb = (uint8_t)(0xC0 | ((((v) >> 22) & 3) << 4) | ((((v) >> 14) & 3) << 2) | (((v) >> 6) & 3)) })
+#define GColorClear ((GColor){ .argb = 0x00 })
+#define GColorBlack ((GColor){ .argb = 0xC0 })
+#define GColorWhite ((GColor){ .argb = 0xFF })
+#define GColorDarkGray ((GColor){ .argb = 0xD5 })
+#define GColorLightGray ((GColor){ .argb = 0xEA })
+#define GColorOxfordBlue ((GColor){ .argb = 0xC1 })
+#define GColorDukeBlue ((GColor){ .argb = 0xC2 })
+#define GColorBlue ((GColor){ .argb = 0xC3 })
+#define GColorCobaltBlue ((GColor){ .argb = 0xC6 })
+#define GColorVividCerulean ((GColor){ .argb = 0xCB })
+#define GColorPictonBlue ((GColor){ .argb = 0xDB })
+#define GColorCyan ((GColor){ .argb = 0xCF })
+#define GColorCeleste ((GColor){ .argb = 0xEF })
+#define GColorImperialPurple ((GColor){ .argb = 0xD1 })
+#define GColorIndigo ((GColor){ .argb = 0xD2 })
+#define GColorLiberty ((GColor){ .argb = 0xD6 })
+#define GColorJaegerGreen ((GColor){ .argb = 0xC9 })
+#define GColorGreen ((GColor){ .argb = 0xCC })
+#define GColorMintGreen ((GColor){ .argb = 0xED })
+#define GColorRed ((GColor){ .argb = 0xF0 })
+#define GColorOrange ((GColor){ .argb = 0xF4 })
+#define GColorChromeYellow ((GColor){ .argb = 0xF8 })
+#define GColorRajah ((GColor){ .argb = 0xF9 })
+#define GColorYellow ((GColor){ .argb = 0xFC })
+#define GColorIcterine ((GColor){ .argb = 0xFD })
+#define GColorPastelYellow ((GColor){ .argb = 0xFE })
+#define GColorMelon ((GColor){ .argb = 0xFA })
+#define GColorFolly ((GColor){ .argb = 0xF1 })
+#define GColorEq(a, b) ((a).argb == (b).argb)
+
+#ifdef PBL_ROUND
+#define PBL_IF_ROUND_ELSE(a, b) (a)
+#else
+#define PBL_IF_ROUND_ELSE(a, b) (b)
+#endif
+#ifdef PBL_COLOR
+#define PBL_IF_COLOR_ELSE(a, b) (a)
+#else
+#define PBL_IF_COLOR_ELSE(a, b) (b)
+#endif
+// The SDK defines the display size per target; run.sh passes it as HOST_W / HOST_H.
+#ifdef HOST_W
+#define PBL_DISPLAY_WIDTH HOST_W
+#define PBL_DISPLAY_HEIGHT HOST_H
+#else
+#define PBL_DISPLAY_WIDTH 144
+#define PBL_DISPLAY_HEIGHT 168
+#endif
+
+// ---- trig ----
+
+#define TRIG_MAX_ANGLE 0x10000
+#define TRIG_MAX_RATIO 0xffff
+#define DEG_TO_TRIGANGLE(d) (((d) * TRIG_MAX_ANGLE) / 360)
+#define TRIGANGLE_TO_DEG(a) (((a) * 360) / TRIG_MAX_ANGLE)
+int32_t sin_lookup(int32_t angle);
+int32_t cos_lookup(int32_t angle);
+int32_t atan2_lookup(int16_t y, int16_t x);
+
+// ---- graphics ----
+
+typedef enum {
+  GBitmapFormat1Bit = 0,
+  GBitmapFormat8Bit,
+  GBitmapFormat1BitPalette,
+  GBitmapFormat2BitPalette,
+  GBitmapFormat4BitPalette,
+  GBitmapFormat8BitCircular,
+} GBitmapFormat;
+
+typedef struct GBitmap {
+  uint8_t *data;
+  uint16_t row_size_bytes;
+  GRect bounds;
+  GBitmapFormat format;
+  const int16_t *row_min_x; // 8BitCircular only
+  const int16_t *row_max_x;
+  bool owns_data;
+} GBitmap;
+
+typedef struct { uint8_t *data; int16_t min_x; int16_t max_x; } GBitmapDataRowInfo;
+
+typedef enum { GOvalScaleModeFitCircle, GOvalScaleModeFillCircle } GOvalScaleMode;
+typedef enum { GTextOverflowModeWordWrap, GTextOverflowModeTrailingEllipsis, GTextOverflowModeFill } GTextOverflowMode;
+typedef enum { GTextAlignmentLeft, GTextAlignmentCenter, GTextAlignmentRight } GTextAlignment;
+typedef enum {
+  GCornerNone = 0,
+  GCornerTopLeft = 1 << 0,
+  GCornerTopRight = 1 << 1,
+  GCornerBottomLeft = 1 << 2,
+  GCornerBottomRight = 1 << 3,
+  GCornersAll = 15,
+  GCornersTop = 3,
+  GCornersBottom = 12,
+  GCornersLeft = 5,
+  GCornersRight = 10,
+} GCornerMask;
+typedef enum { GCompOpAssign, GCompOpAssignInverted, GCompOpOr, GCompOpAnd, GCompOpClear, GCompOpSet } GCompOp;
+typedef struct GTextAttributes GTextAttributes;
+
+// Per-frame operation counters, reset by the harness.
+typedef struct {
+  uint32_t fill_rect, draw_rect, fill_circle, draw_circle, draw_line, draw_pixel;
+  uint32_t fill_radial, draw_arc, path_fill, path_outline, text;
+  uint32_t fb_capture;
+  uint64_t pixels; // pixel writes from all primitives
+} HostGfxStats;
+
+typedef struct GContext {
+  GBitmap fb;
+  GColor fill, stroke, text;
+  uint8_t stroke_width;
+  bool antialiased;
+  bool fb_captured;
+  HostGfxStats stats;
+} GContext;
+
+typedef struct Layer { GRect frame; } Layer;
+typedef struct Window Window;
+
+typedef struct GFontInfo { int16_t size; bool bold; } *GFont;
+#define FONT_KEY_GOTHIC_09 "RESOURCE_ID_GOTHIC_09"
+#define FONT_KEY_GOTHIC_14 "RESOURCE_ID_GOTHIC_14"
+#define FONT_KEY_GOTHIC_14_BOLD "RESOURCE_ID_GOTHIC_14_BOLD"
+#define FONT_KEY_GOTHIC_18 "RESOURCE_ID_GOTHIC_18"
+#define FONT_KEY_GOTHIC_18_BOLD "RESOURCE_ID_GOTHIC_18_BOLD"
+#define FONT_KEY_GOTHIC_24 "RESOURCE_ID_GOTHIC_24"
+#define FONT_KEY_GOTHIC_24_BOLD "RESOURCE_ID_GOTHIC_24_BOLD"
+#define FONT_KEY_GOTHIC_28 "RESOURCE_ID_GOTHIC_28"
+#define FONT_KEY_GOTHIC_28_BOLD "RESOURCE_ID_GOTHIC_28_BOLD"
+#define FONT_KEY_LECO_20_BOLD_NUMBERS "RESOURCE_ID_LECO_20_BOLD_NUMBERS"
+#define FONT_KEY_LECO_26_BOLD_NUMBERS_AM_PM "RESOURCE_ID_LECO_26_BOLD_NUMBERS_AM_PM"
+#define FONT_KEY_LECO_32_BOLD_NUMBERS "RESOURCE_ID_LECO_32_BOLD_NUMBERS"
+#define FONT_KEY_LECO_36_BOLD_NUMBERS "RESOURCE_ID_LECO_36_BOLD_NUMBERS"
+#define FONT_KEY_LECO_42_NUMBERS "RESOURCE_ID_LECO_42_NUMBERS"
+GFont fonts_get_system_font(const char *font_key);
+
+GPoint grect_center_point(const GRect *rect);
+GRect grect_inset(GRect rect, int16_t inset);
+GRect layer_get_bounds(const Layer *layer);
+GRect layer_get_frame(const Layer *layer);
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color);
+void graphics_context_set_stroke_color(GContext *ctx, GColor color);
+void graphics_context_set_text_color(GContext *ctx, GColor color);
+void graphics_context_set_stroke_width(GContext *ctx, uint8_t width);
+void graphics_context_set_antialiased(GContext *ctx, bool enable);
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode);
+
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask);
+void graphics_draw_rect(GContext *ctx, GRect rect);
+void graphics_draw_round_rect(GContext *ctx, GRect rect, uint16_t radius);
+void graphics_fill_circle(GContext *ctx, GPoint p, uint16_t radius);
+void graphics_draw_circle(GContext *ctx, GPoint p, uint16_t radius);
+void graphics_draw_line(GContext *ctx, GPoint p0, GPoint p1);
+void graphics_draw_pixel(GContext *ctx, GPoint point);
+void graphics_fill_radial(GContext *ctx, GRect rect, GOvalScaleMode scale_mode, uint16_t inset_thickness,
+                          int32_t angle_start, int32_t angle_end);
+void graphics_draw_arc(GContext *ctx, GRect rect, GOvalScaleMode scale_mode, int32_t angle_start, int32_t angle_end);
+void graphics_draw_text(GContext *ctx, const char *text, GFont font, GRect box, GTextOverflowMode overflow_mode,
+                        GTextAlignment alignment, GTextAttributes *text_attributes);
+GSize graphics_text_layout_get_content_size(const char *text, GFont font, GRect box,
+                                            GTextOverflowMode overflow_mode, GTextAlignment alignment);
+
+GBitmap *graphics_capture_frame_buffer(GContext *ctx);
+GBitmap *graphics_capture_frame_buffer_format(GContext *ctx, GBitmapFormat format);
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer);
+uint8_t *gbitmap_get_data(const GBitmap *bitmap);
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap);
+GRect gbitmap_get_bounds(const GBitmap *bitmap);
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap);
+GBitmapDataRowInfo gbitmap_get_data_row_info(const GBitmap *bitmap, uint16_t y);
+
+typedef struct { uint32_t num_points; GPoint *points; } GPathInfo;
+typedef struct { uint32_t num_points; GPoint *points; int32_t rotation; GPoint offset; } GPath;
+GPath *gpath_create(const GPathInfo *init);
+void gpath_destroy(GPath *path);
+void gpath_rotate_to(GPath *path, int32_t angle);
+void gpath_move_to(GPath *path, GPoint point);
+void gpath_draw_filled(GContext *ctx, GPath *path);
+void gpath_draw_outline(GContext *ctx, GPath *path);
+
+// ---- services ----
+
+time_t host_time(time_t *out);
+#define time(out) host_time(out)
+bool clock_is_timezone_set(void);
+bool clock_is_24h_style(void);
+time_t time_start_of_today(void);
+void clock_copy_time_string(char *buffer, uint8_t size);
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms);
+size_t heap_bytes_used(void);
+size_t heap_bytes_free(void);
+
+bool bluetooth_connection_service_peek(void);
+
+typedef struct { uint8_t charge_percent; bool is_charging; bool is_plugged; } BatteryChargeState;
+
+typedef enum { HealthMetricStepCount = 0 } HealthMetric;
+typedef enum {
+  HealthServiceAccessibilityMaskAvailable = 1,
+  HealthServiceAccessibilityMaskNoPermission = 2,
+  HealthServiceAccessibilityMaskNotSupported = 4,
+} HealthServiceAccessibilityMask;
+typedef int32_t HealthValue;
+HealthServiceAccessibilityMask health_service_metric_accessible(HealthMetric metric, time_t start, time_t end);
+HealthValue health_service_sum_today(HealthMetric metric);
+
+typedef enum {
+  APP_LOG_LEVEL_ERROR = 1,
+  APP_LOG_LEVEL_WARNING = 50,
+  APP_LOG_LEVEL_INFO = 100,
+  APP_LOG_LEVEL_DEBUG = 200,
+} AppLogLevel;
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...);
+#define APP_LOG(level, fmt, ...) app_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+
+// ---- harness hooks (not SDK) ----
+
+typedef enum { HOST_FB_RECT_8BIT, HOST_FB_ROUND_8BIT, HOST_FB_RECT_1BIT } HostFbKind;
+void host_ctx_init(GContext *ctx, int16_t w, int16_t h, HostFbKind kind);
+void host_ctx_deinit(GContext *ctx);
+void host_set_time(time_t now_utc, int32_t tz_offset_min);
+void host_set_steps(int32_t steps);
+// sin_lookup + cos_lookup + atan2_lookup calls so far.
+extern uint32_t host_trig_calls;
+// Pixel at (x, y) as 0xRRGGBB; black outside a round display.
+uint32_t host_fb_rgb(const GContext *ctx, int16_t x, int16_t y);
@@ -0,0 +1,60 @@
+#pragma once
+
+// Host stand-in for the worker SDK subset used by worker_src/c/yes_worker.c (and the face modules
+// it shares). Persist is an in-memory table, timers and ticks only fire when the harness says so,
+// and the clock is host_set_time's. Implementation: host_worker.c.
+
+#include <pebble.h>
+
+// ---- persist ----
+
+typedef int32_t status_t;
+bool persist_exists(uint32_t key);
+int persist_read_data(uint32_t key, void *buffer, size_t buffer_size);
+status_t persist_write_data(uint32_t key, const void *data, size_t size);
+
+// ---- timers and services ----
+
+typedef struct AppTimer AppTimer;
+typedef void (*AppTimerCallback)(void *data);
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data);
+void app_timer_cancel(AppTimer *timer_handle);
+
+typedef enum {
+  SECOND_UNIT = 1 << 0,
+  MINUTE_UNIT = 1 << 1,
+  HOUR_UNIT = 1 << 2,
+  DAY_UNIT = 1 << 3,
+  MONTH_UNIT = 1 << 4,
+  YEAR_UNIT = 1 << 5,
+} TimeUnits;
+typedef void (*TickHandler)(struct tm *tick_time, TimeUnits units_changed);
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler);
+void tick_timer_service_unsubscribe(void);
+
+typedef void (*BatteryStateHandler)(BatteryChargeState charge);
+BatteryChargeState battery_state_service_peek(void);
+void battery_state_service_subscribe(BatteryStateHandler handler);
+void battery_state_service_unsubscribe(void);
+
+typedef struct { uint16_t data0, data1, data2; } AppWorkerMessage;
+typedef void (*AppWorkerMessageHandler)(uint16_t type, AppWorkerMessage *data);
+bool app_worker_message_subscribe(AppWorkerMessageHandler handler);
+bool app_worker_message_unsubscribe(void);
+void app_worker_send_message(uint8_t type, AppWorkerMessage *data);
+
+void worker_event_loop(void);
+
+// ---- harness hooks (not SDK) ----
+
+void host_persist_clear(void);
+// Fires due timers in order (a fake monotonic clock jumps to each) until none are left or
+// max_fires is reached; returns how many fired.
+int host_worker_run_timers(int max_fires);
+// Calls the tick handler as the firmware would at the current host time.
+void host_worker_tick(TimeUnits units_changed);
+void host_worker_set_battery(BatteryChargeState charge);
+// Feeds the worker's message handler, as the face would.
+void host_worker_face_message(uint16_t type, AppWorkerMessage *data);
+// app_worker_send_message calls of this type so far.
+int host_worker_sent(uint8_t type);
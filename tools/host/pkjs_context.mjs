@@ -0,0 +1,29 @@
+// Loads src/pkjs/index.js into a sandbox with just enough of the PebbleKit JS environment
+// stubbed for its top level to run, so host tools can call its functions directly.
+import fs from 'node:fs';
+import path from 'node:path';
+import vm from 'node:vm';
+import { fileURLToPath } from 'node:url';
+
+const ROOT = path.resolve(path.dirname(fileURLToPath(import.meta.url)), '..', '..');
+
+export function loadPkjs() {
+  const store = new Map();
+  const ctx = {
+    console,
+    setTimeout: () => 0,
+    clearTimeout: () => {},
+    Pebble: { addEventListener() {}, sendAppMessage() {}, openURL() {} },
+    localStorage: {
+      getItem: (k) => (store.has(k) ? store.get(k) : null),
+      setItem: (k, v) => store.set(k, String(v)),
+      removeItem: (k) => store.delete(k),
+    },
+    navigator: { geolocation: { getCurrentPosition() {}, watchPosition() {} }, language: 'en' },
+    XMLHttpRequest: function XMLHttpRequest() {},
+  };
+  vm.createContext(ctx);
+  const file = path.join(ROOT, 'src', 'pkjs', 'index.js');
+  vm.runInContext(fs.readFileSync(file, 'utf8'), ctx, { filename: file });
+  return ctx;
+}
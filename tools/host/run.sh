@@ -0,0 +1,123 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+HOST_DIR="${ROOT_DIR}/tools/host"
+PACKAGE_JSON="${ROOT_DIR}/package.json"
+GOLDEN="${HOST_DIR}/golden.txt"
+OUT_DIR="${HOST_OUT_DIR:-${ROOT_DIR}/build/host}"
+CC="${CC:-cc}"
+
+usage() {
+  cat <<'USAGE'
+Usage: tools/host/run.sh [model|all] [--update] [--no-astro]
+
+Builds yes_draw.c / yes_astro.c natively against tools/host/pebble.h, once per
+platform, then prints astro and draw timings with per-frame operation counts.
+The deterministic frame is written to build/host/<model>.png and its hash is
+compared with tools/host/golden.txt. Then builds the background worker against
+tools/host/pebble_worker.h and runs its checks (tools/host/worker_check.c). The
+script exits 1 on any mismatch or failed check.
+
+Arguments:
+  model       Platform from package.json targetPlatforms (default: all)
+  --update    Accept the current frames as the new golden hashes
+  --no-astro  Skip the astro microbenchmarks
+
+Environment:
+  CC            Host C compiler (default: cc)
+  HOST_CFLAGS   Extra compiler flags (e.g. -O0 -g -fsanitize=address)
+  HOST_ITERS    Frames per timing run (default: 50)
+  HOST_OUT_DIR  Output directory (default: build/host)
+USAGE
+}
+
+# Display geometry and SDK defines per platform.
+platform_flags() {
+  case "$1" in
+    aplite|diorite|flint) echo "144 168 -DPBL_BW -DPBL_RECT" ;;
+    basalt)               echo "144 168 -DPBL_COLOR -DPBL_RECT" ;;
+    emery)                echo "200 228 -DPBL_COLOR -DPBL_RECT" ;;
+    chalk)                echo "180 180 -DPBL_COLOR -DPBL_ROUND" ;;
+    gabbro)               echo "260 260 -DPBL_COLOR -DPBL_ROUND" ;;
+    *) return 1 ;;
+  esac
+}
+
+MODEL="all"
+UPDATE=0
+BENCH_ARGS=()
+for arg in "$@"; do
+  case "$arg" in
+    -h|--help) usage; exit 0 ;;
+    --update) UPDATE=1 ;;
+    --no-astro) BENCH_ARGS+=(--no-astro) ;;
+    -*) usage >&2; exit 2 ;;
+    *) MODEL="$arg" ;;
+  esac
+done
+
+if [ "$MODEL" = "all" ]; then
+  mapfile -t MODELS < <(python3 -c "
+import json, sys
+with open(sys.argv[1], encoding='utf-8') as f:
+    for platform in json.load(f)['pebble']['targetPlatforms']:
+        print(platform)
+" "$PACKAGE_JSON")
+else
+  MODELS=("$MODEL")
+fi
+
+mkdir -p "$OUT_DIR"
+touch "$GOLDEN"
+status=0
+
+for model in "${MODELS[@]}"; do
+  if ! spec="$(platform_flags "$model")"; then
+    echo "Unknown platform: ${model}" >&2
+    exit 2
+  fi
+  read -r w h defines <<<"$spec"
+  bin="${OUT_DIR}/bench-${model}"
+  # shellcheck disable=SC2086
+  "$CC" -std=gnu11 -O2 -Wall -Wextra -Wno-unused-parameter -Wno-missing-field-initializers \
+    -I"$HOST_DIR" -I"${ROOT_DIR}/src/c" $defines \
+    -DHOST_PLATFORM="\"${model}\"" -DHOST_W="$w" -DHOST_H="$h" ${HOST_CFLAGS:-} \
+    "${HOST_DIR}/bench.c" "${HOST_DIR}/host_pebble.c" \
+    "${ROOT_DIR}/src/c/yes_draw.c" "${ROOT_DIR}/src/c/yes_astro.c" "${ROOT_DIR}/src/c/yes_i18n.c" \
+    -lm -o "$bin"
+
+  out="$(HOST_QUIET=1 "$bin" --png "${OUT_DIR}/${model}.png" --iters "${HOST_ITERS:-50}" ${BENCH_ARGS[@]+"${BENCH_ARGS[@]}"})"
+  echo "$out"
+  hash="$(awk '/^frame/ { print $NF }' <<<"$out")"
+  want="$(awk -v m="$model" '$1 == m { print $2 }' "$GOLDEN")"
+
+  if [ "$UPDATE" = "1" ]; then
+    grep -v "^${model} " "$GOLDEN" >"${GOLDEN}.tmp" || true
+    echo "${model} ${hash}" >>"${GOLDEN}.tmp"
+    sort -o "$GOLDEN" "${GOLDEN}.tmp"
+    rm -f "${GOLDEN}.tmp"
+    echo "golden ${model} <- ${hash}"
+  elif [ -z "$want" ]; then
+    echo "golden ${model}: none recorded (run with --update)" >&2
+    status=1
+  elif [ "$want" != "$hash" ]; then
+    echo "golden ${model}: MISMATCH want ${want} got ${hash}; see ${OUT_DIR}/${model}.png" >&2
+    status=1
+  else
+    echo "golden ${model}: ok"
+  fi
+done
+
+# Platform-independent: the worker only shares yes_astro.c and yes_batt.c with the face.
+worker_bin="${OUT_DIR}/worker-check"
+# shellcheck disable=SC2086
+"$CC" -std=gnu11 -O2 -Wall -Wextra -Wno-unused-parameter -Wno-missing-field-initializers \
+  -I"$HOST_DIR" -I"${ROOT_DIR}/src/c" -I"${ROOT_DIR}/worker_src/c" -DYES_WORKER=1 -DPBL_COLOR -DPBL_RECT \
+  ${HOST_CFLAGS:-} \
+  "${HOST_DIR}/worker_check.c" "${HOST_DIR}/host_worker.c" "${HOST_DIR}/host_pebble.c" \
+  "${ROOT_DIR}/src/c/yes_astro.c" "${ROOT_DIR}/src/c/yes_batt.c" \
+  -lm -o "$worker_bin"
+HOST_QUIET=1 "$worker_bin" || status=1
+
+exit "$status"
@@ -0,0 +1,83 @@
+// Scores tools/host/sun_sweep output (stdin) against calcSunriseSunsetMinutes from the phone
+// companion and prints the error distribution next to the cost (trig lookups per solve).
+// Usage: sun_sweep ... | node tools/host/sun_ref.mjs [label]
+import readline from 'node:readline';
+import { loadPkjs } from './pkjs_context.mjs';
+
+const pkjs = loadPkjs();
+const label = process.argv[2] || 'default';
+const BANDS = [[0, 50], [50, 60], [60, 66], [66, 90]];
+const BUCKETS = [[0, 0], [1, 1], [2, 2], [3, 5], [6, 10], [11, 1440]];
+
+function newStats() {
+  return { solves: 0, trig: 0, trigMax: 0, stateMis: 0, errs: [], worst: [], bands: BANDS.map(() => ({ n: 0, errs: [], stateMis: 0 })) };
+}
+
+function minuteErr(a, b) {
+  const e = Math.abs(a - b) % 1440;
+  return Math.min(e, 1440 - e);
+}
+
+function pct(sorted, p) {
+  if (!sorted.length) return 0;
+  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+const engines = new Map();
+const rl = readline.createInterface({ input: process.stdin });
+rl.on('line', (line) => {
+  const f = line.trim().split(/\s+/);
+  if (f.length < 11) return;
+  const [latE6, lonE6, tz, y, m, d] = f.slice(0, 6).map(Number);
+  const engine = f[6];
+  const [state, rise, set, trig] = f.slice(7).map(Number);
+  if (!engines.has(engine)) engines.set(engine, newStats());
+  const st = engines.get(engine);
+  const band = st.bands[BANDS.findIndex(([lo, hi]) => Math.abs(latE6) / 1e6 >= lo && Math.abs(latE6) / 1e6 < hi)];
+
+  st.solves++;
+  st.trig += trig;
+  st.trigMax = Math.max(st.trigMax, trig);
+  const ref = pkjs.calcSunriseSunsetMinutes(latE6 / 1e6, lonE6 / 1e6, tz, { y, m, d });
+  if (ref.state !== state) {
+    st.stateMis++;
+    band.stateMis++;
+    return;
+  }
+  if (state !== 0) return;
+  for (const [c, j, what] of [[rise, ref.sunriseMin, 'rise'], [set, ref.sunsetMin, 'set']]) {
+    const e = minuteErr(c, j);
+    st.errs.push(e);
+    band.errs.push(e);
+    band.n++;
+    if (e > 2) {
+      st.worst.push({ e, what, lat: latE6 / 1e6, lon: lonE6 / 1e6, tz, ymd: `${y}-${m}-${d}`, c, j });
+      if (st.worst.length > 64) st.worst.sort((a, b) => b.e - a.e).splice(16);
+    }
+  }
+});
+
+rl.on('close', () => {
+  console.log(`== ${label}`);
+  for (const [engine, st] of engines) {
+    st.errs.sort((a, b) => a - b);
+    const hist = BUCKETS.map(([lo, hi]) => {
+      const n = st.errs.filter((e) => e >= lo && e <= hi).length;
+      const name = lo === hi ? `${lo}` : (hi >= 1440 ? `>${lo - 1}` : `${lo}-${hi}`);
+      return `${name}:${(100 * n / Math.max(1, st.errs.length)).toFixed(2)}%`;
+    }).join(' ');
+    console.log(`${engine.padEnd(4)} solves ${st.solves}  trig/solve ${(st.trig / st.solves).toFixed(1)} (max ${st.trigMax})  ` +
+                `state mismatch ${st.stateMis}  err p50 ${pct(st.errs, 0.5)} p95 ${pct(st.errs, 0.95)} ` +
+                `p99 ${pct(st.errs, 0.99)} max ${st.errs.length ? st.errs[st.errs.length - 1] : 0} min`);
+    console.log(`     ${hist}`);
+    st.bands.forEach((b, i) => {
+      if (!b.n && !b.stateMis) return;
+      b.errs.sort((x, y) => x - y);
+      console.log(`     |lat| ${String(BANDS[i][0]).padStart(2)}-${BANDS[i][1]}: events ${b.n} p95 ${pct(b.errs, 0.95)} ` +
+                  `max ${b.errs.length ? b.errs[b.errs.length - 1] : 0} state mismatch ${b.stateMis}`);
+    });
+    st.worst.sort((a, b) => b.e - a.e).slice(0, 3).forEach((w) => {
+      console.log(`     worst ${w.e} min ${w.what} lat ${w.lat} lon ${w.lon} tz ${w.tz} ${w.ymd}: watch ${w.c} js ${w.j}`);
+    });
+  }
+});
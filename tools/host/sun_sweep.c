@@ -0,0 +1,66 @@
+// Sweeps the watch sunrise/sunset engine over a lat/lon/tz/day grid and prints one line per
+// solve for tools/host/sun_ref.mjs, which scores it against the phone-side JS:
+//   lat_e6 lon_e6 tz_min year month day engine state rise_min set_min trig_calls
+// engine is "fast" (analytic path, only when it applies) or "full" (what the watch shows);
+// state is 0 normal, 1 always day, 2 always night.
+
+#include <pebble.h>
+
+#include "yes_astro.h"
+
+static int arg_int(int argc, char **argv, const char *name, int def) {
+  for (int i = 1; i + 1 < argc; i++) {
+    if (!strcmp(argv[i], name)) return atoi(argv[i + 1]);
+  }
+  return def;
+}
+
+static void emit(int32_t lat_e6, int32_t lon_e6, int tz, const struct tm *d, const char *engine,
+                 const SunTimes *s, uint32_t trig) {
+  const int state = s->always_day ? 1 : (s->always_night ? 2 : 0);
+  printf("%ld %ld %d %d %d %d %s %d %d %d %u\n", (long)lat_e6, (long)lon_e6, tz,
+         d->tm_year + 1900, d->tm_mon + 1, d->tm_mday, engine, state,
+         s->sunrise_min, s->sunset_min, (unsigned)trig);
+}
+
+int main(int argc, char **argv) {
+  // Latitudes in tenths of a degree so high-latitude bands can be sampled finely.
+  const int lat_max10 = arg_int(argc, argv, "--lat-max", 750);
+  const int lat_step10 = arg_int(argc, argv, "--lat-step", 25);
+  const int lon_step = arg_int(argc, argv, "--lon-step", 45);
+  const int day_step = arg_int(argc, argv, "--day-step", 3);
+  const int year = arg_int(argc, argv, "--year", 2025);
+  // Civil offsets around the solar one: +-1 h covers DST and most zone-edge cities.
+  static const int tz_skews[] = { -60, 0, 60 };
+
+  struct tm jan1 = { .tm_year = year - 1900, .tm_mon = 0, .tm_mday = 1, .tm_hour = 12 };
+  const time_t t_jan1 = timegm(&jan1);
+
+  for (int lat10 = -lat_max10; lat10 <= lat_max10; lat10 += lat_step10) {
+    const int32_t lat_e6 = lat10 * 100000;
+    for (int lon = -180 + lon_step / 2; lon < 180; lon += lon_step) {
+      const int32_t lon_e6 = lon * 1000000;
+      const int tz_solar = ((lon >= 0 ? lon + 7 : lon - 7) / 15) * 60;
+      for (size_t k = 0; k < sizeof(tz_skews) / sizeof(tz_skews[0]); k++) {
+        const int tz = tz_solar + tz_skews[k];
+        for (int doy = 0; doy < 366; doy += day_step) {
+          const time_t t = t_jan1 + (time_t)doy * 86400;
+          struct tm d;
+          gmtime_r(&t, &d);
+          if (d.tm_year + 1900 != year) break;
+
+          SunTimes s;
+          host_trig_calls = 0;
+          if (calc_sunrise_sunset_fast(d.tm_year + 1900, d.tm_mon + 1, d.tm_mday, lat_e6, lon_e6, tz, &s)) {
+            emit(lat_e6, lon_e6, tz, &d, "fast", &s, host_trig_calls);
+          }
+          host_trig_calls = 0;
+          s = calc_sunrise_sunset_local(d.tm_year + 1900, d.tm_mon + 1, d.tm_mday,
+                                        lat_e6 / 1e6, lon_e6 / 1e6, tz);
+          emit(lat_e6, lon_e6, tz, &d, "full", &s, host_trig_calls);
+        }
+      }
+    }
+  }
+  return 0;
+}
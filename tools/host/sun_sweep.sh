@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+HOST_DIR="${ROOT_DIR}/tools/host"
+OUT_DIR="${HOST_OUT_DIR:-${ROOT_DIR}/build/host}"
+CC="${CC:-cc}"
+
+usage() {
+  cat <<'USAGE'
+Usage: tools/host/sun_sweep.sh [variant...]
+
+Sweeps the watch sunrise/sunset solver (src/c/yes_astro.c) over a lat/lon/tz/day
+grid, scores every solve against calcSunriseSunsetMinutes in src/pkjs/index.js and
+prints the error distribution next to the cost in trig lookups per solve.
+"full" is what the watch displays; "fast" is the analytic path where it applies.
+
+Variants rebuild the solver with different SUN_* knobs (default: all of them):
+  default   shipped settings
+  scan      analytic path disabled: 10-minute scan + bisection everywhere
+  edge90 / edge99
+            SUN_COS_H0_EDGE_PCT 90 / 99: hand more / fewer days to the scan
+  step5 / step20 / step30
+            SUN_SCAN_STEP_MIN for the scan (analytic path disabled)
+  bisect4   SUN_BISECT_STEPS 4 (analytic path disabled)
+
+Environment:
+  SWEEP_ARGS  Grid for sun_sweep (default: --lat-max 750 --lat-step 25 --lon-step 45 --day-step 3;
+              latitudes in tenths of a degree)
+  CC          Host C compiler (default: cc)
+USAGE
+}
+
+variant_flags() {
+  case "$1" in
+    default) echo "" ;;
+    scan)    echo "-DSUN_COS_H0_EDGE_PCT=0" ;;
+    edge90)  echo "-DSUN_COS_H0_EDGE_PCT=90" ;;
+    edge99)  echo "-DSUN_COS_H0_EDGE_PCT=99" ;;
+    step5)   echo "-DSUN_COS_H0_EDGE_PCT=0 -DSUN_SCAN_STEP_MIN=5" ;;
+    step20)  echo "-DSUN_COS_H0_EDGE_PCT=0 -DSUN_SCAN_STEP_MIN=20" ;;
+    step30)  echo "-DSUN_COS_H0_EDGE_PCT=0 -DSUN_SCAN_STEP_MIN=30" ;;
+    bisect4) echo "-DSUN_COS_H0_EDGE_PCT=0 -DSUN_BISECT_STEPS=4" ;;
+    *) return 1 ;;
+  esac
+}
+
+VARIANTS=("$@")
+if [ "${#VARIANTS[@]}" -eq 0 ]; then
+  VARIANTS=(default scan edge90 edge99 step5 step20 step30 bisect4)
+fi
+case "${VARIANTS[0]}" in -h|--help) usage; exit 0 ;; esac
+
+mkdir -p "$OUT_DIR"
+for v in "${VARIANTS[@]}"; do
+  if ! flags="$(variant_flags "$v")"; then
+    echo "Unknown variant: ${v}" >&2
+    exit 2
+  fi
+  bin="${OUT_DIR}/sun-sweep-${v}"
+  # shellcheck disable=SC2086
+  "$CC" -std=gnu11 -O2 -Wall -Wextra -Wno-unused-parameter -I"$HOST_DIR" -I"${ROOT_DIR}/src/c" $flags \
+    "${HOST_DIR}/sun_sweep.c" "${HOST_DIR}/host_pebble.c" "${ROOT_DIR}/src/c/yes_astro.c" -lm -o "$bin"
+  # shellcheck disable=SC2086
+  "$bin" ${SWEEP_ARGS:---lat-max 750 --lat-step 25 --lon-step 45 --day-step 3} | node "${HOST_DIR}/sun_ref.mjs" "$v"
+done
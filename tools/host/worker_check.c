@@ -0,0 +1,270 @@
+// Host checks for the background worker (worker_src/c/yes_worker.c) on the fake worker runtime in
+// host_worker.c. Built once by tools/host/run.sh; prints one "worker <check>: ok" line per check,
+// or FAIL with the first broken expectation, and exits 1 on any failure.
+
+#include <pebble_worker.h>
+
+// The worker's statics are driven directly, so compile it in rather than linking its main.
+#define main yes_worker_main
+#include "yes_worker.c"
+#undef main
+
+// Berlin in winter (UTC+1).
+#define CHECK_LAT_E6 52520000
+#define CHECK_LON_E6 13405000
+#define CHECK_TZ_MIN 60
+#define CHECK_DAY0_UNIX 1741561200 // 2025-03-10 00:00 local
+
+static int s_failed;
+
+#define EXPECT(check, cond, ...) do {                         \
+    if (!(cond)) {                                            \
+      printf("worker %s: FAIL ", (check));                    \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+      s_failed = 1;                                           \
+      return false;                                           \
+    }                                                         \
+  } while (0)
+
+static int32_t local_ymd(time_t now) {
+  const time_t local = now + (time_t)CHECK_TZ_MIN * 60;
+  struct tm d;
+  gmtime_r(&local, &d);
+  return (d.tm_year + 1900) * 10000 + (d.tm_mon + 1) * 100 + d.tm_mday;
+}
+
+static void write_home(void) {
+  const GeoLoc home = { .lat_e6 = CHECK_LAT_E6, .lon_e6 = CHECK_LON_E6, .tz_offset_min = CHECK_TZ_MIN, .valid = true };
+  write_record(YES_WORKER_HOME_KEY, YES_WORKER_HOME_VERSION, &home, sizeof(home));
+}
+
+// What a face starting at `now` would find, as apply_worker_events_for_today looks it up.
+static const YesWorkerEvents *face_lookup(time_t now, YesWorkerEventDays *days) {
+  if (!read_record(YES_WORKER_EVENTS_KEY, YES_WORKER_EVENTS_VERSION, days, sizeof(*days))) return NULL;
+  return yes_worker_events_find(days, local_ymd(now), CHECK_LAT_E6, CHECK_LON_E6, CHECK_TZ_MIN, 0);
+}
+
+// Steps a clock minute by minute from 22:00 on day 0 to the end of day 2, firing the hourly tick on each hour
+// like the firmware. A face starting at any minute must find today's events on file, solved once
+// per day.
+static bool check_events_across_midnight(void) {
+  const char *name = "events across midnight";
+  host_persist_clear();
+  write_home();
+  time_t now = CHECK_DAY0_UNIX + 22 * 3600;
+  host_set_time(now, CHECK_TZ_MIN);
+  prv_init();
+  host_worker_run_timers(100000);
+
+  const int solves0 = host_worker_sent(YES_WORKER_MSG_EVENTS);
+  EXPECT(name, solves0 == 2, "init solved %d days, want today and tomorrow", solves0);
+
+  const time_t end = CHECK_DAY0_UNIX + 3 * 86400;
+  for (; now < end; now += 60) {
+    host_set_time(now, CHECK_TZ_MIN);
+    // A face may start in the same second as the worker's tick, before it has run.
+    YesWorkerEventDays days;
+    const YesWorkerEvents *ev = face_lookup(now, &days);
+    EXPECT(name, ev && ev->sun.valid && ev->moon.valid, "no events for %d at unix %ld (on file: %d, %d)",
+           (int)local_ymd(now), (long)now, (int)days.day[0].ymd, (int)days.day[1].ymd);
+    if ((now - CHECK_DAY0_UNIX) % 3600 == 0) {
+      host_worker_tick(HOUR_UNIT);
+      host_worker_run_timers(100000);
+      ev = face_lookup(now, &days);
+      EXPECT(name, ev, "tick at unix %ld dropped %d", (long)now, (int)local_ymd(now));
+    }
+  }
+
+  // Days 0 and 1 at init, then days 2 and 3 at the two midnights; nothing re-solved.
+  const int solves = host_worker_sent(YES_WORKER_MSG_EVENTS) - solves0;
+  EXPECT(name, solves == 2, "%d solves after init over two midnights, want 2", solves);
+  prv_deinit();
+  return true;
+}
+
+// A move re-solves both days for the new place.
+static bool check_events_after_move(void) {
+  const char *name = "events after a move";
+  host_persist_clear();
+  write_home();
+  const time_t now = CHECK_DAY0_UNIX + 12 * 3600;
+  host_set_time(now, CHECK_TZ_MIN);
+  prv_init();
+  host_worker_run_timers(100000);
+
+  const GeoLoc moved = { .lat_e6 = CHECK_LAT_E6 + 5000000, .lon_e6 = CHECK_LON_E6,
+                         .tz_offset_min = CHECK_TZ_MIN, .valid = true };
+  write_record(YES_WORKER_HOME_KEY, YES_WORKER_HOME_VERSION, &moved, sizeof(moved));
+  host_worker_tick(HOUR_UNIT);
+  host_worker_run_timers(100000);
+
+  YesWorkerEventDays days;
+  EXPECT(name, read_record(YES_WORKER_EVENTS_KEY, YES_WORKER_EVENTS_VERSION, &days, sizeof(days)), "no record");
+  for (int i = 0; i < YES_WORKER_EVENT_DAYS; i++) {
+    EXPECT(name, days.day[i].lat_e6 == moved.lat_e6 && days.day[i].ymd == local_ymd(now + i * 86400),
+           "entry %d is %d at lat %ld", i, (int)days.day[i].ymd, (long)days.day[i].lat_e6);
+  }
+  prv_deinit();
+  return true;
+}
+
+// ---- battery cost fit (yes_batt_fit) ----
+
+// Known costs: 1e-6 % per hour of standby, 1e-6 % per event.
+#define TRUE_BASE_UPH 300000
+#define TRUE_REDRAW_U 40
+#define TRUE_WAKE_U 15
+#define TRUE_MSG_U 2000
+
+// Redraws, wakes and messages per hour across a week of use: corner cycles, low power stretches
+// and busy and quiet phone hours.
+static const uint16_t k_rates[][3] = {
+  { 780, 800, 2 }, { 420, 480, 6 }, { 180, 240, 1 }, { 60, 120, 12 },
+  { 780, 900, 0 }, { 120, 180, 4 }, { 400, 420, 9 }, { 60, 60, 3 },
+  { 240, 300, 20 }, { 700, 720, 5 }, { 90, 150, 0 }, { 300, 420, 15 },
+};
+
+// One sample per 1 % drop at those rates; msg_scale 0 drops the messages entirely.
+static void synth_history(YesBattHistory *h, int msg_scale, int32_t msg_cost_u) {
+  *h = (YesBattHistory){ 0 };
+  for (size_t i = 0; i < sizeof(k_rates) / sizeof(k_rates[0]); i++) {
+    const int64_t rd = k_rates[i][0], wk = k_rates[i][1], msg = k_rates[i][2] * msg_scale;
+    const int64_t uph = TRUE_BASE_UPH + rd * TRUE_REDRAW_U + wk * TRUE_WAKE_U + msg * msg_cost_u;
+    const uint32_t minutes = (uint32_t)((60LL * 1000000 + uph / 2) / uph);
+    const YesBattSample s = {
+      .minutes = minutes,
+      .drop_percent = 1,
+      .act = { .redraws = (uint32_t)(rd * minutes / 60), .wakes = (uint32_t)(wk * minutes / 60),
+               .msgs = (uint32_t)(msg * minutes / 60) },
+    };
+    yes_batt_history_push(h, &s);
+  }
+}
+
+static bool within(int32_t got, int32_t want, int pct) {
+  const int32_t d = got > want ? got - want : want - got;
+  return (int64_t)d * 100 <= (int64_t)want * pct;
+}
+
+// Recovers the costs a history was generated with, from whole-minute 1 % levels as the worker
+// files them. Wakes and redraws move together, so the ridge evens out their split: each must be
+// found, and their cost per hour must be near exact, as must the base and the message cost.
+static bool check_fit_recovers_costs(void) {
+  const char *name = "fit recovers costs";
+  YesBattHistory h;
+  synth_history(&h, 1, TRUE_MSG_U);
+  YesBattFit f;
+  EXPECT(name, yes_batt_fit(&h, &f), "fit failed");
+  EXPECT(name, f.samples == YES_BATT_SAMPLES, "samples %d", f.samples);
+  EXPECT(name, within(f.base_uph, TRUE_BASE_UPH, 3), "base %ld, want %d", (long)f.base_uph, TRUE_BASE_UPH);
+  EXPECT(name, within(f.msg_u, TRUE_MSG_U, 10), "msg %ld, want %d", (long)f.msg_u, TRUE_MSG_U);
+  EXPECT(name, f.redraw_u > 0 && f.wake_u > 0, "redraw %ld, wake %ld", (long)f.redraw_u, (long)f.wake_u);
+  const int32_t act = f.redraw_u * f.redraws_ph + f.wake_u * f.wakes_ph;
+  const int32_t act_true = TRUE_REDRAW_U * f.redraws_ph + TRUE_WAKE_U * f.wakes_ph;
+  EXPECT(name, within(act, act_true, 5), "redraws+wakes %ld/h, want %ld", (long)act, (long)act_true);
+  return true;
+}
+
+// A term that never happens, happens at one steady rate, or would come out negative, stays 0.
+static bool check_fit_pins_flat_terms(void) {
+  const char *name = "fit pins flat terms";
+  YesBattHistory h;
+  synth_history(&h, 0, TRUE_MSG_U);
+  YesBattFit f;
+  EXPECT(name, yes_batt_fit(&h, &f), "fit failed without messages");
+  EXPECT(name, f.msg_u == 0 && f.msgs_ph == 0, "msg %ld at %u/h", (long)f.msg_u, f.msgs_ph);
+  EXPECT(name, within(f.base_uph, TRUE_BASE_UPH, 3), "base %ld without messages", (long)f.base_uph);
+
+  for (int i = 0; i < h.count; i++) {
+    h.s[i].act.msgs = h.s[i].minutes / 10; // 6 per hour, every sample
+  }
+  EXPECT(name, yes_batt_fit(&h, &f), "fit failed with steady messages");
+  EXPECT(name, f.msg_u == 0 && f.msgs_ph == 6, "steady msg %ld at %u/h", (long)f.msg_u, f.msgs_ph);
+
+  // Messages that seem to save power: pinned to 0, the rest refit and still found.
+  synth_history(&h, 1, -TRUE_MSG_U / 4);
+  EXPECT(name, yes_batt_fit(&h, &f), "fit failed with a negative cost");
+  EXPECT(name, f.msg_u == 0 && f.base_uph > 0 && f.redraw_u > 0 && f.wake_u > 0,
+         "negative msg: base %ld redraw %ld wake %ld msg %ld",
+         (long)f.base_uph, (long)f.redraw_u, (long)f.wake_u, (long)f.msg_u);
+  return true;
+}
+
+// Identical samples, zero-minute samples or too few samples cannot be split: false, samples 0.
+static bool check_fit_rejects_singular(void) {
+  const char *name = "fit rejects singular histories";
+  YesBattHistory h = { 0 };
+  const YesBattSample same = { .minutes = 240, .drop_percent = 1, .act = { 2880, 3000, 24 } };
+  for (int i = 0; i < YES_BATT_SAMPLES; i++) yes_batt_history_push(&h, &same);
+  YesBattFit f;
+  EXPECT(name, !yes_batt_fit(&h, &f) && f.samples == 0, "identical samples fitted");
+
+  synth_history(&h, 1, TRUE_MSG_U);
+  for (int i = 0; i < h.count; i++) h.s[i].minutes = 0;
+  EXPECT(name, !yes_batt_fit(&h, &f) && f.samples == 0, "zero-minute samples fitted");
+
+  synth_history(&h, 1, TRUE_MSG_U);
+  h.count = YES_BATT_FIT_MIN_SAMPLES - 1;
+  EXPECT(name, !yes_batt_fit(&h, &f), "fitted %d samples", h.count);
+
+  // Zero-minute samples among good ones are skipped, not counted.
+  synth_history(&h, 1, TRUE_MSG_U);
+  YesBattFit want;
+  yes_batt_fit(&h, &want);
+  h.s[3].minutes = 0;
+  h.s[7].minutes = 0;
+  EXPECT(name, yes_batt_fit(&h, &f) && f.samples == YES_BATT_SAMPLES - 2, "samples %d with two empty", f.samples);
+  EXPECT(name, within(f.base_uph, want.base_uph, 3), "base %ld, %ld with all", (long)f.base_uph, (long)want.base_uph);
+  return true;
+}
+
+// End to end through the worker: battery drops with face activity in between land in the fit key.
+static bool check_worker_files_fit(void) {
+  const char *name = "worker files the fit";
+  host_persist_clear();
+  time_t now = CHECK_DAY0_UNIX;
+  host_set_time(now, CHECK_TZ_MIN);
+  host_worker_set_battery((BatteryChargeState){ .charge_percent = 90 });
+  prv_init();
+  const int levels = YES_BATT_FIT_MIN_SAMPLES + 2;
+  for (int i = 0; i < levels; i++) {
+    // Quiet and busy levels alternate: the quiet ones last longer.
+    const bool busy = i % 2;
+    AppWorkerMessage act = { .data0 = busy ? 3000 : 300, .data1 = busy ? 3200 : 500, .data2 = busy ? 30 : 2 };
+    host_worker_face_message(YES_WORKER_MSG_ACTIVITY, &act);
+    now += busy ? 4 * 3600 : 6 * 3600;
+    host_set_time(now, CHECK_TZ_MIN);
+    host_worker_set_battery((BatteryChargeState){ .charge_percent = (uint8_t)(89 - i) });
+  }
+  YesBattFit f;
+  EXPECT(name, read_record(YES_WORKER_FIT_KEY, YES_WORKER_FIT_VERSION, &f, sizeof(f)), "no fit record");
+  // The level in progress at init is not filed (its activity is unknown).
+  EXPECT(name, f.samples == levels - 1, "samples %d, want %d", f.samples, levels - 1);
+  EXPECT(name, f.base_uph > 0, "base %ld", (long)f.base_uph);
+  prv_deinit();
+  return true;
+}
+
+int main(void) {
+  static bool (*const checks[])(void) = {
+    check_events_across_midnight,
+    check_events_after_move,
+    check_fit_recovers_costs,
+    check_fit_pins_flat_terms,
+    check_fit_rejects_singular,
+    check_worker_files_fit,
+  };
+  static const char *const names[] = {
+    "events across midnight",
+    "events after a move",
+    "fit recovers costs",
+    "fit pins flat terms",
+    "fit rejects singular histories",
+    "worker files the fit",
+  };
+  for (size_t i = 0; i < sizeof(checks) / sizeof(checks[0]); i++) {
+    if (checks[i]()) printf("worker %s: ok\n", names[i]);
+  }
+  return s_failed;
+}
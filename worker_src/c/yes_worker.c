@@ -0,0 +1,187 @@
+#include <string.h>
+
+#include "yes_astro.h"
+#include "yes_worker.h"
+
+// Background worker: keeps the battery model fed while the face is closed, files one discharge
+// sample per battery level for the per-feature cost fit, and keeps today's and tomorrow's sun/moon
+// solved, so the face wakes up to all of it instead of rebuilding it. See src/c/yes_worker.h for the
+// hand-over.
+
+#define MOON_STEP_MS 200 // slices of the moon solver, as on the face
+
+static YesBattModel s_batt;
+static YesBattHistory s_history;
+static YesBattActivity s_segment; // face activity since the current battery level began
+static bool s_segment_valid;      // false until a level starts while the worker is running
+static MoonCalc s_moon_calc;
+static YesWorkerEventDays s_days; // as on file
+static int s_solving_day;         // entry of s_days the moon solver is filling
+static AppTimer *s_moon_timer;
+
+static bool read_record(uint32_t key, uint8_t version, void *buf, int size) {
+  uint8_t rec[1 + YES_WORKER_RECORD_MAX];
+  if (size > (int)sizeof(rec) - 1) return false;
+  const int len = persist_read_data(key, rec, sizeof(rec));
+  if (len != 1 + size || rec[0] != version) return false;
+  memcpy(buf, &rec[1], size);
+  return true;
+}
+
+static void write_record(uint32_t key, uint8_t version, const void *buf, int size) {
+  uint8_t rec[1 + YES_WORKER_RECORD_MAX];
+  if (size > (int)sizeof(rec) - 1) return;
+  rec[0] = version;
+  memcpy(&rec[1], buf, size);
+  persist_write_data(key, rec, 1 + size);
+}
+
+// A closed face has nobody subscribed; the message is simply dropped.
+static void notify_face(uint8_t type) {
+  AppWorkerMessage msg = { 0 };
+  app_worker_send_message(type, &msg);
+}
+
+// One level lasted from its anchor until now: file it with what the face did meanwhile and refit.
+static void close_segment(const YesBattModel *before, int percent, time_t now) {
+  const int drop = before->last_percent - percent;
+  if (s_segment_valid && before->last_percent >= 0 && drop > 0 && now - before->last_time >= 60) {
+    const YesBattSample sample = {
+      .minutes = (uint32_t)((now - before->last_time) / 60),
+      .drop_percent = (uint32_t)drop,
+      .act = s_segment,
+    };
+    yes_batt_history_push(&s_history, &sample);
+    write_record(YES_WORKER_HISTORY_KEY, YES_WORKER_HISTORY_VERSION, &s_history, sizeof(s_history));
+    YesBattFit fit;
+    yes_batt_fit(&s_history, &fit);
+    write_record(YES_WORKER_FIT_KEY, YES_WORKER_FIT_VERSION, &fit, sizeof(fit));
+  }
+  s_segment = (YesBattActivity){ 0 };
+  s_segment_valid = true;
+}
+
+static void battery_handler(BatteryChargeState st) {
+  const YesBattModel before = s_batt;
+  const time_t now = time(NULL);
+  yes_batt_sample(&s_batt, st, now);
+  if (!memcmp(&before, &s_batt, sizeof(s_batt))) return;
+  if (st.is_plugged) {
+    s_segment_valid = false; // the next level starts when the cable comes off
+  } else {
+    close_segment(&before, st.charge_percent, now);
+  }
+  write_record(YES_WORKER_BATT_KEY, YES_WORKER_BATT_VERSION, &s_batt, sizeof(s_batt));
+  notify_face(YES_WORKER_MSG_BATT);
+}
+
+static void face_message_handler(uint16_t type, AppWorkerMessage *data) {
+  if (type != YES_WORKER_MSG_ACTIVITY || !data) return;
+  s_segment.redraws += data->data0;
+  s_segment.wakes += data->data1;
+  s_segment.msgs += data->data2;
+}
+
+static void precompute_events(void);
+
+static void moon_step_cb(void *context) {
+  (void)context;
+  s_moon_timer = NULL;
+  if (!moon_calc_step(&s_moon_calc)) {
+    s_moon_timer = app_timer_register(MOON_STEP_MS, moon_step_cb, NULL);
+    return;
+  }
+  YesWorkerEvents *ev = &s_days.day[s_solving_day];
+  ev->moon = moon_calc_result(&s_moon_calc);
+  write_record(YES_WORKER_EVENTS_KEY, YES_WORKER_EVENTS_VERSION, &s_days, sizeof(s_days));
+  APP_LOG(APP_LOG_LEVEL_INFO, "worker: events for %d", (int)ev->ymd);
+  notify_face(YES_WORKER_MSG_EVENTS);
+  precompute_events(); // the other day, if it is missing too
+}
+
+// Today and tomorrow at the face's home location. Entries that are still current are kept (at
+// midnight tomorrow's becomes today's), the rest are solved one at a time. Runs hourly, which also
+// picks up a move or a new UTC offset.
+static void precompute_events(void) {
+  if (s_moon_timer) return;
+  GeoLoc home;
+  if (!read_record(YES_WORKER_HOME_KEY, YES_WORKER_HOME_VERSION, &home, sizeof(home)) || !home.valid) return;
+  const int32_t tz = yes_tz_offset_min(&home);
+  const time_t now = time(NULL);
+
+  YesWorkerEventDays want = { 0 };
+  int missing = -1;
+  int y = 0, m = 0, day = 0;
+  for (int i = 0; i < YES_WORKER_EVENT_DAYS; i++) {
+    const time_t local = now + (time_t)tz * 60 + (time_t)i * 86400;
+    const struct tm *d = gmtime(&local);
+    if (!d) return;
+    const int32_t ymd = (d->tm_year + 1900) * 10000 + (d->tm_mon + 1) * 100 + d->tm_mday;
+    const YesWorkerEvents *have = yes_worker_events_find(&s_days, ymd, home.lat_e6, home.lon_e6, tz, 0);
+    if (have) {
+      want.day[i] = *have;
+    } else if (missing < 0) {
+      missing = i;
+      y = d->tm_year + 1900;
+      m = d->tm_mon + 1;
+      day = d->tm_mday;
+    }
+  }
+
+  bool changed = false;
+  for (int i = 0; i < YES_WORKER_EVENT_DAYS; i++) {
+    if (want.day[i].ymd != s_days.day[i].ymd) changed = true;
+  }
+  s_days = want;
+  if (changed) write_record(YES_WORKER_EVENTS_KEY, YES_WORKER_EVENTS_VERSION, &s_days, sizeof(s_days));
+  if (missing < 0) return;
+
+  // Filled in memory only; the entry goes on file once the moon is solved too.
+  YesWorkerEvents *ev = &s_days.day[missing];
+  *ev = (YesWorkerEvents){ .ymd = y * 10000 + m * 100 + day, .lat_e6 = home.lat_e6,
+                           .lon_e6 = home.lon_e6, .tz_offset_min = tz };
+  ev->sun = calc_sunrise_sunset_e6(y, m, day, home.lat_e6, home.lon_e6, tz);
+  s_solving_day = missing;
+  moon_calc_begin(&s_moon_calc, y, m, day, home.lat_e6, home.lon_e6, tz);
+  s_moon_timer = app_timer_register(MOON_STEP_MS, moon_step_cb, NULL);
+}
+
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+  (void)tick_time;
+  (void)units_changed;
+  precompute_events();
+}
+
+static void prv_init(void) {
+  if (!read_record(YES_WORKER_BATT_KEY, YES_WORKER_BATT_VERSION, &s_batt, sizeof(s_batt))) {
+    yes_batt_reset(&s_batt);
+  }
+  if (!read_record(YES_WORKER_HISTORY_KEY, YES_WORKER_HISTORY_VERSION, &s_history, sizeof(s_history))) {
+    s_history = (YesBattHistory){ 0 };
+  }
+  if (!read_record(YES_WORKER_EVENTS_KEY, YES_WORKER_EVENTS_VERSION, &s_days, sizeof(s_days))) {
+    s_days = (YesWorkerEventDays){ 0 };
+  }
+  app_worker_message_subscribe(face_message_handler);
+  battery_handler(battery_state_service_peek());
+  // The level in progress began before this worker did, so its activity is unknown: do not file it.
+  // (Set after the first reading, which may anchor the model and would otherwise open a segment.)
+  s_segment_valid = false;
+  battery_state_service_subscribe(battery_handler);
+  tick_timer_service_subscribe(HOUR_UNIT, tick_handler);
+  precompute_events();
+}
+
+static void prv_deinit(void) {
+  app_worker_message_unsubscribe();
+  tick_timer_service_unsubscribe();
+  battery_state_service_unsubscribe();
+  if (s_moon_timer) app_timer_cancel(s_moon_timer);
+}
+
+int main(void) {
+  prv_init();
+  worker_event_loop();
+  prv_deinit();
+  return 0;
+}